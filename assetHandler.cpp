@@ -0,0 +1,68 @@
+#include "assetHandler.h"
+
+void assetHandler::begin() {
+    memset(_slots, EMPTY, sizeof(_slots));
+    _perfect = true;
+    for (size_t i = 0; i < _count; i++) {
+        const uint8_t slot = pathHash(_assets[i].path, _seed) >> SLOT_SHIFT;
+        if (_slots[slot] != EMPTY) {
+            log_e("ERROR! '%s' and '%s' share a slot - run tools/generate_assets.py", _assets[i].path, _assets[_slots[slot]].path);
+            _perfect = false;
+        }
+        _slots[slot] = i;
+    }
+}
+
+int assetHandler::find(const char* path) const {
+    if (_perfect) {
+        const int8_t index = _slots[pathHash(path, _seed) >> SLOT_SHIFT];
+        return (index != EMPTY && !strcmp(path, _assets[index].path)) ? index : EMPTY;
+    }
+    for (size_t i = 0; i < _count; i++)
+        if (!strcmp(path, _assets[i].path)) return i;
+    return EMPTY;
+}
+
+bool assetHandler::canHandle(AsyncWebServerRequest* request) {
+    return request->method() == HTTP_GET && find(request->url().c_str()) != EMPTY;
+}
+
+/* true when 'coding' is in the Accept-Encoding list and not refused with q=0 */
+static bool accepts(AsyncWebServerRequest* request, const char* coding) {
+    static const char* HEADER_ACCEPT_ENCODING = "Accept-Encoding";
+    if (!request->hasHeader(HEADER_ACCEPT_ENCODING)) return false;
+    const String accepted = request->header(HEADER_ACCEPT_ENCODING);
+    const size_t length = strlen(coding);
+    const char* item = accepted.c_str();
+    while (*item) {
+        while (*item == ' ' || *item == ',') item++;
+        const char* end = item;
+        while (*end && *end != ',') end++;
+        if (!strncmp(item, coding, length) && (item[length] == ',' || item[length] == ';' || item[length] == ' ' || !item[length])) {
+            const char* q = strstr(item, "q=");
+            return !(q && q < end && atof(q + 2) == 0);
+        }
+        item = end;
+    }
+    return false;
+}
+
+void assetHandler::handleRequest(AsyncWebServerRequest* request) {
+    const int index = find(request->url().c_str());
+    if (index == EMPTY) return request->send(404);
+
+    const staticAsset& asset = _assets[index];
+    const bool brotli = asset.brotli && accepts(request, "br");
+    const char* etag = brotli ? asset.brotliEtag : asset.gzipEtag;
+    const char* cacheControl = asset.immutable ? "public, max-age=31536000, immutable" : "no-cache";
+
+    static const char* HEADER_IF_NONE_MATCH = "If-None-Match";
+    const bool unmodified = request->hasHeader(HEADER_IF_NONE_MATCH) && request->header(HEADER_IF_NONE_MATCH).equals(etag);
+    AsyncWebServerResponse* const response = unmodified ? request->beginResponse(304)
+                                                        : request->beginResponse_P(200, asset.mimeType, brotli ? asset.brotli : asset.gzip, brotli ? asset.brotliLength : asset.gzipLength);
+    if (!unmodified) response->addHeader("Content-Encoding", brotli ? "br" : "gzip");
+    response->addHeader("ETag", etag);
+    response->addHeader("Cache-Control", cacheControl);
+    response->addHeader("Vary", "Accept-Encoding");
+    request->send(response);
+}
@@ -0,0 +1,66 @@
+#ifndef __ASSETHANDLER_H
+#define __ASSETHANDLER_H
+
+#include <Arduino.h>
+#include <ESPAsyncWebServer.h>
+
+/* Serves the static assets that are compiled into the firmware from one handler.
+   The assets, their ETags and the seed are generated by tools/generate_assets.py into webAssets.h.
+
+   A path is found with a perfect hash - one probe into a 32 slot table and a strcmp to confirm.
+   The seed gives every asset its own slot. If two paths collide anyway,
+   begin() logs it and lookups fall back to a linear search.
+
+   Every asset has a gzip body and can have a Brotli body - the client's Accept-Encoding picks one. */
+
+struct staticAsset {
+    const char* path;
+    const char* mimeType;
+    const uint8_t* gzip;
+    size_t gzipLength;
+    const char* gzipEtag;
+    const uint8_t* brotli; /* nullptr when there is no Brotli body */
+    size_t brotliLength;
+    const char* brotliEtag;
+    bool immutable; /* content never changes under this path - otherwise clients revalidate with the ETag */
+};
+
+class assetHandler : public AsyncWebHandler {
+
+  public:
+    template<size_t N>
+    assetHandler(const staticAsset (&assets)[N], const uint32_t seed)
+      : _assets(assets), _count(N), _seed(seed) {
+        static_assert(N <= SLOTS, "too many assets for the slot table");
+    }
+
+    /* fills the slot table - call before the server starts */
+    void begin();
+
+    bool canHandle(AsyncWebServerRequest* request) override;
+    void handleRequest(AsyncWebServerRequest* request) override;
+
+    static uint32_t pathHash(const char* path, const uint32_t seed) {
+        uint32_t hash = seed;
+        while (*path) {
+            hash ^= static_cast<uint8_t>(*path++);
+            hash *= 16777619;
+        }
+        return hash;
+    }
+
+  private:
+    static constexpr const size_t SLOTS = 32;
+    static constexpr const uint8_t SLOT_SHIFT = 27; /* top 5 bits - the low bits of FNV-1a only depend on the low bits of the seed */
+    static constexpr const int8_t EMPTY = -1;
+
+    int find(const char* path) const;
+
+    const staticAsset* _assets;
+    const size_t _count;
+    const uint32_t _seed;
+    int8_t _slots[SLOTS];
+    bool _perfect{ false };
+};
+
+#endif
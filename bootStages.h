@@ -0,0 +1,60 @@
+#ifndef __BOOTSTAGES_H
+#define __BOOTSTAGES_H
+
+#include <Arduino.h>
+#include <atomic>
+
+/* Start and end of the boot stages in ms since power on - the stages run in parallel where they can.
+   FIRST_AUDIO ends when the first bytes of the first item reach the decoder - that is the time-to-first-audio. */
+
+class bootStages {
+
+  public:
+    enum stage : uint8_t { CODEC,
+                           FFAT,
+                           WIFI,
+                           PLAYLIST,
+                           WEBSERVER,
+                           NTP,
+                           FIRST_AUDIO,
+                           COUNT };
+
+    static constexpr const uint32_t NOT_YET = UINT32_MAX;
+
+    bootStages() {
+        for (size_t i = 0; i < COUNT; i++) _started[i] = _done[i] = NOT_YET;
+    }
+
+    void start(const stage s) {
+        _started[s] = millis();
+    }
+
+    void done(const stage s) {
+        if (_done[s] != NOT_YET) return;
+        _done[s] = millis();
+        log_i("Boot stage %s done at %u ms", name(s), _done[s].load());
+    }
+
+    bool isDone(const stage s) const {
+        return _done[s] != NOT_YET;
+    }
+
+    uint32_t started(const stage s) const {
+        return _started[s];
+    }
+
+    uint32_t finished(const stage s) const {
+        return _done[s];
+    }
+
+    static const char* name(const stage s) {
+        static const char* names[COUNT]{ "codec", "ffat", "wifi", "playlist", "webserver", "ntp", "first_audio" };
+        return s < COUNT ? names[s] : "unknown";
+    }
+
+  private:
+    std::atomic<uint32_t> _started[COUNT];
+    std::atomic<uint32_t> _done[COUNT];
+};
+
+#endif
@@ -0,0 +1,97 @@
+#include "broadcastSocket.h"
+
+broadcastSocket::broadcastSocket(const String& url, std::atomic<uint32_t>& counter)
+  : AsyncWebSocket(url), _counter(counter) {
+    _mutex = xSemaphoreCreateMutex();
+}
+
+void broadcastSocket::textAll(const char* message) {
+    _counter += count();
+    AsyncWebSocket::textAll(message);
+}
+
+size_t broadcastSocket::printfAll(const char* format, ...) {
+    char buffer[64];
+    va_list args;
+    va_start(args, format);
+    const int length = vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+    if (length < 0) return 0;
+    if ((size_t)length < sizeof(buffer)) {
+        textAll(buffer);
+        return length;
+    }
+    char message[length + 1];
+    va_start(args, format);
+    vsnprintf(message, sizeof(message), format, args);
+    va_end(args);
+    textAll(message);
+    return length;
+}
+
+void broadcastSocket::publish(const broadcastTopic topic, const char* message) {
+    const uint8_t bit = 1 << topic;
+    xSemaphoreTake(_mutex, portMAX_DELAY);
+    _latest[topic] = message;
+    for (const auto& client : getClients()) {
+        if (client->status() != WS_CONNECTED) continue;
+        if (isLagging(client)) {
+            uint8_t& dirty = _dirty[client->id()];
+            if (dirty & bit) _merged++;
+            dirty |= bit;
+            _dropped++;
+            continue;
+        }
+        auto entry = _dirty.find(client->id());
+        if (entry != _dirty.end()) entry->second &= ~bit;
+        client->text(message);
+        _counter++;
+    }
+    xSemaphoreGive(_mutex);
+}
+
+/* state messages are short - longer ones should use publish() */
+void broadcastSocket::publishf(const broadcastTopic topic, const char* format, ...) {
+    char buffer[128];
+    va_list args;
+    va_start(args, format);
+    vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+    publish(topic, buffer);
+}
+
+void broadcastSocket::flush() {
+    xSemaphoreTake(_mutex, portMAX_DELAY);
+    auto entry = _dirty.begin();
+    while (entry != _dirty.end()) {
+        AsyncWebSocketClient* client = this->client(entry->first);
+        if (!client || client->status() != WS_CONNECTED || !entry->second) {
+            entry = _dirty.erase(entry);
+            continue;
+        }
+        if (isLagging(client)) {
+            ++entry;
+            continue;
+        }
+        for (uint8_t topic = 0; topic < NUMBER_OF_TOPICS; topic++) {
+            if (!(entry->second & (1 << topic))) continue;
+            client->text(_latest[topic]);
+            _counter++;
+        }
+        entry = _dirty.erase(entry);
+    }
+    xSemaphoreGive(_mutex);
+}
+
+void broadcastSocket::forget(const uint32_t id) {
+    xSemaphoreTake(_mutex, portMAX_DELAY);
+    _dirty.erase(id);
+    xSemaphoreGive(_mutex);
+}
+
+uint32_t broadcastSocket::lagging() {
+    xSemaphoreTake(_mutex, portMAX_DELAY);
+    const uint32_t count = _dirty.size();
+    xSemaphoreGive(_mutex);
+    return count;
+}
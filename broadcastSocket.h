@@ -0,0 +1,71 @@
+#ifndef __BROADCASTSOCKET_H
+#define __BROADCASTSOCKET_H
+
+#include <Arduino.h>
+#include <atomic>
+#include <map>
+#include <ESPAsyncWebServer.h>
+
+/* A websocket that knows which messages can be superseded.
+
+   Events - playlist deltas, favorites, messages - go to every client, always.
+   State - progress, stream title, current item, ... - is published per topic.
+   A client that lags behind with a long send queue does not get state messages queued.
+   The topic is marked dirty for that client and flush() sends it the newest value once its queue has drained.
+   So a slow client never receives a stale value and never has more than one value per topic waiting. */
+
+enum broadcastTopic { TOPIC_PROGRESS,
+                      TOPIC_STREAMTITLE,
+                      TOPIC_CURRENT,
+                      TOPIC_SHOWSTATION,
+                      TOPIC_STATUS,
+                      TOPIC_VOLUME,
+                      NUMBER_OF_TOPICS };
+
+class broadcastSocket : public AsyncWebSocket {
+
+  public:
+    /* a client with this many messages waiting is lagging */
+    static constexpr const size_t LAGGING_QUEUE_LENGTH = 4;
+
+    broadcastSocket(const String& url, std::atomic<uint32_t>& counter);
+
+    /* events */
+    void textAll(const char* message);
+    void textAll(const String& message) {
+        textAll(message.c_str());
+    }
+    size_t printfAll(const char* format, ...) __attribute__((format(printf, 2, 3)));
+
+    /* state */
+    void publish(const broadcastTopic topic, const char* message);
+    void publishf(const broadcastTopic topic, const char* format, ...) __attribute__((format(printf, 3, 4)));
+
+    /* sends the newest values to clients that have caught up - call this regularly */
+    void flush();
+
+    /* call when a client disconnects */
+    void forget(const uint32_t id);
+
+    uint32_t dropped() const {
+        return _dropped;
+    }
+    uint32_t merged() const {
+        return _merged;
+    }
+    uint32_t lagging();
+
+  private:
+    static bool isLagging(AsyncWebSocketClient* client) {
+        return client->queueIsFull() || client->queueLen() >= LAGGING_QUEUE_LENGTH;
+    }
+
+    std::atomic<uint32_t>& _counter;
+    SemaphoreHandle_t _mutex;
+    String _latest[NUMBER_OF_TOPICS];
+    std::map<uint32_t, uint8_t> _dirty; /* client id -> bitmask of topics */
+    uint32_t _dropped{ 0 };
+    uint32_t _merged{ 0 };
+};
+
+#endif
@@ -26,7 +26,19 @@ if(isset($_GET["folder"])){
 
   $validFiles="*.{[Mm][Pp]3,[Aa][Aa][Cc],[Oo][Gg][Gg],[Pp][Ll][Ss],[Mm]3[Uu]}";
 
-  foreach(glob($path."*",GLOB_ONLYDIR)as$filename){
+  //the listing only changes when an entry is added to or removed from the folder or one of its subfolders
+  $folders=glob($path."*",GLOB_ONLYDIR);
+  $stamp=$path.filemtime($path===''?'.':$path);
+  foreach($folders as$filename)$stamp.=filemtime($filename);
+  $etag='"'.md5($stamp).'"';
+  header('ETag: '.$etag);
+  header('Cache-Control: no-cache');
+  if(isset($_SERVER['HTTP_IF_NONE_MATCH'])&&trim($_SERVER['HTTP_IF_NONE_MATCH'])===$etag){
+    header($_SERVER["SERVER_PROTOCOL"]." 304 Not Modified",true,304);
+    die();
+  }
+
+  foreach($folders as$filename){
     echo '<div class="folderlink">';
     $pieces=explode('/',$filename);
     if(glob($filename.'/'.$validFiles,GLOB_BRACE)) {
@@ -0,0 +1,24 @@
+#ifndef __COPYTEXT_H
+#define __COPYTEXT_H
+
+#include <Arduino.h>
+
+/* Copies at most size - 1 bytes of 'from' and terminates 'to'.
+   A cut is made at a utf8 character boundary, so a title or url never ends in half a character.
+   Returns the number of bytes copied. */
+
+inline size_t copyText(char* to, const size_t size, const char* from, size_t length) {
+    if (length >= size) {
+        length = size - 1;
+        while (length && ((uint8_t)from[length] & 0xC0) == 0x80) length--;
+    }
+    memcpy(to, from, length);
+    to[length] = 0;
+    return length;
+}
+
+inline size_t copyText(char* to, const size_t size, const char* from) {
+    return copyText(to, size, from, strlen(from));
+}
+
+#endif
@@ -4,42 +4,98 @@
 #include <AsyncTCP.h>          /* https://github.com/me-no-dev/AsyncTCP */
 #include <ESPAsyncWebServer.h> /* https://github.com/me-no-dev/ESPAsyncWebServer */
 #include <ESP32_VS1053_Stream.h>
+#include <esp_sntp.h>
 
 #include "playList.h"
-#include "index_htm_gz.h"
-#include "icons.h"
+#include "webAssets.h"
 #include "system_setup.h"
+#include "scopedTimer.h"
+#include "streamMonitor.h"
+#include "metrics.h"
+#include "playerMailbox.h"
+#include "broadcastSocket.h"
+#include "favoritesLog.h"
+#include "lineStreamer.h"
+#include "lineParser.h"
+#include "assetHandler.h"
+#include "proxyCache.h"
+#include "radioBrowser.h"
+#include "playlistJournal.h"
+#include "bootStages.h"
+#include "titleHistory.h"
+#include "playlistParser.h"
 
 static const char* VERSION_STRING = "eStreamPlayer32 for VS1053 v2.0.2"
                                     "<br><br>"
                                     "Search API provided by: <a href=\"https://www.radio-browser.info/\" target=\"_blank\">radio-browser.info</a>";
 
-struct playerMessage {
-    enum playerAction { SET_VOLUME,
-                        CONNECTTOHOST,
-                        STOPSONG,
-                        SETTONE };
-    playerAction action;
-    char url[PLAYLIST_MAX_URL_LENGTH];
-    size_t value = 0;
-};
-
-static QueueHandle_t playerQueue = NULL;
+static playerMailbox mailbox;
 static playList_t playList;
+static playlistJournal journal(playList);
+static streamMonitor streamStatus;
+static favoritesLog favorites;
+static proxyCache proxy;
+static radioBrowser radio;
 static AsyncWebServer server(80);
-static AsyncWebSocket ws("/ws");
-
-static const char* FAVORITES_FOLDER = "/"; /* if this is a folder use a closing slash */
+static playerMetrics metrics;
+static bootStages boot;
+static titleHistory history;
+static broadcastSocket ws("/ws", metrics.wsMessagesOut);
+
+static const char* FAVORITES_FILE = "/favorites.log";
+static const char* PLAYLIST_JOURNAL_FILE = "/playlist.journal";
+static const char* FAVORITES_FOLDER = "/"; /* favorites of older versions - migrated at first boot */
+
+static const uint32_t LIBRARY_TTL_MS = 5 * 60 * 1000;  /* after this a folder listing is revalidated */
+static const uint32_t SEARCH_TTL_MS = 15 * 60 * 1000;  /* radio-browser sends no ETag - so this is a refetch */
+static const size_t PROXY_BUDGET_PSRAM = 1024 * 1024;  /* bytes of upstream documents to keep */
+static const size_t PROXY_BUDGET_HEAP = 32 * 1024;     /* same for boards without PSRAM */
+static const size_t PROXY_MAX_BODY_SIZE = 96 * 1024; /* a page of radio-browser json before it is compacted */
 static const char* VOLUME_HEADER = "volume";
 static const char* MESSAGE_HEADER = "message";
 static const char* CURRENT_HEADER = "currentPLitem";
+static const char* DIRECT_HANDOVER_HEADER = "directhandover";
 
 static auto _playerVolume = VS1053_INITIALVOLUME;
 static size_t _currentPosition = 0;
 static size_t _currentSize = 0;
 static bool _paused = false;
 
-constexpr const auto NUMBER_OF_PRESETS = sizeof(preset) / sizeof(source);
+/* the web server task and playerTask both use the playlist - a task holds this lock while it reads or changes it
+   the lock is recursive, so a helper can take it when its caller already has it */
+static SemaphoreHandle_t _playlistLock = NULL;
+
+/* holds _playlistLock for a scope - never around a network call, the web server would wait for it */
+class playlistGuard {
+  public:
+    playlistGuard() {
+        xSemaphoreTakeRecursive(_playlistLock, portMAX_DELAY);
+    }
+    ~playlistGuard() {
+        xSemaphoreGiveRecursive(_playlistLock);
+    }
+};
+
+#define MAX_STATION_NAME_LENGTH 200
+static char showstation[MAX_STATION_NAME_LENGTH];
+#define MAX_METADATA_LENGTH 255
+static char streamtitle[MAX_METADATA_LENGTH];
+static uint32_t _streamtitleHash = 0; /* of the last broadcast - a repeated title is not sent again */
+
+/* direct handover - when a library file reaches eof and the next item is also a library file,
+   playerTask connects to the next file itself instead of queueing a connect in the mailbox.
+   The connection is still opened after eof and nothing is prebuffered - ESP32_VS1053_Stream owns its one connection
+   and has no way to open a second one early - so the gap is not removed, it is only measured for both paths. */
+
+struct handoverTimes {
+    uint32_t count = 0;
+    uint32_t totalMs = 0;
+};
+
+static handoverTimes _directHandovers;
+static handoverTimes _queuedHandovers;
+static bool _handoverPending = false;
+static unsigned long _eofTime = 0;
 
 //****************************************************************************************
 //                                   P L A Y E R _ T A S K                               *
@@ -47,6 +103,7 @@ constexpr const auto NUMBER_OF_PRESETS = sizeof(preset) / sizeof(source);
 
 void playerTask(void* parameter) {
     log_i("Starting VS1053 codec...");
+    boot.start(bootStages::CODEC);
 
     SPI.begin();
 
@@ -57,28 +114,43 @@ void playerTask(void* parameter) {
         while (true) delay(100);
     }
 
+    boot.done(bootStages::CODEC);
     log_i("Ready to rock!");
+    uint32_t waitMs = 25;
     while (true) {
-        playerMessage msg;
-        if (xQueueReceive(playerQueue, &msg, pdMS_TO_TICKS(25)) == pdPASS) {
+        playerMailbox::mail mail;
+        const bool received = mailbox.take(mail, pdMS_TO_TICKS(waitMs));
+        const unsigned long loopStart = micros();
+        if (received) {
+            metrics.mailboxWait.observe(millis() - mail.posted);
             log_d("Minimum free stack bytes: %i", uxTaskGetStackHighWaterMark(NULL));
-            switch (msg.action) {
-                case playerMessage::SET_VOLUME:
-                    audio.setVolume(msg.value);
+            if (mail.hasVolume)
+                audio.setVolume(mail.volume);
+            if (mail.hasTone)
+                audio.setTone(mail.tone);
+            switch (mail.transport) {
+                case playerMailbox::CONNECT:
+                    {
+                        audio.stopSong();
+                        _paused = false;
+                        ws.publish(TOPIC_STATUS, "status\nplaying\n");
+                        char stream[PLAYLIST_MAX_URL_LENGTH];
+                        const char* url = playlistParser::isPlaylist(mail.url) ? openPlaylistFile(mail.url, stream, sizeof(stream)) : mail.url;
+                        if (!url) break;
+                        streamStatus.reset(url);
+                        /* a new connection for every track and seek - ESP32_VS1053_Stream owns it and takes no client from the proxy pool */
+                        if (!audio.connecttohost(url, LIBRARY_USER, LIBRARY_PWD, mail.offset))
+                            startNextItem();
+                        _currentSize = audio.size();
+                        _currentPosition = audio.position();
+                        if (_eofTime) reportHandover(false, millis() - _eofTime);
+                    }
                     break;
-                case playerMessage::CONNECTTOHOST:
+                case playerMailbox::STOP:
                     audio.stopSong();
-                    _paused = false;
-                    ws.textAll("status\nplaying\n");
-                    if (!audio.connecttohost(msg.url, LIBRARY_USER, LIBRARY_PWD, msg.value))
-                        startNextItem();
-                    _currentSize = audio.size();
-                    _currentPosition = audio.position();
+                    streamStatus.reset("");
                     break;
-                case playerMessage::STOPSONG:
-                    audio.stopSong();
-                    break;
-                default: log_e("error: unhandled audio action: %i", msg.action);
+                default: break;
             }
         }
 
@@ -87,13 +159,75 @@ void playerTask(void* parameter) {
         static unsigned long previousTime = millis();
         static size_t previousPosition = 0;
         if (ws.count() && audio.size() && millis() - previousTime > UPDATE_INTERVAL_MS && audio.position() != previousPosition) {
-            ws.printfAll("progress\n%i\n%i\n", audio.position(), audio.size());
+            ws.publishf(TOPIC_PROGRESS, "progress\n%i\n%i\n", audio.position(), audio.size());
             previousTime = millis();
             previousPosition = audio.position();
             _currentPosition = audio.position();
         }
+        if (audio.size()) {
+            playlistGuard guard;
+            journal.position(playList.currentItem(), audio.position()); /* rate limited */
+        }
         audio.loop();
+        ws.flush();
+
+        size_t used, capacity;
+        audio.bufferStatus(used, capacity);
+        const bool streaming = audio.isRunning() && (!audio.size() || audio.position() < audio.size());
+        waitMs = streamStatus.update(audio.position(), used, capacity, streaming);
+        if (streamStatus.decodedBytes()) boot.done(bootStages::FIRST_AUDIO);
+
+        if (_handoverPending) {
+            _handoverPending = false;
+            handOverToNextItem(audio);
+        }
+
+        metrics.loopTime.observe(micros() - loopStart);
+    }
+}
+
+void handOverToNextItem(ESP32_VS1053_Stream& audio) {
+    char url[PLAYLIST_MAX_URL_LENGTH];
+    {
+        playlistGuard guard;
+        const uint32_t next = playList.currentItem() + 1;
+        /* the playlist can have changed since eof */
+        if (playList.currentItem() == PLAYLIST_STOPPED) {
+            _eofTime = 0;
+            return;
+        }
+        if (next >= (uint32_t)playList.size()) {
+            _eofTime = 0;
+            playlistHasEnded();
+            return;
+        }
+        playList.setCurrentItem(next);
+        playList.url(next, url, sizeof(url));
+        if (playlistParser::isPlaylist(url)) {
+            /* not audio - opened by a queued connect */
+            _eofTime = 0;
+            mailbox.connect(url);
+            return;
+        }
+        announceItem(next);
+    }
+    streamStatus.reset(url);
+    if (!audio.connecttohost(url, LIBRARY_USER, LIBRARY_PWD)) {
+        _eofTime = 0;
+        startNextItem();
+        return;
     }
+    _currentSize = audio.size();
+    _currentPosition = audio.position();
+    reportHandover(true, millis() - _eofTime);
+}
+
+void reportHandover(const bool direct, const uint32_t ms) {
+    _eofTime = 0;
+    handoverTimes& times = direct ? _directHandovers : _queuedHandovers;
+    times.count++;
+    times.totalMs += ms;
+    log_i("%s handover took %i ms - eof to connected", direct ? "Direct" : "Queued", ms);
 }
 
 //****************************************************************************************
@@ -101,50 +235,40 @@ void playerTask(void* parameter) {
 //****************************************************************************************
 
 inline __attribute__((always_inline)) void updateCurrentItemOnClients() {
-    ws.printfAll("%s\n%i\n", CURRENT_HEADER, playList.currentItem());
+    ws.publishf(TOPIC_CURRENT, "%s\n%i\n", CURRENT_HEADER, playList.currentItem());
+    journal.current(playList.currentItem());
 }
 
-void startItem(uint8_t const index, size_t offset = 0) {
-    updateCurrentItemOnClients();
-    audio_showstreamtitle("");
+void startItem(const uint32_t index, size_t offset = 0) {
+    playlistGuard guard;
+    playListView item;
+    playList.view(index, item);
+    mailbox.connect(item, offset);
 
-    playerMessage msg;
-    msg.action = playerMessage::CONNECTTOHOST;
-    msg.value = offset;
-    snprintf(msg.url, sizeof(msg.url), "%s", playList.url(index).c_str());
-    xQueueSend(playerQueue, &msg, portMAX_DELAY);
+    announceItem(index);
+}
 
-    playListItem item;
-    playList.get(index, item);
-    switch (item.type) {
-        case HTTP_FILE:
-            {
-                {
-                    char name[item.url.length() - item.url.lastIndexOf('/')];
-                    auto pos = item.url.lastIndexOf('/') + 1;
-                    auto cnt = 0;
-                    while (pos < item.url.length())
-                        name[cnt++] = item.url.charAt(pos++);
-                    name[cnt] = 0;
-                    audio_showstation(name);
-                }
-                char path[item.url.lastIndexOf('/') + 1];
-                auto pos = 0;
-                auto cnt = 0;
-                while (pos < item.url.lastIndexOf('/'))
-                    path[cnt++] = item.url.charAt(pos++);
-                path[pos] = 0;
-                audio_showstreamtitle(path);
-            }
-            break;
-        case HTTP_PRESET:
-            audio_showstation(preset[item.index].name.c_str());
-            break;
-        default: audio_showstation(item.name.c_str());
-    }
+/* a library file shows its file name as station and its folder as title */
+void announceItem(const uint32_t index) {
+    playlistGuard guard;
+    updateCurrentItemOnClients();
+    showStreamTitle("", 0);
+
+    playListView item;
+    playList.view(index, item);
+    showStation(item.name.data, item.name.length);
+    if (item.type != HTTP_FILE || !item.prefix.length) return;
+    const size_t folderLength = item.prefix.length - 1;
+    showStreamTitle(item.prefix.data, folderLength);
+
+    /* the history shows the file under the name of its folder */
+    size_t folderStart = folderLength;
+    while (folderStart && item.prefix.data[folderStart - 1] != '/') folderStart--;
+    history.add(HTTP_FILE, item.prefix.data + folderStart, folderLength - folderStart, item.name.data, item.name.length);
 }
 
 void startNextItem() {
+    playlistGuard guard;
     if (playList.currentItem() < playList.size() - 1) {
         playList.setCurrentItem(playList.currentItem() + 1);
         startItem(playList.currentItem());
@@ -153,57 +277,272 @@ void startNextItem() {
     }
 }
 
+/* A playlist file is not audio - called by playerTask before it connects.
+   A library playlist is replaced by its entries and the first entry is started, any other playlist plays its first stream.
+   Returns the url to connect to or nullptr when there is nothing to connect to right now. */
+const char* openPlaylistFile(const char* url, char* stream, const size_t size) {
+    bool library;
+    {
+        playlistGuard guard;
+        const int32_t index = playList.currentItem();
+        library = index != PLAYLIST_STOPPED && index < playList.size() && playList.type(index) == HTTP_FILE;
+    }
+    if (library) {
+        expandPlaylistFile(url);
+        return nullptr;
+    }
+    stream[0] = 0;
+    playlistParser::fetch(url, "", "", [stream, size](const char* entry, const char*) {
+        if (playlistParser::isPlaylist(entry)) return true;
+        snprintf(stream, size, "%s", entry);
+        return false;
+    });
+    if (stream[0]) return stream;
+    log_w("No stream found in '%s'", url);
+    startNextItem();
+    return nullptr;
+}
+
+/* The entries are read into a list of their own without the lock - the web server keeps running while the file is read.
+   Entries on the library server become library files, others are added as found streams. Nested playlists are skipped.
+   The entries take the place of the playlist file, which is removed - unless the playlist is too full to take any. */
+void expandPlaylistFile(const char* url) {
+    const char* scheme = strstr(url, "://");
+    const size_t originLength = scheme ? (scheme + 3 - url) + strcspn(scheme + 3, "/") : 0;
+    uint32_t room;
+    {
+        playlistGuard guard;
+        room = playList.maxItems() - playList.size() + 1;
+    }
+    std::unique_ptr<playList_t> entries(new playList_t);
+    bool filled = false;
+    playlistParser::fetch(url, LIBRARY_USER, LIBRARY_PWD, [&](const char* entry, const char* title) {
+        if (playlistParser::isPlaylist(entry)) return true;
+        const bool library = originLength && !strncmp(entry, url, originLength) && entry[originLength] == '/';
+        filled = !entries->add({ library ? HTTP_FILE : HTTP_FOUND, title[0] ? title : entry, entry, 0 })
+                 || (uint32_t)entries->size() >= room;
+        return !filled;
+    });
+
+    xSemaphoreTakeRecursive(_playlistLock, portMAX_DELAY);
+    const int32_t index = playList.currentItem();
+    char current[PLAYLIST_MAX_URL_LENGTH];
+    if (index == PLAYLIST_STOPPED || !playList.url(index, current, sizeof(current)) || strcmp(current, url)) {
+        xSemaphoreGiveRecursive(_playlistLock);
+        log_i("Playlist changed while '%s' was read", url);
+        return;
+    }
+    if (!entries->size()) {
+        xSemaphoreGiveRecursive(_playlistLock);
+        log_w("No entries found in '%s'", url);
+        startNextItem();
+        return;
+    }
+    const uint32_t first = playList.size();
+    for (uint32_t i = 0; i < (uint32_t)entries->size(); i++) {
+        char entryUrl[PLAYLIST_MAX_URL_LENGTH];
+        char name[PLAYLIST_MAX_URL_LENGTH];
+        entries->url(i, entryUrl, sizeof(entryUrl));
+        entries->name(i, name, sizeof(name));
+        if (!playList.add({ entries->type(i), name, entryUrl, 0 })) break;
+    }
+    const uint32_t added = playList.size() - first;
+    if (added < (uint32_t)entries->size())
+        log_w("Playlist is full - dropped %u entries of '%s'", entries->size() - added, url);
+    else if (filled)
+        log_w("Playlist is full - '%s' was not read to the end", url);
+    if (!added) {
+        xSemaphoreGiveRecursive(_playlistLock);
+        ws.printfAll("%s\nPlaylist full - could not add the entries of '%s'", MESSAGE_HEADER, url);
+        startNextItem();
+        return;
+    }
+    playList.moveTail(added, index + 1);
+    playlistInsertOnClients(index + 1, added);
+    playList.remove(index);
+    playList.setCurrentItem(index);
+    playlistRemoveOnClients(index);
+    log_i("'%s' replaced by %u entries", url, added);
+    startItem(index);
+    xSemaphoreGiveRecursive(_playlistLock);
+}
+
 void playlistHasEnded() {
+    playlistGuard guard;
     audio_showstation("Nothing playing");
-    audio_showstreamtitle(VERSION_STRING);
+    showStreamTitle(VERSION_STRING, strlen(VERSION_STRING));
     playList.setCurrentItem(PLAYLIST_STOPPED);
     updateCurrentItemOnClients();
 }
 
-void upDatePlaylistOnClients() {
+/* playlist changes are sent to the clients as numbered deltas
+   a client that misses a delta requests a full playlist with 'playlistsync' */
+
+static uint32_t _playlistSequence = 0;
+
+static inline __attribute__((always_inline)) void deltaHeader(String& s, const char* op) {
+    s = "pldelta\n";
+    s.concat(++_playlistSequence);
+    s.concat("\n");
+    s.concat(op);
+    s.concat("\n");
+}
+
+/* connect snapshot - one frame with the sections a (re)connecting client needs, separated by SNAPSHOT_SEPARATOR
+   the playlist and favorites sections are cached and only rebuilt after they changed
+   a client that sends the epoch and versions it has seen gets only the sections that changed */
+
+static const char SNAPSHOT_SEPARATOR = '\x1e'; /* ascii record separator */
+static uint32_t _snapshotEpoch = 0;             /* set at boot - versions of an earlier boot are meaningless */
+
+struct snapshotSection {
+    String text;
+    uint32_t version = UINT32_MAX;
+};
+static snapshotSection _playlistSection;
+static snapshotSection _favoritesSection;
+
+const String& playlistSection() {
+    if (_playlistSection.version != _playlistSequence) {
+        playList.toString(_playlistSection.text, _playlistSequence);
+        _playlistSection.version = _playlistSequence;
+    }
+    return _playlistSection.text;
+}
+
+const String& favoritesSection() {
+    if (_favoritesSection.version != favorites.version()) {
+        favorites.toString(_favoritesSection.text);
+        _favoritesSection.version = favorites.version();
+    }
+    return _favoritesSection.text;
+}
+
+void snapshotToClient(AsyncWebSocketClient* client, const uint32_t epoch, const uint32_t playlistVersion, const uint32_t favoritesVersion) {
+    scopedTimer timer("connect snapshot");
+    const bool sameBoot = epoch == _snapshotEpoch;
+    char line[48];
+    snprintf(line, sizeof(line), "snapshot\n%u\n", _snapshotEpoch);
+    String s(line);
+
+    if (!sameBoot || playlistVersion != _playlistSequence) {
+        s.concat(SNAPSHOT_SEPARATOR);
+        s.concat(playlistSection());
+    }
+    if (!sameBoot || favoritesVersion != favorites.version()) {
+        s.concat(SNAPSHOT_SEPARATOR);
+        s.concat(favoritesSection());
+    }
+
+    snprintf(line, sizeof(line), "%cstatus\n%s\n", SNAPSHOT_SEPARATOR, _paused ? "paused" : "playing");
+    s.concat(line);
+    snprintf(line, sizeof(line), "%c%s\n%i\n", SNAPSHOT_SEPARATOR, CURRENT_HEADER, playList.currentItem());
+    s.concat(line);
+    snprintf(line, sizeof(line), "%c%s\n%i\n", SNAPSHOT_SEPARATOR, VOLUME_HEADER, _playerVolume);
+    s.concat(line);
+    snprintf(line, sizeof(line), "%c%s\n%i\n", SNAPSHOT_SEPARATOR, DIRECT_HANDOVER_HEADER, playList.directHandover());
+    s.concat(line);
+    s.concat(SNAPSHOT_SEPARATOR);
+    s.concat(showstation);
+    s.concat(SNAPSHOT_SEPARATOR);
+    s.concat(streamtitle);
+    if (_paused && _currentSize) {
+        snprintf(line, sizeof(line), "%cprogress\n%i\n%i\n", SNAPSHOT_SEPARATOR, _currentPosition, _currentSize);
+        s.concat(line);
+    }
+    client->text(s);
+}
+
+void playlistToClient(AsyncWebSocketClient* client) {
+    client->text(playlistSection());
+}
+
+/* plwindow\n<sequence>\n<first>\n followed by the items - the client drops a window of an older sequence */
+void playlistWindowToClient(AsyncWebSocketClient* client, const uint32_t first, const uint32_t count) {
+    String s("plwindow\n");
+    s.concat(_playlistSequence);
+    s.concat("\n");
+    s.concat(first);
+    s.concat("\n");
+    client->text(playList.itemsToString(s, first, min(count, (uint32_t)PLAYLIST_WINDOW)));
+}
+
+void playlistInsertOnClients(const uint32_t first, const uint32_t count) {
+    {
+        scopedTimer timer("playlist insert broadcast");
+        String s;
+        journal.added(first, count);
+        deltaHeader(s, "insert");
+        s.concat(first);
+        s.concat("\n");
+        s.concat(count);
+        s.concat("\n");
+        /* a big insert only sends its size - the clients fetch the items they show */
+        if (count <= PLAYLIST_WINDOW) playList.itemsToString(s, first, count);
+        ws.textAll(s);
+    }
+    updateCurrentItemOnClients();
+}
+
+void playlistRemoveOnClients(const uint32_t index) {
     {
         String s;
-        ws.textAll(playList.toString(s));
+        journal.removed(index);
+        deltaHeader(s, "remove");
+        s.concat(index);
+        s.concat("\n");
+        ws.textAll(s);
     }
     updateCurrentItemOnClients();
 }
 
-bool saveItemToFavorites(AsyncWebSocketClient* client, const char* filename, const playListItem& item) {
+void playlistMoveOnClients(const uint32_t from, const uint32_t to) {
+    {
+        String s;
+        journal.moved(from, to);
+        deltaHeader(s, "move");
+        s.concat(from);
+        s.concat("\n");
+        s.concat(to);
+        s.concat("\n");
+        ws.textAll(s);
+    }
+    updateCurrentItemOnClients();
+}
+
+void playlistClearOnClients() {
+    {
+        String s;
+        journal.cleared();
+        deltaHeader(s, "clear");
+        ws.textAll(s);
+    }
+    updateCurrentItemOnClients();
+}
+
+bool saveItemToFavorites(AsyncWebSocketClient* client, const char* filename, const uint32_t index) {
     if (!strlen(filename)) {
         log_e("ERROR! no filename");
         return false;
     }
-    switch (item.type) {
+    char url[PLAYLIST_MAX_URL_LENGTH];
+    playList.url(index, url, sizeof(url));
+    switch (playList.type(index)) {
         case HTTP_FILE:
-            log_d("file (wont save)%s", item.url.c_str());
+            log_d("file (wont save)%s", url);
             return false;
         case HTTP_PRESET:
-            log_d("preset (wont save) %s %s", preset[item.index].name.c_str(), preset[item.index].url.c_str());
+            log_d("preset (wont save) %s", url);
             return false;
         case HTTP_FOUND:
         case HTTP_FAVORITE:
-            {
-                char path[strlen(FAVORITES_FOLDER) + strlen(filename) + 1];
-                snprintf(path, sizeof(path), "%s%s", FAVORITES_FOLDER, filename);
-                File file = FFat.open(path, FILE_WRITE);
-                if (!file) {
-                    log_e("failed to open '%s' for writing", filename);
-                    client->printf("%s\nERROR: Could not open '%s' for writing!", MESSAGE_HEADER, filename);
-                    return false;
-                }
-                char url[item.url.length() + 2];
-                snprintf(url, sizeof(url), "%s\n", item.url.c_str());
-                const auto bytesWritten = file.print(url);
-                file.close();
-                if (bytesWritten < strlen(url)) {
-                    log_e("ERROR! Saving '%s' failed - disk full?", filename);
-                    client->printf("%s\nERROR: Could not completely save '%s' to favorites!", MESSAGE_HEADER, filename);
-                    return false;
-                }
-                client->printf("%s\nSaved '%s' to favorites!", MESSAGE_HEADER, filename);
-                return true;
+            if (!favorites.add(filename, url)) {
+                log_e("ERROR! Saving '%s' failed - disk full?", filename);
+                client->printf("%s\nERROR: Could not save '%s' to favorites!", MESSAGE_HEADER, filename);
+                return false;
             }
-            break;
+            client->printf("%s\nSaved '%s' to favorites!", MESSAGE_HEADER, filename);
+            return true;
         default:
             {
                 log_w("Unhandled item.type.");
@@ -212,31 +551,20 @@ bool saveItemToFavorites(AsyncWebSocketClient* client, const char* filename, con
     }
 }
 
-void handleFavoriteToPlaylist(AsyncWebSocketClient* client, const char* filename, const bool startNow) {
-    if (PLAYLIST_MAX_ITEMS == playList.size()) {
-        log_e("ERROR! Could not add %s to playlist", filename);
+/* true when the favorite was added */
+bool handleFavoriteToPlaylist(AsyncWebSocketClient* client, const char* filename, const bool startNow) {
+    char url[PLAYLIST_MAX_URL_LENGTH];
+    if (!favorites.url(filename, url, sizeof(url))) {
+        log_e("ERROR! Could not find favorite %s", filename);
         client->printf("%s\nCould not add '%s' to playlist", MESSAGE_HEADER, filename);
-        return;
+        return false;
     }
-    char path[strlen(FAVORITES_FOLDER) + strlen(filename) + 1];
-    snprintf(path, sizeof(path), "%s%s", FAVORITES_FOLDER, filename);
-    File file = FFat.open(path);
-    if (!file) {
-        log_e("ERROR! Could not open %s", filename);
+    const auto previousSize = playList.size();
+    if (!playList.add({ HTTP_FAVORITE, filename, url, 0 })) {
+        log_e("ERROR! Could not add %s to playlist", filename);
         client->printf("%s\nCould not add '%s' to playlist", MESSAGE_HEADER, filename);
-        return;
-    }
-    char url[file.size() + 1];
-    auto cnt = 0;
-    char ch = (char)file.read();
-    while (ch != '\n' && file.available()) {
-        url[cnt++] = ch;
-        ch = (char)file.read();
+        return false;
     }
-    url[cnt] = 0;
-    file.close();
-    const auto previousSize = playList.size();
-    playList.add({ HTTP_FAVORITE, filename, url, 0 });
 
     log_d("favorite to playlist: %s -> %s", filename, url);
     client->printf("%s\nAdded '%s' to playlist", MESSAGE_HEADER, filename);
@@ -245,64 +573,124 @@ void handleFavoriteToPlaylist(AsyncWebSocketClient* client, const char* filename
         playList.setCurrentItem(previousSize);
         startItem(playList.currentItem());
     }
+    return true;
 }
 
-const String& favoritesToString(String& s) {
-    s = "favorites\n";
-    File folder = FFat.open(FAVORITES_FOLDER);
-    if (!folder) {
-        log_e("ERROR! Could not open favorites folder");
-        return s;
-    }
-    File file = folder.openNextFile();
-    while (file) {
-        if (!file.isDirectory() && file.size() < PLAYLIST_MAX_URL_LENGTH) {
-            s.concat(file.name());
-            s.concat("\n");
-        }
-        file = folder.openNextFile();
-    }
-    return s;
-}
-
-const String& favoritesToCStruct(String& s) {
-    File folder = FFat.open(FAVORITES_FOLDER);
-    if (!folder) {
-        s = "ERROR! Could not open folder " + String(FAVORITES_FOLDER);
-        return s;
-    }
-    s = "const source preset[] = {\n";
-    File file = folder.openNextFile();
-    while (file) {
-        if (!file.isDirectory() && file.size() < PLAYLIST_MAX_URL_LENGTH) {
-            s.concat("    {\"");
-            s.concat(file.name());
-            s.concat("\", \"");
-            char ch = (char)file.read();
-            while (file.available() && ch != '\n') {
-                s.concat(ch);
-                ch = (char)file.read();
-            }
-            s.concat("\"},\n");
-        }
-        file = folder.openNextFile();
-    }
-    s.concat("};\n");
-    return s;
+/* line generators for lineStreamer - 'index' 0 is the header line */
+
+int favoritesToCStruct(const size_t index, char* line, const size_t size) {
+    if (!index) return snprintf(line, size, "constexpr source preset[]{\n");
+    if (index - 1 == favorites.size()) return snprintf(line, size, "};\n");
+    if (index - 1 > favorites.size()) return -1;
+    char url[PLAYLIST_MAX_URL_LENGTH];
+    favorites.urlAt(index - 1, url, sizeof(url));
+    return snprintf(line, size, "    {\"%s\", \"%s\"},\n", favorites.name(index - 1), url);
+}
+
+int playlistToM3U(const size_t index, char* line, const size_t size) {
+    if (!index) return snprintf(line, size, "#EXTM3U\n");
+    playlistGuard guard;
+    if (index - 1 >= (size_t)playList.size()) return -1;
+    playListView item;
+    playList.view(index - 1, item);
+    return snprintf(line, size, "#EXTINF:-1,%.*s\n%.*s%.*s\n", (int)item.name.length, item.name.data,
+                    (int)item.prefix.length, item.prefix.data, (int)item.rest.length, item.rest.data);
 }
 
 //****************************************************************************************
 //                                   S E T U P                                           *
 //****************************************************************************************
 
-const char* HEADER_MODIFIED_SINCE = "If-Modified-Since";
+static assetHandler assets(WEB_ASSETS, WEB_ASSETS_SEED);
+
+/* /scripturl and /stations only change with the firmware - a hash of the build time is their ETag */
+static char _buildEtag[11];
+
+static inline __attribute__((always_inline)) bool buildUnmodified(const AsyncWebServerRequest* request) {
+    return request->hasHeader("If-None-Match") && request->header("If-None-Match").equals(_buildEtag);
+}
+
+static void ntpSynced(struct timeval*) {
+    boot.done(bootStages::NTP);
+}
 
-static inline __attribute__((always_inline)) bool htmlUnmodified(const AsyncWebServerRequest* request, const char* date) {
-    return request->hasHeader(HEADER_MODIFIED_SINCE) && request->header(HEADER_MODIFIED_SINCE).equals(date);
+/* the library listing of 'folder' on the music server - SCRIPT_URL?folder=<folder> */
+static String libraryListingUrl(const String& folder) {
+    String url(SCRIPT_URL);
+    url.concat("?folder=");
+    proxyCache::appendEncoded(url, folder.c_str());
+    return url;
+}
+
+/* a chunked response that holds back its status line until the fetch is done - async_tcp polls _ack() meanwhile
+   a failed fetch is answered with 502 so the page sees an error */
+class proxiedFetchResponse : public AsyncChunkedResponse {
+  public:
+    proxiedFetchResponse(const char* mimeType, std::shared_ptr<proxyFetch> job, AwsResponseFiller filler)
+      : AsyncChunkedResponse(mimeType, filler), _job(job) {}
+
+    void _respond(AsyncWebServerRequest* request) override {
+        const proxyFetch::fetchState state = _job->state.load();
+        if (state == proxyFetch::PENDING) return;
+        if (state == proxyFetch::FAILED) setCode(502);
+        /* the same ETag as a hit - so the next request for it can be answered with 304 */
+        if (state == proxyFetch::DONE) addHeader("ETag", _job->entry->etag);
+        AsyncChunkedResponse::_respond(request);
+    }
+    size_t _ack(AsyncWebServerRequest* request, size_t len, uint32_t time) override {
+        if (_state == RESPONSE_SETUP) {
+            _respond(request);
+            return 0;
+        }
+        return AsyncChunkedResponse::_ack(request, len, time);
+    }
+
+  private:
+    std::shared_ptr<proxyFetch> _job;
+};
+
+/* a response from the proxy cache - a miss is answered when the worker has fetched 'url' */
+static AsyncWebServerResponse* proxiedResponse(AsyncWebServerRequest* request, const String& key, const String& url, const uint32_t ttl, const char* mimeType,
+                                               const proxyFilter filter = nullptr, const char* user = "", const char* password = "") {
+    static const char* HEADER_CACHE_CONTROL = "Cache-Control";
+    static const char* REVALIDATE = "no-cache";
+
+    std::shared_ptr<proxyEntry> entry = proxy.fresh(key, ttl);
+    if (entry) {
+        AsyncWebServerResponse* response;
+        if (request->hasHeader("If-None-Match") && request->header("If-None-Match").equals(entry->etag))
+            response = request->beginResponse(304);
+        else
+            response = request->beginResponse(mimeType, entry->length, [entry](uint8_t* buffer, size_t maxLen, size_t index) -> size_t {
+                const size_t length = min(maxLen, entry->length - index);
+                memcpy(buffer, entry->body + index, length);
+                return length;
+            });
+        response->addHeader("ETag", entry->etag);
+        response->addHeader(HEADER_CACHE_CONTROL, REVALIDATE);
+        return response;
+    }
+
+    std::shared_ptr<proxyFetch> job = proxy.fetch(key, url, filter, user, password);
+    AsyncWebServerResponse* const response = new proxiedFetchResponse(mimeType, job, [job](uint8_t* buffer, size_t maxLen, size_t index) -> size_t {
+        switch (job->state.load()) {
+            case proxyFetch::PENDING:
+                return RESPONSE_TRY_AGAIN;
+            case proxyFetch::FAILED:
+                return index ? 0 : snprintf((char*)buffer, maxLen, "Upstream error %i\n", job->httpCode);
+            default:
+                const size_t length = min(maxLen, job->entry->length - index);
+                memcpy(buffer, job->entry->body + index, length);
+                return length;
+        }
+    });
+    response->addHeader(HEADER_CACHE_CONTROL, REVALIDATE);
+    return response;
 }
 
 void setup() {
     log_i("\n\n\t\t\t\t%s\n", VERSION_STRING);
+    _snapshotEpoch = esp_random();
 
     const uint32_t idf = ESP_IDF_VERSION_PATCH + ESP_IDF_VERSION_MINOR *10 + ESP_IDF_VERSION_MAJOR * 100;
     const uint32_t ard = ESP_ARDUINO_VERSION_PATCH + ESP_ARDUINO_VERSION_MINOR * 10 + ESP_ARDUINO_VERSION_MAJOR * 100;
@@ -322,21 +710,10 @@ void setup() {
         while (true) delay(1000); /* system is halted */
     }
 
-    /* partition is defined - try to mount it */
-    if (FFat.begin(0, "", 2))  // see: https://github.com/lorol/arduino-esp32fs-plugin#notes-for-fatfs
-        log_i("FFat mounted");
-
-    /* partition is present, but does not mount so now we just format it */
-    else {
-        log_i("Formatting FFat...");
-        if (!FFat.format(true, (char*)"ffat") || !FFat.begin(0, "", 2)) {
-            log_e("FFat error while formatting. Halting.");
-            while (true) delay(1000); /* system is halted */
-        }
-    }
-
+    /* the stages that do not need each other start right away - wifi connects in the background */
     btStop();
 
+    boot.start(bootStages::WIFI);
     if (SET_STATIC_IP && !WiFi.config(STATIC_IP, GATEWAY, SUBNET, PRIMARY_DNS, SECONDARY_DNS)) {
         log_e("Setting static IP failed");
     }
@@ -344,170 +721,157 @@ void setup() {
     WiFi.setSleep(false);
     log_i("Connecting to %s...", SSID);
 
-    playerQueue = xQueueCreate(5, sizeof(struct playerMessage));
+    if (!history.begin())
+        log_e("ERROR! Title history could not be started");
 
-    if (!playerQueue) {
-        log_e("Could not create queue. System halted.");
+    _playlistLock = xSemaphoreCreateRecursiveMutex();
+    if (!_playlistLock) {
+        log_e("ERROR! Could not create the playlist lock. System halted.");
         while (true) delay(100);
     }
 
-    WiFi.waitForConnectResult();
+    mailbox.setVolume(VS1053_INITIALVOLUME);
 
-    if (!WiFi.isConnected()) {
-        log_e("Could not connect to Wifi! System halted! Check 'system_setup.h'!");
-        while (true) delay(1000); /* system is halted */
-    }
+    const BaseType_t result = xTaskCreatePinnedToCore(
+        playerTask,            /* Function to implement the task */
+        "playerTask",          /* Name of the task */
+        8000,                  /* Stack size in BYTES! */
+        NULL,                  /* Task input parameter */
+        3 | portPRIVILEGE_BIT, /* Priority of the task */
+        NULL,                  /* Task handle. */
+        1                      /* Core where the task should run */
+    );
 
-    log_i("WiFi connected - IP %s", WiFi.localIP().toString().c_str());
+    if (result != pdPASS) {
+        log_e("ERROR! Could not create playerTask. System halted.");
+        while (true) delay(100);
+    }
 
-    configTzTime(TIMEZONE, NTP_POOL);
+    boot.start(bootStages::FFAT);
 
-    struct tm timeinfo {};
+    /* partition is defined - try to mount it */
+    if (FFat.begin(0, "", 2))  // see: https://github.com/lorol/arduino-esp32fs-plugin#notes-for-fatfs
+        log_i("FFat mounted");
 
-    log_i("Waiting for NTP sync...");
+    /* partition is present, but does not mount so now we just format it */
+    else {
+        log_i("Formatting FFat...");
+        if (!FFat.format(true, (char*)"ffat") || !FFat.begin(0, "", 2)) {
+            log_e("FFat error while formatting. Halting.");
+            while (true) delay(1000); /* system is halted */
+        }
+    }
+    boot.done(bootStages::FFAT);
 
-    while (!getLocalTime(&timeinfo, 0))
-        delay(10);
+    boot.start(bootStages::PLAYLIST);
+    if (!favorites.begin(FAVORITES_FILE, FAVORITES_FOLDER, PLAYLIST_JOURNAL_FILE))
+        log_e("ERROR! Favorites could not be loaded");
 
-    log_i("Synced");
+    if (!journal.begin(PLAYLIST_JOURNAL_FILE, _playlistLock))
+        log_e("ERROR! Playlist could not be restored");
+    boot.done(bootStages::PLAYLIST);
 
     //****************************************************************************************
     //                                   W E B S E R V E R                                   *
     //****************************************************************************************
 
-    time_t bootTime;
-    time(&bootTime);
-    static char modifiedDate[30];
-    strftime(modifiedDate, sizeof(modifiedDate), "%a, %d %b %Y %X GMT", gmtime(&bootTime));
+    boot.start(bootStages::WEBSERVER);
+
+    snprintf(_buildEtag, sizeof(_buildEtag), "\"%08x\"", assetHandler::pathHash(__DATE__ " " __TIME__, 2166136261u));
 
     static const char* HTML_MIMETYPE{ "text/html" };
-    static const char* HEADER_LASTMODIFIED{ "Last-Modified" };
-    static const char* HEADER_CONTENT_ENCODING{ "Content-Encoding" };
-    static const char* GZIP_CONTENT_ENCODING{ "gzip" };
-
-    server.on("/", HTTP_GET, [](AsyncWebServerRequest* request) {
-        if (htmlUnmodified(request, modifiedDate)) return request->send(304);
-        AsyncWebServerResponse* const response = request->beginResponse_P(200, HTML_MIMETYPE, index_htm_gz, index_htm_gz_len);
-        response->addHeader(HEADER_LASTMODIFIED, modifiedDate);
-        response->addHeader(HEADER_CONTENT_ENCODING, GZIP_CONTENT_ENCODING);
-        request->send(response);
-    });
+    static const char* HEADER_CACHE_CONTROL{ "Cache-Control" };
+    static const char* REVALIDATE{ "no-cache" };
 
     server.on("/scripturl", HTTP_GET, [](AsyncWebServerRequest* request) {
-        if (htmlUnmodified(request, modifiedDate)) return request->send(304);
+        if (buildUnmodified(request)) return request->send(304);
         AsyncResponseStream* const response = request->beginResponseStream(HTML_MIMETYPE);
-        response->addHeader(HEADER_LASTMODIFIED, modifiedDate);
-        response->println(SCRIPT_URL);
-        if (strlen(LIBRARY_USER) || strlen(LIBRARY_PWD)) {
-            response->println(LIBRARY_USER);
-            response->println(LIBRARY_PWD);
-        }
-        request->send(response);
-    });
-
-    server.on("/stations", HTTP_GET, [](AsyncWebServerRequest* request) {
-        if (htmlUnmodified(request, modifiedDate)) return request->send(304);
-        AsyncResponseStream* const response = request->beginResponseStream(HTML_MIMETYPE);
-        response->addHeader(HEADER_LASTMODIFIED, modifiedDate);
-        auto i = 0;
-        while (i < NUMBER_OF_PRESETS)
-            response->printf("%s\n", preset[i++].name.c_str());
-        request->send(response);
-    });
-
-    server.on("/favorites", HTTP_GET, [](AsyncWebServerRequest* request) {
-        AsyncResponseStream* const response = request->beginResponseStream("text/plain");
-        response->addHeader("Cache-Control", "no-cache,no-store,must-revalidate,max-age=0");
-        String s;
-        response->print(favoritesToCStruct(s));
+        response->addHeader("ETag", _buildEtag);
+        response->addHeader(HEADER_CACHE_CONTROL, REVALIDATE);
+        response->println(SCRIPT_URL); /* listings go through /library which adds the login */
         request->send(response);
     });
 
-    static const char* SVG_MIMETYPE{ "image/svg+xml" };
-
-    server.on("/radioicon.svg", HTTP_GET, [](AsyncWebServerRequest* request) {
-        if (htmlUnmodified(request, modifiedDate)) return request->send(304);
-        AsyncWebServerResponse* const response = request->beginResponse_P(200, SVG_MIMETYPE, radioicon);
-        response->addHeader(HEADER_LASTMODIFIED, modifiedDate);
-        request->send(response);
+    server.on("/library", HTTP_GET, [](AsyncWebServerRequest* request) {
+        if (!request->hasParam("folder")) return request->send(400);
+        const String url = libraryListingUrl(request->getParam("folder")->value());
+        request->send(proxiedResponse(request, url, url, LIBRARY_TTL_MS, HTML_MIMETYPE, nullptr, LIBRARY_USER, LIBRARY_PWD));
     });
 
-    server.on("/playicon.svg", HTTP_GET, [](AsyncWebServerRequest* request) {
-        if (htmlUnmodified(request, modifiedDate)) return request->send(304);
-        AsyncWebServerResponse* const response = request->beginResponse_P(200, SVG_MIMETYPE, playicon);
-        response->addHeader(HEADER_LASTMODIFIED, modifiedDate);
+    server.on("/search", HTTP_GET, [](AsyncWebServerRequest* request) {
+        if (!request->hasParam("name")) return request->send(400);
+        const String name = radioBrowser::normalize(request->getParam("name")->value());
+        if (!name.length()) return request->send(400);
+        const uint32_t page = request->hasParam("page") ? request->getParam("page")->value().toInt() : 0;
+        AsyncWebServerResponse* const response = proxiedResponse(request, radioBrowser::searchKey(name, page), radio.searchUrl(name, page), SEARCH_TTL_MS, "text/plain; charset=utf-8", radioBrowser::compact);
+        response->addHeader("X-Radio-Browser-Mirror", radio.mirror()); /* for click counting */
         request->send(response);
     });
 
-    server.on("/libraryicon.svg", HTTP_GET, [](AsyncWebServerRequest* request) {
-        if (htmlUnmodified(request, modifiedDate)) return request->send(304);
-        AsyncWebServerResponse* const response = request->beginResponse_P(200, SVG_MIMETYPE, libraryicon);
-        response->addHeader(HEADER_LASTMODIFIED, modifiedDate);
-        request->send(response);
-    });
-
-    server.on("/favoriteicon.svg", HTTP_GET, [](AsyncWebServerRequest* request) {
-        if (htmlUnmodified(request, modifiedDate)) return request->send(304);
-        AsyncWebServerResponse* const response = request->beginResponse_P(200, SVG_MIMETYPE, favoriteicon);
-        response->addHeader(HEADER_LASTMODIFIED, modifiedDate);
-        request->send(response);
-    });
-
-    server.on("/streamicon.svg", HTTP_GET, [](AsyncWebServerRequest* request) {
-        if (htmlUnmodified(request, modifiedDate)) return request->send(304);
-        AsyncWebServerResponse* const response = request->beginResponse_P(200, SVG_MIMETYPE, pasteicon);
-        response->addHeader(HEADER_LASTMODIFIED, modifiedDate);
-        request->send(response);
-    });
-
-    server.on("/deleteicon.svg", HTTP_GET, [](AsyncWebServerRequest* request) {
-        if (htmlUnmodified(request, modifiedDate)) return request->send(304);
-        AsyncWebServerResponse* const response = request->beginResponse_P(200, SVG_MIMETYPE, deleteicon);
-        response->addHeader(HEADER_LASTMODIFIED, modifiedDate);
+    server.on("/stations", HTTP_GET, [](AsyncWebServerRequest* request) {
+        if (buildUnmodified(request)) return request->send(304);
+        lineStreamer streamer([](const size_t index, char* line, const size_t size) -> int {
+            return index < NUMBER_OF_PRESETS ? snprintf(line, size, "%s\n", preset[index].name.c_str()) : -1;
+        });
+        AsyncWebServerResponse* const response = request->beginChunkedResponse(HTML_MIMETYPE, [streamer](uint8_t* buffer, size_t maxLen, size_t) mutable {
+            return streamer.fill(buffer, maxLen);
+        });
+        response->addHeader("ETag", _buildEtag);
+        response->addHeader(HEADER_CACHE_CONTROL, REVALIDATE);
         request->send(response);
     });
 
-    server.on("/addfoldericon.svg", HTTP_GET, [](AsyncWebServerRequest* request) {
-        if (htmlUnmodified(request, modifiedDate)) return request->send(304);
-        AsyncWebServerResponse* const response = request->beginResponse_P(200, SVG_MIMETYPE, addfoldericon);
-        response->addHeader(HEADER_LASTMODIFIED, modifiedDate);
+    server.on("/favorites", HTTP_GET, [](AsyncWebServerRequest* request) {
+        lineStreamer streamer(favoritesToCStruct);
+        AsyncWebServerResponse* const response = request->beginChunkedResponse("text/plain", [streamer](uint8_t* buffer, size_t maxLen, size_t) mutable {
+            return streamer.fill(buffer, maxLen);
+        });
+        response->addHeader("Cache-Control", "no-cache,no-store,must-revalidate,max-age=0");
         request->send(response);
     });
 
-    server.on("/emptyicon.svg", HTTP_GET, [](AsyncWebServerRequest* request) {
-        if (htmlUnmodified(request, modifiedDate)) return request->send(304);
-        AsyncWebServerResponse* const response = request->beginResponse_P(200, SVG_MIMETYPE, emptyicon);
-        response->addHeader(HEADER_LASTMODIFIED, modifiedDate);
+    server.on("/playlist.m3u", HTTP_GET, [](AsyncWebServerRequest* request) {
+        lineStreamer streamer(playlistToM3U);
+        AsyncWebServerResponse* const response = request->beginChunkedResponse("audio/x-mpegurl", [streamer](uint8_t* buffer, size_t maxLen, size_t) mutable {
+            return streamer.fill(buffer, maxLen);
+        });
+        response->addHeader("Cache-Control", "no-cache,no-store,must-revalidate,max-age=0");
+        response->addHeader("Content-Disposition", "attachment; filename=\"playlist.m3u\"");
         request->send(response);
     });
 
-    server.on("/starticon.svg", HTTP_GET, [](AsyncWebServerRequest* request) {
-        if (htmlUnmodified(request, modifiedDate)) return request->send(304);
-        AsyncWebServerResponse* const response = request->beginResponse_P(200, SVG_MIMETYPE, starticon);
-        response->addHeader(HEADER_LASTMODIFIED, modifiedDate);
+    server.on("/history", HTTP_GET, [](AsyncWebServerRequest* request) {
+        lineStreamer streamer([](const size_t index, char* line, const size_t size) -> int {
+            return history.line(index, line, size);
+        });
+        AsyncWebServerResponse* const response = request->beginChunkedResponse("text/plain; charset=utf-8", [streamer](uint8_t* buffer, size_t maxLen, size_t) mutable {
+            return streamer.fill(buffer, maxLen);
+        });
+        response->addHeader("Cache-Control", "no-cache,no-store,must-revalidate,max-age=0");
         request->send(response);
     });
 
-    server.on("/pauseicon.svg", HTTP_GET, [](AsyncWebServerRequest* request) {
-        if (htmlUnmodified(request, modifiedDate)) return request->send(304);
-        AsyncWebServerResponse* const response = request->beginResponse_P(200, SVG_MIMETYPE, pauseicon);
-        response->addHeader(HEADER_LASTMODIFIED, modifiedDate);
+    server.on("/metrics", HTTP_GET, [](AsyncWebServerRequest* request) {
+        AsyncResponseStream* const response = request->beginResponseStream("text/plain; version=0.0.4");
+        response->addHeader("Cache-Control", "no-cache,no-store,must-revalidate,max-age=0");
+        metricsToResponse(response);
         request->send(response);
     });
 
-    server.on("/searchicon.svg", HTTP_GET, [](AsyncWebServerRequest* request) {
-        if (htmlUnmodified(request, modifiedDate)) return request->send(304);
-        AsyncWebServerResponse* const response = request->beginResponse_P(200, SVG_MIMETYPE, searchicon);
-        response->addHeader(HEADER_LASTMODIFIED, modifiedDate);
+    server.on("/bufferstatus", HTTP_GET, [](AsyncWebServerRequest* request) {
+        AsyncResponseStream* const response = request->beginResponseStream("text/plain");
+        response->addHeader("Cache-Control", "no-cache,no-store,must-revalidate,max-age=0");
+        response->printf("stream: %s\n", streamStatus.label());
+        response->printf("fill: %u/%u bytes\n", streamStatus.used(), streamStatus.capacity());
+        response->printf("pacing watermarks: %u-%u bytes\n", streamStatus.lowWatermark(), streamStatus.highWatermark());
+        response->printf("bitrate: %u bps\n", streamStatus.bitrate());
+        response->printf("jitter: %u ms\n", streamStatus.jitterMs());
+        response->printf("underruns: %u\n", streamStatus.underruns());
         request->send(response);
     });
 
-    server.on("/nosslicon.svg", HTTP_GET, [](AsyncWebServerRequest* request) {
-        if (htmlUnmodified(request, modifiedDate)) return request->send(304);
-        AsyncWebServerResponse* const response = request->beginResponse_P(200, SVG_MIMETYPE, nosslicon);
-        response->addHeader(HEADER_LASTMODIFIED, modifiedDate);
-        request->send(response);
-    });
+    assets.begin();
+    server.addHandler(&assets);
 
     server.onNotFound([](AsyncWebServerRequest* request) {
         log_e("404 - Not found: 'http://%s%s'", request->host().c_str(), request->url().c_str());
@@ -516,32 +880,51 @@ void setup() {
 
     DefaultHeaders::Instance().addHeader("Access-Control-Allow-Origin", "*");
 
-    playlistHasEnded(); /* before the webserver starts! */
+    /* before the webserver starts! - playback of the resumed item starts when wifi is up */
+    if (journal.resumeItem() == PLAYLIST_STOPPED)
+        playlistHasEnded();
+    else {
+        playList.setCurrentItem(journal.resumeItem());
+        announceItem(playList.currentItem());
+    }
 
     server.begin();
     ws.onEvent(websocketEventHandler);
     server.addHandler(&ws);
     log_i("Webserver started");
+    boot.done(bootStages::WEBSERVER);
 
-    const BaseType_t result = xTaskCreatePinnedToCore(
-        playerTask,            /* Function to implement the task */
-        "playerTask",          /* Name of the task */
-        8000,                  /* Stack size in BYTES! */
-        NULL,                  /* Task input parameter */
-        3 | portPRIVILEGE_BIT, /* Priority of the task */
-        NULL,                  /* Task handle. */
-        1                      /* Core where the task should run */
-    );
+    WiFi.waitForConnectResult();
 
-    if (result != pdPASS) {
-        log_e("ERROR! Could not create playerTask. System halted.");
-        while (true) delay(100);
+    if (!WiFi.isConnected()) {
+        log_e("Could not connect to Wifi! System halted! Check 'system_setup.h'!");
+        while (true) delay(1000); /* system is halted */
+    }
+
+    log_i("WiFi connected - IP %s", WiFi.localIP().toString().c_str());
+    boot.done(bootStages::WIFI);
+
+    {
+        playlistGuard guard;
+        if (playList.currentItem() != PLAYLIST_STOPPED) {
+            playListView item;
+            playList.view(playList.currentItem(), item);
+            mailbox.connect(item, journal.resumeOffset());
+        }
     }
 
-    playerMessage msg;
-    msg.action = playerMessage::SET_VOLUME;
-    msg.value = VS1053_INITIALVOLUME;
-    xQueueSend(playerQueue, &msg, portMAX_DELAY);
+    if (!proxy.begin(psramFound() ? PROXY_BUDGET_PSRAM : PROXY_BUDGET_HEAP, PROXY_MAX_BODY_SIZE, VERSION_STRING))
+        log_e("ERROR! Proxy cache could not be started");
+
+    if (!radio.begin(RADIOBROWSER_SERVERS_URL, RADIOBROWSER_FALLBACK, VERSION_STRING))
+        log_e("ERROR! Radio-browser mirror probe could not be started");
+
+    /* playback does not need the clock - it is synced in the background */
+    if (NTP_POOL[0]) {
+        boot.start(bootStages::NTP);
+        sntp_set_time_sync_notification_cb(ntpSynced);
+        configTzTime(TIMEZONE, NTP_POOL);
+    }
 
     vTaskDelete(NULL);  // this deletes both setup() and loop() - see ~/.arduino15/packages/esp32/hardware/esp32/1.0.6/cores/esp32/main.cpp
 }
@@ -557,25 +940,52 @@ void loop() {
 //                                  E V E N T S                                           *
 //*****************************************************************************************
 
-#define MAX_STATION_NAME_LENGTH 200
-static char showstation[MAX_STATION_NAME_LENGTH];
 void audio_showstation(const char* info) {
-    playListItem item;
-    playList.get(playList.currentItem(), item);
-    snprintf(showstation, sizeof(showstation), "showstation\n%s\n%s", info, typeStr[item.type]);
-    log_d("%s", showstation);
-    ws.textAll(showstation);
+    showStation(info, strlen(info));
 }
 
-#define MAX_METADATA_LENGTH 255
-static char streamtitle[MAX_METADATA_LENGTH];
+/* stream metadata - a new title goes into the history under the name of the playlist item */
 void audio_showstreamtitle(const char* info) {
-    snprintf(streamtitle, sizeof(streamtitle), "streamtitle\n%s", percentEncode(info).c_str());
+    if (!showStreamTitle(info, strlen(info))) return;
+    playlistGuard guard;
+    playListView item;
+    playList.view(playList.currentItem(), item);
+    const char* const title = strchr(streamtitle, '\n') + 1;
+    history.add(item.type, item.name.data, item.name.length, title, strlen(title));
+}
+
+void showStation(const char* info, const size_t length) {
+    playlistGuard guard;
+    snprintf(showstation, sizeof(showstation), "showstation\n%.*s\n%s", (int)length, info, typeStr[playList.type(playList.currentItem())]);
+    log_d("%s", showstation);
+    ws.publish(TOPIC_SHOWSTATION, showstation);
+}
+
+/* false when the title is the same as the last one - nothing is sent then */
+bool showStreamTitle(const char* info, const size_t length) {
+    scopedTimer timer("streamtitle broadcast");
+    const size_t headerLength = snprintf(streamtitle, sizeof(streamtitle), "streamtitle\n");
+    const size_t titleLength = utf8Sanitize(info, length, streamtitle + headerLength, sizeof(streamtitle) - headerLength);
+    uint32_t hash = 2166136261u;
+    for (size_t i = headerLength; i < headerLength + titleLength; i++) {
+        hash ^= (uint8_t)streamtitle[i];
+        hash *= 16777619u;
+    }
+    if (hash == _streamtitleHash) return false;
+    _streamtitleHash = hash;
     log_d("%s", streamtitle);
-    ws.textAll(streamtitle);
+    ws.publish(TOPIC_STREAMTITLE, streamtitle);
+    return true;
 }
 
 void audio_eof_stream(const char* info) {
     log_d("%s", info);
+    _eofTime = millis();
+    playlistGuard guard;
+    const uint32_t next = playList.currentItem() + 1;
+    if (playList.directHandover() && playList.type(playList.currentItem()) == HTTP_FILE && next < (uint32_t)playList.size() && playList.type(next) == HTTP_FILE) {
+        _handoverPending = true; /* audio.loop() is still running - handover is done by playerTask */
+        return;
+    }
     startNextItem();
 }
@@ -0,0 +1,298 @@
+#include "favoritesLog.h"
+
+uint16_t favoritesLog::fletcher16(const uint8_t* data, const size_t length) {
+    uint16_t sum1 = 0;
+    uint16_t sum2 = 0;
+    for (size_t i = 0; i < length; i++) {
+        sum1 = (sum1 + data[i]) % 255;
+        sum2 = (sum2 + sum1) % 255;
+    }
+    return (sum2 << 8) | sum1;
+}
+
+size_t favoritesLog::encode(uint8_t* record, const recordType type, const char* name, const size_t nameLength, const char* url, const size_t urlLength) {
+    const size_t size = recordSize(nameLength, urlLength);
+    record[0] = MAGIC;
+    record[1] = type;
+    record[2] = nameLength;
+    record[3] = urlLength;
+    memcpy(record + HEADER_SIZE, name, nameLength);
+    if (urlLength) memcpy(record + HEADER_SIZE + nameLength, url, urlLength);
+    const uint16_t checksum = fletcher16(record, size - CHECKSUM_SIZE);
+    record[size - 2] = checksum & 0xFF;
+    record[size - 1] = checksum >> 8;
+    return size;
+}
+
+int favoritesLog::find(const char* name) const {
+    for (size_t i = 0; i < _index.size(); i++)
+        if (_index[i].name.equals(name)) return i;
+    return -1;
+}
+
+bool favoritesLog::begin(const char* path, const char* legacyFolder, const char* otherFile) {
+    _path = path;
+    _tempPath = _path + ".tmp";
+    _migratedPath = _path + ".migrated";
+
+    /* power was lost during compaction between removing the log and renaming the temp file */
+    if (!FFat.exists(_path.c_str()) && FFat.exists(_tempPath.c_str()))
+        FFat.rename(_tempPath.c_str(), _path.c_str());
+
+    if (!FFat.exists(_path.c_str())) {
+        if (!FFat.exists(_migratedPath.c_str()))
+            migrate(legacyFolder, otherFile);
+        else {
+            File empty = FFat.open(_path, FILE_WRITE);
+            empty.close();
+            _fileSize = 0;
+        }
+        return true;
+    }
+    /* a log from before the marker existed - it was migrated */
+    if (!FFat.exists(_migratedPath.c_str())) {
+        File marker = FFat.open(_migratedPath, FILE_WRITE);
+        marker.close();
+    }
+
+    if (!replay()) {
+        log_e("ERROR! Could not read %s", path);
+        return false;
+    }
+    log_i("Loaded %i favorites - %i of %i bytes are dead records", _index.size(), _deadBytes, _fileSize);
+    compactIfWasteful();
+    return true;
+}
+
+bool favoritesLog::replay() {
+    File file = FFat.open(_path);
+    if (!file) return false;
+    const uint32_t fileSize = file.size();
+    uint8_t record[recordSize(UINT8_MAX, UINT8_MAX)];
+    uint32_t offset = 0;
+    while (offset + HEADER_SIZE <= fileSize) {
+        if (file.read(record, HEADER_SIZE) != HEADER_SIZE) break;
+        if (record[0] != MAGIC || (record[1] != ADD && record[1] != DELETE) || !record[2]) break;
+        const size_t size = recordSize(record[2], record[3]);
+        if (offset + size > fileSize || file.read(record + HEADER_SIZE, size - HEADER_SIZE) != size - HEADER_SIZE) break;
+        if (fletcher16(record, size - CHECKSUM_SIZE) != (record[size - 2] | record[size - 1] << 8)) break;
+
+        char name[UINT8_MAX + 1];
+        memcpy(name, record + HEADER_SIZE, record[2]);
+        name[record[2]] = 0;
+        apply(static_cast<recordType>(record[1]), name, offset, record[3]);
+        offset += size;
+    }
+    file.close();
+    _fileSize = offset;
+
+    if (offset < fileSize) {
+        log_w("Dropping %i bytes of corrupt data at the end of %s", fileSize - offset, _path.c_str());
+        if (!compact()) _needsCompaction = true;
+    }
+    return true;
+}
+
+/* a favorite of an older version is a file with one url and a newline */
+bool favoritesLog::legacyFavorite(File& file, char* url, const size_t size) {
+    const size_t length = file.size();
+    if (file.isDirectory() || length < 2 || length > size) return false;
+    if (file.read(reinterpret_cast<uint8_t*>(url), length) != length || url[length - 1] != '\n') return false;
+    url[length - 1] = 0;
+    if (strncmp(url, "http://", 7) && strncmp(url, "https://", 8)) return false;
+    for (size_t i = 0; i < length - 1; i++)
+        if ((uint8_t)url[i] < 0x20 || url[i] == 0x7F) return false;
+    return true;
+}
+
+void favoritesLog::migrate(const char* legacyFolder, const char* otherFile) {
+    File empty = FFat.open(_path, FILE_WRITE);
+    empty.close();
+    _fileSize = 0;
+
+    std::vector<String> migrated;
+    File folder = FFat.open(legacyFolder);
+    if (folder) {
+        File file = folder.openNextFile();
+        while (file) {
+            const String path = file.path();
+            const size_t nameLength = strlen(file.name());
+            const bool skipped = path.equals(_path) || path.equals(_tempPath) || path.equals(_migratedPath) || path.equals(otherFile)
+                                 || (nameLength >= 4 && !strcmp(file.name() + nameLength - 4, ".tmp"));
+            char url[PLAYLIST_MAX_URL_LENGTH];
+            if (!skipped && legacyFavorite(file, url, sizeof(url)) && add(file.name(), url))
+                migrated.push_back(path);
+            file.close();
+            file = folder.openNextFile();
+        }
+        folder.close();
+    }
+
+    for (const auto& path : migrated)
+        FFat.remove(path.c_str());
+    File marker = FFat.open(_migratedPath, FILE_WRITE);
+    marker.close();
+    log_i("Migrated %i favorites to %s", migrated.size(), _path.c_str());
+}
+
+/* keeps the index in step with a record at 'recordStart' */
+void favoritesLog::apply(const recordType type, const char* name, const uint32_t recordStart, const uint8_t urlLength) {
+    const size_t nameLength = strlen(name);
+    const int existing = find(name);
+    if (existing != -1)
+        _deadBytes += recordSize(nameLength, _index[existing].urlLength);
+
+    if (type == DELETE) {
+        _deadBytes += recordSize(nameLength, 0);
+        if (existing != -1) _index.erase(_index.begin() + existing);
+        return;
+    }
+
+    const uint32_t urlOffset = recordStart + HEADER_SIZE + nameLength;
+    if (existing != -1) {
+        _index[existing].urlOffset = urlOffset;
+        _index[existing].urlLength = urlLength;
+        return;
+    }
+    _index.push_back({ String(name), urlOffset, urlLength });
+}
+
+bool favoritesLog::append(const recordType type, const char* name, const char* url) {
+    const size_t nameLength = strlen(name);
+    const size_t urlLength = url ? strlen(url) : 0;
+    if (!nameLength || nameLength > UINT8_MAX || urlLength > UINT8_MAX || strchr(name, '\n')) return false;
+
+    if (_needsCompaction && !compact()) {
+        log_e("ERROR! %s needs a compaction first", _path.c_str());
+        return false;
+    }
+
+    uint8_t record[recordSize(nameLength, urlLength)];
+    encode(record, type, name, nameLength, url, urlLength);
+
+    File file = FFat.open(_path, FILE_APPEND);
+    if (!file) {
+        log_e("ERROR! Could not open %s", _path.c_str());
+        return false;
+    }
+    const size_t bytesWritten = file.write(record, sizeof(record));
+    file.close();
+    if (bytesWritten != sizeof(record)) {
+        log_e("ERROR! Could not write to %s - disk full?", _path.c_str());
+        /* rewrite the live records so the next append does not land behind a partial record */
+        if (!compact()) _needsCompaction = true;
+        return false;
+    }
+    apply(type, name, _fileSize, urlLength);
+    _fileSize += sizeof(record);
+    _version++;
+    return true;
+}
+
+bool favoritesLog::add(const char* name, const char* url) {
+    if (!append(ADD, name, url)) return false;
+    compactIfWasteful();
+    return true;
+}
+
+bool favoritesLog::remove(const char* name) {
+    if (find(name) == -1 || !append(DELETE, name, nullptr)) return false;
+    compactIfWasteful();
+    return true;
+}
+
+size_t favoritesLog::url(const char* name, char* buffer, const size_t size) {
+    const int index = find(name);
+    if (index == -1) return 0;
+    return urlAt(index, buffer, size);
+}
+
+size_t favoritesLog::urlAt(const size_t index, char* buffer, const size_t size) {
+    if (index >= _index.size() || !size) return 0;
+    File file = FFat.open(_path);
+    if (!file) return 0;
+    const size_t length = min((size_t)_index[index].urlLength, size - 1);
+    const bool success = file.seek(_index[index].urlOffset) && file.read(reinterpret_cast<uint8_t*>(buffer), length) == length;
+    file.close();
+    buffer[success ? length : 0] = 0;
+    return success ? length : 0;
+}
+
+void favoritesLog::compactIfWasteful() {
+    static constexpr const uint32_t MIN_DEAD_BYTES = 1024;
+    if (_deadBytes > MIN_DEAD_BYTES && _deadBytes > _fileSize / 2) compact();
+}
+
+/* writes the live records to a temp file that replaces the log */
+bool favoritesLog::compact() {
+    /* an earlier compaction removed the log but could not rename the temp file - the index already points into it */
+    if (!FFat.exists(_path.c_str()) && FFat.exists(_tempPath.c_str())) {
+        if (!FFat.rename(_tempPath.c_str(), _path.c_str())) {
+            log_e("ERROR! Could not rename %s", _tempPath.c_str());
+            return false;
+        }
+        _needsCompaction = false;
+        return true;
+    }
+
+    File in = FFat.open(_path);
+    File out = FFat.open(_tempPath, FILE_WRITE);
+    if (!in || !out) {
+        log_e("ERROR! Could not compact %s", _path.c_str());
+        return false;
+    }
+
+    std::vector<uint32_t> urlOffsets;
+    urlOffsets.reserve(_index.size());
+    uint32_t offset = 0;
+    bool success = true;
+    for (const auto& item : _index) {
+        char url[UINT8_MAX];
+        if (!in.seek(item.urlOffset) || in.read(reinterpret_cast<uint8_t*>(url), item.urlLength) != item.urlLength) {
+            success = false;
+            break;
+        }
+        uint8_t record[recordSize(UINT8_MAX, UINT8_MAX)];
+        const size_t size = encode(record, ADD, item.name.c_str(), item.name.length(), url, item.urlLength);
+        if (out.write(record, size) != size) {
+            success = false;
+            break;
+        }
+        urlOffsets.push_back(offset + HEADER_SIZE + item.name.length());
+        offset += size;
+    }
+    in.close();
+    out.close();
+
+    if (!success || !FFat.remove(_path.c_str())) {
+        log_e("ERROR! Compacting %s failed", _path.c_str());
+        if (FFat.exists(_path.c_str())) FFat.remove(_tempPath.c_str());
+        return false;
+    }
+
+    for (size_t i = 0; i < _index.size(); i++)
+        _index[i].urlOffset = urlOffsets[i];
+    log_d("Compacted %s from %i to %i bytes", _path.c_str(), _fileSize, offset);
+    _fileSize = offset;
+    _deadBytes = 0;
+
+    /* the temp file is the only copy now - begin() or the next compaction renames it */
+    if (!FFat.rename(_tempPath.c_str(), _path.c_str())) {
+        log_e("ERROR! Could not rename %s", _tempPath.c_str());
+        _needsCompaction = true;
+        return false;
+    }
+    _needsCompaction = false;
+    return true;
+}
+
+String& favoritesLog::toString(String& s) {
+    s = "favorites\n";
+    s.concat(_version);
+    s.concat("\n");
+    for (const auto& item : _index) {
+        s.concat(item.name);
+        s.concat("\n");
+    }
+    return s;
+}
@@ -0,0 +1,91 @@
+#ifndef __FAVORITESLOG_H
+#define __FAVORITESLOG_H
+
+#include <Arduino.h>
+#include <FFat.h>
+#include <vector>
+#include "playList.h"
+
+/* All favorites live in one append-only file on FFat.
+
+   A record is a 4 byte header - magic, type, name length, url length -
+   followed by the name, the url and a Fletcher-16 checksum over all of it.
+   Saving a favorite appends an ADD record, deleting one appends a DELETE record without url.
+
+   begin() replays the file into an index in RAM that holds the names and where each url is stored.
+   Listing needs no file access and a lookup reads a single url.
+   A torn or corrupt tail - power lost while writing - is dropped.
+   The file is compacted through a temp file when more than half of it is dead records.
+   While the file holds bytes the index does not know about - a dropped tail or a failed write - appends are refused
+   until a compaction succeeds, so no record ends up behind garbage. */
+
+class favoritesLog {
+
+  public:
+    favoritesLog(){};
+
+    /* the first boot without a log moves the one-file-per-favorite files from 'legacyFolder' into the log
+       only a file that holds a single http(s) url line is taken - 'otherFile' and temp files are never touched
+       a marker file next to the log makes sure this happens once */
+    bool begin(const char* path, const char* legacyFolder, const char* otherFile = "");
+
+    bool add(const char* name, const char* url);
+    bool remove(const char* name);
+
+    /* copy the url into 'buffer' - return its length or 0 when there is no such favorite */
+    size_t url(const char* name, char* buffer, const size_t size);
+    size_t urlAt(const size_t index, char* buffer, const size_t size);
+
+    size_t size() const {
+        return _index.size();
+    }
+    /* changes with every add or remove */
+    uint32_t version() const {
+        return _version;
+    }
+    const char* name(const size_t index) const {
+        return _index[index].name.c_str();
+    }
+
+    String& toString(String& s);
+
+  private:
+    enum recordType : uint8_t { ADD = 1,
+                                DELETE = 2 };
+
+    static constexpr const uint8_t MAGIC = 0xFA;
+    static constexpr const size_t HEADER_SIZE = 4;
+    static constexpr const size_t CHECKSUM_SIZE = 2;
+
+    struct favorite {
+        String name;
+        uint32_t urlOffset; /* file offset of the url */
+        uint8_t urlLength;
+    };
+
+    static uint16_t fletcher16(const uint8_t* data, const size_t length);
+    static size_t encode(uint8_t* record, const recordType type, const char* name, const size_t nameLength, const char* url, const size_t urlLength);
+    static size_t recordSize(const uint8_t nameLength, const uint8_t urlLength) {
+        return HEADER_SIZE + nameLength + urlLength + CHECKSUM_SIZE;
+    }
+
+    int find(const char* name) const;
+    bool append(const recordType type, const char* name, const char* url);
+    void apply(const recordType type, const char* name, const uint32_t recordStart, const uint8_t urlLength);
+    bool replay();
+    void migrate(const char* legacyFolder, const char* otherFile);
+    static bool legacyFavorite(File& file, char* url, const size_t size);
+    bool compact();
+    void compactIfWasteful();
+
+    String _path;
+    String _tempPath;
+    String _migratedPath;
+    std::vector<favorite> _index;
+    uint32_t _fileSize{ 0 };
+    uint32_t _deadBytes{ 0 };
+    uint32_t _version{ 0 };
+    bool _needsCompaction{ false }; /* the file does not match the index */
+};
+
+#endif
@@ -0,0 +1,25 @@
+/* Replaces the global operator new and delete to count the heap allocations.
+   They live in their own translation unit so they are never inlined into a caller. */
+
+#include <new>
+#include <stdlib.h>
+#include "allocationCounter.h"
+
+static size_t _allocations = 0;
+
+size_t heapAllocations() {
+    return _allocations;
+}
+
+void* operator new(size_t size) {
+    _allocations++;
+    void* const data = malloc(size ? size : 1);
+    if (!data) throw std::bad_alloc();
+    return data;
+}
+void operator delete(void* data) noexcept {
+    free(data);
+}
+void operator delete(void* data, size_t) noexcept {
+    free(data);
+}
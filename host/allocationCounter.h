@@ -0,0 +1,9 @@
+#ifndef __HOST_ALLOCATIONCOUNTER_H
+#define __HOST_ALLOCATIONCOUNTER_H
+
+#include <stddef.h>
+
+/* the number of operator new calls since the start of the program */
+size_t heapAllocations();
+
+#endif
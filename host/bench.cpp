@@ -0,0 +1,323 @@
+/* Benchmarks of the player core on a pc - the numbers are for comparing builds on the same machine, not the esp32.
+   Every benchmark also checks its result, so the ctest run fails when the core is broken. */
+
+#include <Arduino.h>
+#include <ESPAsyncWebServer.h>
+#include <FFat.h>
+#include <chrono>
+#include <memory>
+#include <unistd.h>
+#include "../broadcastSocket.h"
+#include "../favoritesLog.h"
+#include "../lineParser.h"
+#include "../playList.h"
+#include "../playlistJournal.h"
+#include "allocationCounter.h"
+#include "percentEncode.h"
+#include "utf8Sanitize.h"
+
+static int _failures = 0;
+
+static void check(const bool ok, const char* what) {
+    if (ok) return;
+    fprintf(stderr, "FAILED: %s\n", what);
+    _failures++;
+}
+
+/* runs 'work' 'rounds' times and prints the time and the heap allocations per round */
+template<typename F>
+static void measure(const char* label, const uint32_t rounds, F work) {
+    const size_t allocations = heapAllocations();
+    const auto start = std::chrono::steady_clock::now();
+    for (uint32_t round = 0; round < rounds; round++) work(round);
+    const double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    printf("%-40s %12.1f ns %10.2f allocations\n", label, ns / rounds, double(heapAllocations() - allocations) / rounds);
+}
+
+static void fillPlaylist(playList_t& list, const uint32_t count) {
+    char url[PLAYLIST_MAX_URL_LENGTH];
+    for (uint32_t i = 0; i < count; i++) {
+        if (i % 50 == 49) {
+            list.add({ HTTP_PRESET, "", "", static_cast<uint32_t>(i % NUMBER_OF_PRESETS) });
+            continue;
+        }
+        snprintf(url, sizeof(url), "http://192.168.0.50/music/Artist %u/Album %u/%02u - Track title.mp3", i / 200, i / 20, i % 20);
+        list.add({ HTTP_FILE, "", url, 0 });
+    }
+}
+
+static void benchUtf8() {
+    static const char* ascii = "Artist name - A fairly long song title (Radio Edit) [2024]";
+    static const char* mixed = "Bj\xC3\xB6rk - J\xC3\xB3ga \xE2\x80\x94 Caf\xE9 \xF0\x9F\x8E\xB5 \x01 end";
+    char out[256];
+    volatile size_t sink = 0;
+    measure("utf8Sanitize ascii title", 1000000, [&](uint32_t) {
+        sink += utf8Sanitize(ascii, out, sizeof(out));
+    });
+    measure("utf8Sanitize mixed title", 1000000, [&](uint32_t) {
+        sink += utf8Sanitize(mixed, out, sizeof(out));
+    });
+    measure("percentEncode ascii title - baseline", 1000000, [&](uint32_t) {
+        sink += percentEncode(ascii).length();
+    });
+    measure("percentEncode mixed title - baseline", 1000000, [&](uint32_t) {
+        sink += percentEncode(mixed).length();
+    });
+    check(percentEncode(ascii) == String(ascii), "percentEncode ascii title");
+    utf8Sanitize(mixed, out, sizeof(out));
+    check(!strcmp(out, "Bj\xC3\xB6rk - J\xC3\xB3ga \xE2\x80\x94 Caf\xC3\xA9 \xF0\x9F\x8E\xB5   end"), "utf8Sanitize mixed title");
+}
+
+static void benchPlaylist() {
+    const uint32_t items = PLAYLIST_MAX_ITEMS_PSRAM;
+    std::unique_ptr<playList_t> list(new playList_t);
+    measure("playList add - full playlist", 1, [&](uint32_t) {
+        fillPlaylist(*list, items);
+    });
+    check((uint32_t)list->size() == items, "playList holds PLAYLIST_MAX_ITEMS_PSRAM items");
+
+    volatile size_t sink = 0;
+    measure("playList view - per item", items, [&](uint32_t index) {
+        playListView item;
+        list->view(index, item);
+        sink += item.name.length + item.prefix.length + item.rest.length;
+    });
+    char url[PLAYLIST_MAX_URL_LENGTH];
+    measure("playList url copy - per item", items, [&](uint32_t index) {
+        sink += list->url(index, url, sizeof(url));
+    });
+    list->url(1, url, sizeof(url));
+    check(!strcmp(url, "http://192.168.0.50/music/Artist 0/Album 0/01 - Track title.mp3"), "playList url");
+
+    String s;
+    measure("playList toString - one window", 1000, [&](uint32_t round) {
+        list->toString(s, round);
+    });
+    measure("playList remove - from the front", items / 2, [&](uint32_t) {
+        list->remove(0);
+    });
+    measure("playList add - after removals", items / 2, [&](uint32_t index) {
+        list->add({ HTTP_FOUND, "A found stream", "http://stream.example.com:8000/live.mp3", index });
+    });
+    list->url(items - 1, url, sizeof(url));
+    check(!strcmp(url, "http://stream.example.com:8000/live.mp3"), "playList url after removals");
+}
+
+static void benchJournal() {
+    const uint32_t items = 2000;
+    {
+        playList_t list;
+        playlistJournal journal(list);
+        check(journal.begin("/playlist.jnl", xSemaphoreCreateRecursiveMutex()), "journal begin");
+        measure("playlistJournal added - per item", items, [&](uint32_t index) {
+            char url[PLAYLIST_MAX_URL_LENGTH];
+            snprintf(url, sizeof(url), "http://192.168.0.50/music/Folder %u/Track %u.mp3", index / 25, index);
+            list.add({ HTTP_FILE, "", url, 0 });
+            journal.added(index, 1);
+        });
+        list.setCurrentItem(7);
+        journal.current(7);
+    }
+    playList_t list;
+    playlistJournal journal(list);
+    measure("playlistJournal replay", 1, [&](uint32_t) {
+        journal.begin("/playlist.jnl", xSemaphoreCreateRecursiveMutex());
+    });
+    check((uint32_t)list.size() == items && journal.resumeItem() == 7, "journal replay");
+}
+
+static void writeFile(const char* path, const char* content) {
+    File file = FFat.open(path, FILE_WRITE);
+    file.write(reinterpret_cast<const uint8_t*>(content), strlen(content));
+    file.close();
+}
+
+static void benchFavorites() {
+    const uint32_t count = 200;
+    /* the first boot moves the old one-file-per-favorite files - and nothing else */
+    writeFile("/Old station", "http://old.example.com/live.mp3\n");
+    writeFile("/notes.tmp", "http://tmp.example.com/live.mp3\n");
+    writeFile("/two lines", "http://one.example.com/live.mp3\nhttp://two.example.com/live.mp3\n");
+    {
+        favoritesLog favorites;
+        check(favorites.begin("/favorites.log", "/", "/playlist.jnl"), "favorites begin");
+        char url[PLAYLIST_MAX_URL_LENGTH];
+        check(favorites.size() == 1 && favorites.url("Old station", url, sizeof(url)) && !strcmp(url, "http://old.example.com/live.mp3"), "favorites migrated");
+        check(!FFat.exists("/Old station") && FFat.exists("/notes.tmp") && FFat.exists("/two lines") && FFat.exists("/playlist.jnl"), "favorites migration leaves other files");
+        favorites.remove("Old station");
+        measure("favoritesLog add", count, [&](uint32_t index) {
+            char name[32];
+            snprintf(name, sizeof(name), "Station %u", index);
+            favorites.add(name, "http://stream.example.com:8000/live.mp3");
+        });
+        measure("favoritesLog remove", count / 2, [&](uint32_t index) {
+            char name[32];
+            snprintf(name, sizeof(name), "Station %u", index * 2);
+            favorites.remove(name);
+        });
+    }
+    favoritesLog favorites;
+    measure("favoritesLog replay", 1, [&](uint32_t) {
+        favorites.begin("/favorites.log", "/", "/playlist.jnl");
+    });
+    char url[PLAYLIST_MAX_URL_LENGTH];
+    check(favorites.size() == count / 2 && favorites.url("Station 1", url, sizeof(url)) && !favorites.url("Station 0", url, sizeof(url)), "favorites replay");
+
+    /* a lost log does not migrate again */
+    FFat.remove("/favorites.log");
+    writeFile("/Another station", "http://another.example.com/live.mp3\n");
+    favoritesLog empty;
+    check(empty.begin("/favorites.log", "/", "/playlist.jnl") && !empty.size() && FFat.exists("/Another station"), "favorites migrate once");
+    FFat.remove("/Another station");
+    FFat.remove("/notes.tmp");
+    FFat.remove("/two lines");
+    FFat.remove("/favorites.log.migrated");
+}
+
+static void benchLineParser() {
+    std::string upload;
+    for (uint32_t i = 0; i < 20000; i++) upload += "http://192.168.0.50/music/Artist/Album/Track title.mp3\n";
+    const size_t frame = 1436; /* the payload of a websocket frame in one tcp segment */
+    lineParser<PLAYLIST_MAX_URL_LENGTH> parser;
+    size_t lines = 0;
+    measure("lineParser - per 1436 byte frame", upload.size() / frame, [&](uint32_t index) {
+        parser.feed(reinterpret_cast<const uint8_t*>(upload.data()) + index * frame, frame, [&](char*) {
+            lines++;
+        });
+    });
+    parser.feed(reinterpret_cast<const uint8_t*>(upload.data()) + (upload.size() / frame) * frame, upload.size() % frame, [&](char*) {
+        lines++;
+    });
+    check(lines == 20000, "lineParser lines");
+}
+
+/* handleSingleFrame() in websocketEventHandler.ino does not build on a pc - this is its parsing:
+   strtok() the frame into lines, strcmp() the first line against the commands in the order it tests them
+   and strtoul() the arguments */
+static const char* const _commands[] = { "hello", "unpause", "pause", "volume", "directhandover", "previous", "next",
+                                         "filetoplaylist", "_filetoplaylist", "playitem", "deleteitem", "moveitem",
+                                         "playlistwindow", "playlistsync", "clearlist", "presetstation", "_presetstation",
+                                         "jumptopos", "currenttofavorites", "favoritetoplaylist", "_favoritetoplaylist",
+                                         "deletefavorite", "foundlink", "_foundlink" };
+
+static uint32_t parseCommand(char* data) {
+    char* pch = strtok(data, "\n");
+    if (!pch) return UINT32_MAX;
+    uint32_t command = 0;
+    while (command < sizeof(_commands) / sizeof(_commands[0]) && strcmp(_commands[command], pch)) command++;
+    uint32_t arguments = 0;
+    while ((pch = strtok(NULL, "\n"))) arguments += strtoul(pch, NULL, 10);
+    return command * 100000 + arguments;
+}
+
+static void benchCommands() {
+    static const char* frames[] = { "volume\n72\n", "playitem\n1234\n", "moveitem\n12\n3456\n", "playlistwindow\n9900\n100\n",
+                                    "hello\n1700000000\n42\n7\n", "_foundlink\nA found stream\nhttp://stream.example.com:8000/live.mp3\n" };
+    const uint32_t numberOfFrames = sizeof(frames) / sizeof(frames[0]);
+    char data[PLAYLIST_MAX_URL_LENGTH * 2];
+    volatile uint32_t sink = 0;
+    measure("websocket command parse - per frame", 1000000, [&](uint32_t round) {
+        strcpy(data, frames[round % numberOfFrames]);
+        sink += parseCommand(data);
+    });
+    strcpy(data, frames[2]);
+    check(parseCommand(data) == 11 * 100000 + 12 + 3456, "websocket command moveitem");
+    strcpy(data, frames[5]);
+    check(parseCommand(data) == 23 * 100000, "websocket command _foundlink");
+}
+
+/* snapshotToClient() in eStreamPlayer32_VS1053.ino does not build on a pc - this builds the same frame
+   from the real playlist and favorites sections: rebuilt after a change, cached when they did not change */
+static void snapshot(String& s, const String& playlist, const String& favorites) {
+    char line[48];
+    snprintf(line, sizeof(line), "snapshot\n%u\n", 1700000000u);
+    s = line;
+    s.concat('\x1e');
+    s.concat(playlist);
+    s.concat('\x1e');
+    s.concat(favorites);
+    snprintf(line, sizeof(line), "%cstatus\n%s\n%ccurrent\n%i\n", '\x1e', "playing", '\x1e', 1234);
+    s.concat(line);
+    snprintf(line, sizeof(line), "%cvolume\n%i\n%cdirecthandover\n%i\n", '\x1e', 72, '\x1e', 1);
+    s.concat(line);
+    s.concat("\x1eshowstation\nA station name\nFAVO\x1estreamtitle\nArtist name - A fairly long song title\n");
+}
+
+static void benchSnapshot() {
+    playList_t list;
+    fillPlaylist(list, 1000);
+    favoritesLog favorites;
+    favorites.begin("/snapshot.log", "/legacy");
+    for (uint32_t i = 0; i < 50; i++) {
+        char name[32];
+        snprintf(name, sizeof(name), "Station %u", i);
+        favorites.add(name, "http://stream.example.com:8000/live.mp3");
+    }
+    String playlistSection, favoritesSection, s;
+    measure("connect snapshot - sections rebuilt", 1000, [&](uint32_t round) {
+        list.toString(playlistSection, round);
+        favorites.toString(favoritesSection);
+        snapshot(s, playlistSection, favoritesSection);
+    });
+    measure("connect snapshot - sections cached", 1000, [&](uint32_t) {
+        snapshot(s, playlistSection, favoritesSection);
+    });
+    check(s.startsWith("snapshot\n") && s.length() > playlistSection.length() + favoritesSection.length(), "connect snapshot");
+    FFat.remove("/snapshot.log");
+    FFat.remove("/snapshot.log.migrated");
+}
+
+static void benchBroadcast() {
+    static const uint32_t clients[] = { 1, 4, 16 };
+    for (const uint32_t count : clients) {
+        std::atomic<uint32_t> sent{ 0 };
+        broadcastSocket ws("/ws", sent);
+        std::vector<std::unique_ptr<AsyncWebSocketClient>> list;
+        for (uint32_t id = 0; id < count; id++) {
+            list.emplace_back(new AsyncWebSocketClient(id));
+            ws.addClient(list.back().get());
+        }
+        char label[48];
+        snprintf(label, sizeof(label), "broadcast publish - %u clients", count);
+        measure(label, 100000, [&](uint32_t round) {
+            ws.publishf(TOPIC_PROGRESS, "progress\n%u\n%u\n", round, 100000u);
+            for (auto& client : list) client->drain(1);
+        });
+        snprintf(label, sizeof(label), "broadcast textAll - %u clients", count);
+        measure(label, 100000, [&](uint32_t round) {
+            ws.printfAll("pldelta\n%u\nremove\n%u\n", round, round % 1000);
+            for (auto& client : list) client->drain(1);
+        });
+        check(sent == 200000 * count && !ws.dropped(), "broadcast to clients that keep up");
+
+        /* the first client stops reading - it gets the newest progress once it has caught up */
+        for (uint32_t round = 0; round < 100; round++) {
+            ws.publishf(TOPIC_PROGRESS, "progress\n%u\n%u\n", round, 100000u);
+            for (uint32_t i = 1; i < count; i++) list[i]->drain(1);
+        }
+        const size_t bytes = list[0]->bytes();
+        list[0]->drain(SIZE_MAX);
+        ws.flush();
+        check(list[0]->queueLen() == 1 && list[0]->bytes() - bytes == strlen("progress\n99\n100000\n") && ws.dropped() == 100 - broadcastSocket::LAGGING_QUEUE_LENGTH && !ws.lagging(), "broadcast to a lagging client");
+    }
+}
+
+int main() {
+    char folder[] = "/tmp/playercoreXXXXXX";
+    if (!mkdtemp(folder)) return 1;
+    FFat.setRoot(folder);
+
+    benchUtf8();
+    benchPlaylist();
+    benchJournal();
+    benchFavorites();
+    benchLineParser();
+    benchCommands();
+    benchSnapshot();
+    benchBroadcast();
+
+    FFat.remove("/playlist.jnl");
+    FFat.remove("/favorites.log");
+    rmdir(folder);
+    return _failures ? 1 : 0;
+}
@@ -1,3 +1,19 @@
+/* percentEncode() as the sketch had it before utf8Sanitize.ino replaced it - the baseline of the utf8Sanitize benchmarks.
+   Built with -funsigned-char like the esp32 toolchain, so its lead byte cases match.
+   It warns about every byte it does not know - that would flood the benchmark output. */
+
+#include <Arduino.h>
+#include "percentEncode.h"
+
+#undef log_w
+#define log_w(format, ...) \
+    do { \
+    } while (0)
+#undef log_e
+#define log_e(format, ...) \
+    do { \
+    } while (0)
+
 // https://www.w3schools.com/tags/ref_urlencode.asp
 
 // https://www.fon.hum.uva.nl/praat/manual/Special_symbols.html
@@ -0,0 +1,7 @@
+#ifndef __HOST_PERCENTENCODE_H
+#define __HOST_PERCENTENCODE_H
+
+/* the sanitizer before utf8Sanitize - only built for the benchmark */
+String percentEncode(const char* plaintext);
+
+#endif
@@ -0,0 +1,166 @@
+#ifndef __HOST_ARDUINO_H
+#define __HOST_ARDUINO_H
+
+/* The parts of the esp32 Arduino core that the player core uses - enough to build it on a pc.
+   Nothing here is meant to behave like the esp32 beyond what the core needs. */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <strings.h>
+#include <stdarg.h>
+#include <algorithm>
+#include <string>
+
+using std::max;
+using std::min;
+
+#define ARDUHAL_LOG_LEVEL_DEBUG 4
+#ifndef CORE_DEBUG_LEVEL
+#define CORE_DEBUG_LEVEL 0
+#endif
+
+#define log_e(format, ...) fprintf(stderr, "[E] " format "\n", ##__VA_ARGS__)
+#define log_w(format, ...) fprintf(stderr, "[W] " format "\n", ##__VA_ARGS__)
+#define log_i(format, ...) \
+    do { \
+    } while (0)
+#define log_d(format, ...) \
+    do { \
+    } while (0)
+
+unsigned long millis();
+unsigned long micros();
+
+/* the board has PSRAM - so the playlist takes PLAYLIST_MAX_ITEMS_PSRAM items */
+inline bool psramFound() {
+    return true;
+}
+#define MALLOC_CAP_8BIT (1 << 2)
+#define MALLOC_CAP_SPIRAM (1 << 10)
+inline void* heap_caps_malloc(const size_t size, const uint32_t) {
+    return malloc(size);
+}
+inline void heap_caps_free(void* data) {
+    free(data);
+}
+
+/* one task - a mutex is never contended */
+typedef void* SemaphoreHandle_t;
+#define portMAX_DELAY 0xFFFFFFFF
+inline SemaphoreHandle_t xSemaphoreCreateMutex() {
+    static int mutex;
+    return &mutex;
+}
+inline int xSemaphoreTake(SemaphoreHandle_t, const uint32_t) {
+    return 1;
+}
+inline int xSemaphoreGive(SemaphoreHandle_t) {
+    return 1;
+}
+inline SemaphoreHandle_t xSemaphoreCreateRecursiveMutex() {
+    return xSemaphoreCreateMutex();
+}
+inline int xSemaphoreTakeRecursive(SemaphoreHandle_t, const uint32_t) {
+    return 1;
+}
+inline int xSemaphoreGiveRecursive(SemaphoreHandle_t) {
+    return 1;
+}
+
+class String {
+
+  public:
+    String(const char* s = "")
+      : _s(s) {}
+    String(const std::string& s)
+      : _s(s) {}
+    explicit String(const unsigned long value)
+      : _s(std::to_string(value)) {}
+
+    const char* c_str() const {
+        return _s.c_str();
+    }
+    unsigned int length() const {
+        return _s.length();
+    }
+    bool reserve(const unsigned int size) {
+        _s.reserve(size);
+        return true;
+    }
+    bool equals(const String& s) const {
+        return _s == s._s;
+    }
+    bool equals(const char* s) const {
+        return _s == s;
+    }
+    bool startsWith(const char* s) const {
+        return !_s.compare(0, strlen(s), s);
+    }
+    int indexOf(const char c, const unsigned int from = 0) const {
+        const size_t i = _s.find(c, from);
+        return i == std::string::npos ? -1 : i;
+    }
+    String substring(const unsigned int from, const unsigned int to) const {
+        return String(_s.substr(from, to - from));
+    }
+
+    bool concat(const String& s) {
+        _s += s._s;
+        return true;
+    }
+    bool concat(const char* s) {
+        _s += s;
+        return true;
+    }
+    bool concat(const char* s, const unsigned int length) {
+        _s.append(s, length);
+        return true;
+    }
+    bool concat(const char c) {
+        _s += c;
+        return true;
+    }
+    bool concat(const int value) {
+        _s += std::to_string(value);
+        return true;
+    }
+    bool concat(const unsigned int value) {
+        _s += std::to_string(value);
+        return true;
+    }
+    bool concat(const long value) {
+        _s += std::to_string(value);
+        return true;
+    }
+    bool concat(const unsigned long value) {
+        _s += std::to_string(value);
+        return true;
+    }
+
+    String& operator+=(const String& s) {
+        concat(s);
+        return *this;
+    }
+    String& operator+=(const char* s) {
+        concat(s);
+        return *this;
+    }
+    friend String operator+(const String& a, const String& b) {
+        return String(a._s + b._s);
+    }
+    friend String operator+(const String& a, const char* b) {
+        return String(a._s + b);
+    }
+    bool operator==(const String& s) const {
+        return _s == s._s;
+    }
+
+  private:
+    std::string _s;
+};
+
+#endif
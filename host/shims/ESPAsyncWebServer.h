@@ -0,0 +1,90 @@
+#ifndef __HOST_ESPASYNCWEBSERVER_H
+#define __HOST_ESPASYNCWEBSERVER_H
+
+/* The websocket parts of ESPAsyncWebServer that broadcastSocket uses.
+   A client keeps its queued messages until drain() - that is where a real client would send them. */
+
+#include <Arduino.h>
+#include <memory>
+#include <vector>
+
+enum AwsClientStatus { WS_DISCONNECTED,
+                       WS_CONNECTED };
+
+class AsyncWebSocketClient {
+
+  public:
+    AsyncWebSocketClient(const uint32_t id)
+      : _id(id) {}
+
+    uint32_t id() const {
+        return _id;
+    }
+    AwsClientStatus status() const {
+        return WS_CONNECTED;
+    }
+    size_t queueLen() const {
+        return _queue.size();
+    }
+    bool queueIsFull() const {
+        return _queue.size() >= 8;
+    }
+
+    /* a message to one client is its own copy - like text() of ESPAsyncWebServer */
+    void text(const char* message) {
+        text(std::make_shared<std::string>(message));
+    }
+    void text(const String& message) {
+        text(message.c_str());
+    }
+    void text(const std::shared_ptr<std::string>& message) {
+        _queue.push_back(message);
+        _bytes += message->size();
+    }
+
+    /* sends 'count' queued messages */
+    void drain(const size_t count) {
+        _queue.erase(_queue.begin(), _queue.begin() + std::min(count, _queue.size()));
+    }
+    size_t bytes() const {
+        return _bytes;
+    }
+
+  private:
+    uint32_t _id;
+    std::vector<std::shared_ptr<std::string>> _queue;
+    size_t _bytes{ 0 };
+};
+
+class AsyncWebSocket {
+
+  public:
+    AsyncWebSocket(const String&) {}
+
+    /* the clients are owned by the caller */
+    void addClient(AsyncWebSocketClient* client) {
+        _clients.push_back(client);
+    }
+    const std::vector<AsyncWebSocketClient*>& getClients() const {
+        return _clients;
+    }
+    AsyncWebSocketClient* client(const uint32_t id) {
+        for (auto& client : _clients)
+            if (client->id() == id) return client;
+        return nullptr;
+    }
+    size_t count() const {
+        return _clients.size();
+    }
+
+    /* one message buffer shared by all clients - like textAll() of ESPAsyncWebServer */
+    void textAll(const char* message) {
+        const auto shared = std::make_shared<std::string>(message);
+        for (auto& client : _clients) client->text(shared);
+    }
+
+  private:
+    std::vector<AsyncWebSocketClient*> _clients;
+};
+
+#endif
@@ -0,0 +1,73 @@
+#ifndef __HOST_FFAT_H
+#define __HOST_FFAT_H
+
+/* FFat on a folder of the pc - setRoot() picks the folder, paths are relative to it. */
+
+#include <Arduino.h>
+#include <memory>
+#include <vector>
+
+#define FILE_READ "r"
+#define FILE_WRITE "w"
+#define FILE_APPEND "a"
+
+class File {
+
+  public:
+    File() {}
+    explicit operator bool() const {
+        return _file || _folder;
+    }
+
+    size_t size() const;
+    const char* name() const {
+        return _name.c_str();
+    }
+    const char* path() const {
+        return _path.c_str();
+    }
+    bool isDirectory() const {
+        return (bool)_folder;
+    }
+    File openNextFile();
+    void close();
+
+    size_t read(uint8_t* buffer, const size_t length);
+    size_t write(const uint8_t* buffer, const size_t length);
+    bool seek(const uint32_t position);
+    size_t readBytesUntil(const char terminator, char* buffer, const size_t length);
+
+  private:
+    friend class hostFat;
+    std::shared_ptr<FILE> _file;
+    std::shared_ptr<std::vector<std::string>> _folder; /* names in a folder - openNextFile() takes them in order */
+    size_t _next{ 0 };
+    std::string _path;
+    std::string _name;
+};
+
+class hostFat {
+
+  public:
+    void setRoot(const char* root) {
+        _root = root;
+    }
+
+    File open(const String& path, const char* mode = FILE_READ) {
+        return open(path.c_str(), mode);
+    }
+    File open(const char* path, const char* mode = FILE_READ);
+    bool exists(const char* path);
+    bool remove(const char* path);
+    bool rename(const char* from, const char* to);
+
+  private:
+    std::string full(const char* path) const {
+        return _root + path;
+    }
+    std::string _root{ "." };
+};
+
+extern hostFat FFat;
+
+#endif
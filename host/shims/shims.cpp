@@ -0,0 +1,93 @@
+#include <Arduino.h>
+#include <FFat.h>
+#include <chrono>
+#include <dirent.h>
+#include <sys/stat.h>
+
+static const auto _start = std::chrono::steady_clock::now();
+
+unsigned long millis() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - _start).count();
+}
+
+unsigned long micros() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - _start).count();
+}
+
+hostFat FFat;
+
+size_t File::size() const {
+    if (!_file) return 0;
+    struct stat status;
+    return fstat(fileno(_file.get()), &status) ? 0 : status.st_size;
+}
+
+File File::openNextFile() {
+    if (!_folder || _next >= _folder->size()) return File();
+    const std::string folder = (_path == "/") ? _path : _path + "/";
+    return FFat.open((folder + (*_folder)[_next++]).c_str());
+}
+
+void File::close() {
+    _file.reset();
+    _folder.reset();
+}
+
+size_t File::read(uint8_t* buffer, const size_t length) {
+    return _file ? fread(buffer, 1, length, _file.get()) : 0;
+}
+
+size_t File::write(const uint8_t* buffer, const size_t length) {
+    if (!_file) return 0;
+    const size_t written = fwrite(buffer, 1, length, _file.get());
+    fflush(_file.get());
+    return written;
+}
+
+bool File::seek(const uint32_t position) {
+    return _file && !fseek(_file.get(), position, SEEK_SET);
+}
+
+size_t File::readBytesUntil(const char terminator, char* buffer, const size_t length) {
+    size_t used = 0;
+    int c;
+    while (_file && used < length && (c = fgetc(_file.get())) != EOF && c != terminator) buffer[used++] = c;
+    return used;
+}
+
+File hostFat::open(const char* path, const char* mode) {
+    File file;
+    file._path = path;
+    const char* slash = strrchr(path, '/');
+    file._name = slash ? slash + 1 : path;
+
+    struct stat status;
+    if (!strcmp(mode, FILE_READ) && !stat(full(path).c_str(), &status) && S_ISDIR(status.st_mode)) {
+        DIR* folder = opendir(full(path).c_str());
+        if (!folder) return File();
+        file._folder = std::make_shared<std::vector<std::string>>();
+        while (const dirent* entry = readdir(folder))
+            if (entry->d_name[0] != '.') file._folder->push_back(entry->d_name);
+        closedir(folder);
+        std::sort(file._folder->begin(), file._folder->end());
+        return file;
+    }
+    const char* hostMode = !strcmp(mode, FILE_READ) ? "rb" : !strcmp(mode, FILE_WRITE) ? "wb" : "ab";
+    FILE* handle = fopen(full(path).c_str(), hostMode);
+    if (!handle) return File();
+    file._file = std::shared_ptr<FILE>(handle, fclose);
+    return file;
+}
+
+bool hostFat::exists(const char* path) {
+    struct stat status;
+    return !stat(full(path).c_str(), &status);
+}
+
+bool hostFat::remove(const char* path) {
+    return !::remove(full(path).c_str());
+}
+
+bool hostFat::rename(const char* from, const char* to) {
+    return !::rename(full(from).c_str(), full(to).c_str());
+}
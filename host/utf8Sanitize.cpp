@@ -0,0 +1,5 @@
+#include <Arduino.h>
+#include "utf8Sanitize.h"
+
+/* the sketch tab as the Arduino builder sees it - after the prototypes */
+#include "../utf8Sanitize.ino"
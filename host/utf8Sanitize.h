@@ -0,0 +1,8 @@
+#ifndef __HOST_UTF8SANITIZE_H
+#define __HOST_UTF8SANITIZE_H
+
+/* the prototypes the Arduino builder generates for utf8Sanitize.ino */
+size_t utf8Sanitize(const char* in, char* out, const size_t size);
+size_t utf8Sanitize(const char* in, const size_t length, char* out, const size_t size);
+
+#endif
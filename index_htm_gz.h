@@ -1,794 +0,0 @@
-const unsigned char index_htm_gz[] = {
-  0x1f, 0x8b, 0x08, 0x08, 0x34, 0x88, 0x39, 0x64, 0x00, 0x03, 0x69, 0x6e,
-  0x64, 0x65, 0x78, 0x2e, 0x68, 0x74, 0x6d, 0x00, 0xc4, 0x3c, 0x69, 0x77,
-  0xdb, 0x36, 0xb6, 0xdf, 0xf3, 0x2b, 0x10, 0xe6, 0x4d, 0x25, 0xa5, 0x22,
-  0x25, 0x4a, 0xb2, 0x23, 0xcb, 0x4b, 0xc6, 0x75, 0xdc, 0xda, 0x67, 0x9c,
-  0x38, 0xc7, 0x4e, 0xd3, 0x37, 0x27, 0xd3, 0x93, 0x03, 0x91, 0x90, 0xc8,
-  0x98, 0x22, 0x39, 0x04, 0x25, 0xd9, 0xc9, 0xf8, 0xbf, 0xbf, 0x7b, 0x01,
-  0x90, 0x04, 0x17, 0xc9, 0xf6, 0x34, 0xed, 0x4b, 0x9b, 0x88, 0xc2, 0x72,
-  0xf7, 0x0d, 0x20, 0xa0, 0x83, 0xe7, 0x6e, 0xe4, 0xa4, 0x77, 0x31, 0x23,
-  0x5e, 0xba, 0x08, 0x8e, 0x9e, 0x1d, 0xe0, 0x07, 0x09, 0x68, 0x38, 0x3f,
-  0x34, 0x58, 0x68, 0x1c, 0x3d, 0x83, 0x16, 0x46, 0xdd, 0xa3, 0x67, 0x84,
-  0x1c, 0x70, 0x27, 0xf1, 0xe3, 0x14, 0x1f, 0x09, 0xe9, 0xf5, 0x38, 0x4b,
-  0x53, 0x3f, 0x9c, 0x93, 0x59, 0x94, 0x10, 0x97, 0xad, 0x7a, 0x2e, 0x9b,
-  0x2e, 0xe7, 0xe4, 0x65, 0x4f, 0x74, 0x3b, 0x51, 0xc8, 0x53, 0x22, 0x9a,
-  0xfc, 0x98, 0x1c, 0x12, 0xc3, 0xde, 0x1b, 0x58, 0xf6, 0xee, 0xd8, 0xea,
-  0x5b, 0x76, 0xdf, 0x36, 0xf6, 0x11, 0x80, 0xe3, 0x01, 0x16, 0x46, 0x52,
-  0xcf, 0xe7, 0x24, 0x8d, 0xe0, 0x93, 0x11, 0xc6, 0xe3, 0xe1, 0x80, 0xc0,
-  0x0c, 0x04, 0x9a, 0xb0, 0x45, 0x94, 0x32, 0x92, 0x2c, 0xc3, 0x10, 0xf1,
-  0x44, 0x33, 0x39, 0x34, 0xa6, 0x73, 0x86, 0xd4, 0xf4, 0x0a, 0x72, 0x0e,
-  0x16, 0x2c, 0xa5, 0x04, 0xe0, 0x25, 0x40, 0xd4, 0xa1, 0xb1, 0x4c, 0x67,
-  0xe6, 0xd8, 0x28, 0x3a, 0x42, 0xba, 0x60, 0x87, 0xc6, 0xca, 0x67, 0xeb,
-  0x38, 0x4a, 0x52, 0x03, 0x89, 0x4b, 0x59, 0x08, 0x03, 0x17, 0x7e, 0xe8,
-  0x2f, 0x68, 0x60, 0x2e, 0xfd, 0xee, 0xda, 0x77, 0x53, 0xef, 0x10, 0xf8,
-  0xf0, 0x1d, 0x66, 0x8a, 0x2f, 0x5d, 0xe8, 0x4c, 0x7d, 0xe8, 0xe5, 0x0e,
-  0x0d, 0xd8, 0xa1, 0x2d, 0x01, 0x06, 0x7e, 0x78, 0x03, 0x94, 0x05, 0x87,
-  0x86, 0x0f, 0x60, 0x0c, 0xe2, 0x25, 0x6c, 0x76, 0x68, 0xb8, 0x34, 0xa5,
-  0x93, 0xfd, 0x29, 0xe5, 0x6c, 0x77, 0xd4, 0xf5, 0x3f, 0xfe, 0x74, 0x79,
-  0xb5, 0xee, 0xff, 0xe3, 0x97, 0x79, 0x74, 0x68, 0x1c, 0x1d, 0x3c, 0x37,
-  0xcd, 0x38, 0x61, 0x2b, 0x40, 0x48, 0x66, 0x74, 0x85, 0xb3, 0x60, 0xfe,
-  0xbf, 0x97, 0x8c, 0xa7, 0xdc, 0x34, 0x0b, 0x98, 0x12, 0x90, 0x97, 0xa6,
-  0x31, 0x9f, 0xf4, 0x7a, 0x33, 0x20, 0x91, 0x5b, 0xf3, 0x28, 0x9a, 0x07,
-  0x8c, 0xc6, 0x3e, 0xb7, 0x9c, 0x68, 0xd1, 0x73, 0x38, 0x7f, 0x3d, 0xa3,
-  0x0b, 0x3f, 0xb8, 0x3b, 0xbc, 0x8a, 0xa6, 0x51, 0x1a, 0x19, 0x92, 0x12,
-  0x9e, 0xde, 0x05, 0x8c, 0x7b, 0x8c, 0xa5, 0x86, 0xa6, 0x27, 0xc2, 0x13,
-  0xa7, 0x00, 0xe8, 0x44, 0x2e, 0xb3, 0xbe, 0x00, 0xda, 0xe4, 0x4e, 0xc0,
-  0x92, 0x8f, 0xe6, 0xd0, 0x1a, 0x59, 0xb6, 0xf5, 0x85, 0x03, 0x9d, 0xba,
-  0x3c, 0x53, 0x3f, 0x0d, 0xd8, 0x11, 0xbb, 0x4e, 0x13, 0x46, 0x17, 0xef,
-  0x03, 0x7a, 0xc7, 0x92, 0xe1, 0xe0, 0xa0, 0x27, 0x9b, 0x2b, 0x72, 0x75,
-  0x99, 0x9c, 0xe8, 0xa3, 0x38, 0x72, 0xd1, 0x56, 0xe6, 0x12, 0x1f, 0xda,
-  0x93, 0x19, 0x75, 0x58, 0x4d, 0x2f, 0x74, 0x99, 0x7a, 0x51, 0xa2, 0x4d,
-  0x3d, 0x61, 0x41, 0xe0, 0x33, 0x9d, 0x95, 0xa3, 0xe7, 0xb3, 0x65, 0xe8,
-  0x20, 0x06, 0xd2, 0xa6, 0x5d, 0x32, 0xed, 0x90, 0x6f, 0xc4, 0xc8, 0x9a,
-  0x0c, 0x72, 0x78, 0x48, 0xd0, 0x82, 0xc1, 0x40, 0x5c, 0x36, 0xf3, 0x43,
-  0x46, 0x7e, 0xf8, 0x41, 0x3d, 0x59, 0x74, 0xe1, 0x92, 0xd7, 0xea, 0x4b,
-  0xfb, 0xd3, 0xef, 0x62, 0xee, 0x84, 0x18, 0xcb, 0x50, 0x36, 0xb9, 0x06,
-  0x79, 0x9e, 0x4f, 0x5e, 0x44, 0xee, 0x32, 0x10, 0x93, 0xe5, 0x93, 0xc5,
-  0x6e, 0xd1, 0x5e, 0x38, 0x00, 0xa8, 0x34, 0x1c, 0x92, 0x69, 0x1b, 0xe1,
-  0x50, 0xeb, 0x8a, 0x01, 0xd9, 0x21, 0x73, 0xd0, 0x13, 0x7e, 0x63, 0xd3,
-  0xeb, 0xc8, 0xb9, 0x61, 0xa9, 0xea, 0xbf, 0x6f, 0xa3, 0xbd, 0x76, 0x49,
-  0x41, 0x3b, 0xd2, 0x9d, 0x7f, 0xa3, 0xed, 0x69, 0x97, 0x38, 0x5d, 0xe2,
-  0x96, 0x5a, 0x83, 0x9c, 0xc1, 0x15, 0x4d, 0x88, 0x03, 0xa0, 0xc0, 0x3f,
-  0x97, 0x0b, 0x10, 0x8c, 0xe5, 0x80, 0x40, 0x53, 0x76, 0x8a, 0x96, 0xd4,
-  0x36, 0x4e, 0x96, 0x3c, 0x8d, 0x16, 0xe2, 0x8b, 0xd1, 0xd9, 0x07, 0x3b,
-  0x48, 0x97, 0x49, 0x48, 0x1c, 0x0b, 0x8d, 0x56, 0xeb, 0x43, 0x68, 0xcf,
-  0x6d, 0xf9, 0x77, 0xda, 0x01, 0x7c, 0xe4, 0x5e, 0x00, 0x66, 0x00, 0xf8,
-  0x9b, 0xf4, 0xcf, 0x89, 0xe8, 0x04, 0x2d, 0x44, 0x0b, 0x9a, 0xfa, 0xce,
-  0x65, 0xcc, 0x42, 0x68, 0xea, 0x77, 0x01, 0xa6, 0xe2, 0xed, 0x1c, 0x75,
-  0xb7, 0xa2, 0xc1, 0x84, 0xd8, 0x6c, 0xd8, 0x25, 0x0b, 0x7a, 0x7b, 0x55,
-  0xef, 0x1a, 0xb2, 0x91, 0x36, 0xe5, 0x0d, 0x73, 0xe8, 0x1d, 0x8c, 0xb7,
-  0x76, 0xba, 0x24, 0xf5, 0x17, 0x2c, 0x5a, 0x6a, 0x43, 0x07, 0x6c, 0x48,
-  0xee, 0xf7, 0x89, 0x4b, 0xfe, 0xf3, 0x1f, 0xd2, 0x76, 0x91, 0x92, 0x7b,
-  0x60, 0x01, 0x5d, 0xbe, 0x8d, 0xb4, 0xcd, 0xc0, 0x58, 0x08, 0xeb, 0x08,
-  0x6f, 0xff, 0x34, 0xfb, 0x1d, 0xa3, 0x47, 0xa3, 0xbe, 0x5c, 0xec, 0x7c,
-  0x2d, 0x3f, 0x26, 0x84, 0xc1, 0xc7, 0xbe, 0x98, 0x63, 0x2d, 0x93, 0x00,
-  0x55, 0xd0, 0x95, 0xdf, 0x72, 0x9a, 0x8e, 0xd3, 0x94, 0x2d, 0x62, 0xa1,
-  0xbe, 0x7e, 0xde, 0x47, 0xdd, 0xbb, 0xeb, 0x14, 0xc4, 0x0a, 0x8d, 0xb9,
-  0xfe, 0xac, 0x93, 0xcb, 0x77, 0xef, 0x4e, 0x4f, 0x3e, 0x9c, 0xbf, 0xfb,
-  0x45, 0x8d, 0x8b, 0x13, 0xf0, 0x36, 0x27, 0x42, 0xb0, 0xe1, 0x32, 0x08,
-  0xf6, 0x85, 0x0c, 0xbd, 0x2e, 0x99, 0x43, 0x83, 0x54, 0xb2, 0x0f, 0x4f,
-  0x28, 0xc7, 0x2f, 0xea, 0xf3, 0xa6, 0x41, 0x73, 0x01, 0x5b, 0x08, 0xdd,
-  0xb9, 0xfe, 0x0a, 0x75, 0x76, 0x63, 0x51, 0xd7, 0x15, 0x5a, 0xba, 0xf0,
-  0x39, 0x98, 0x3e, 0x4b, 0xda, 0x46, 0x04, 0xd2, 0x37, 0x74, 0x93, 0xa1,
-  0x68, 0x0a, 0x73, 0x2b, 0x0a, 0xb1, 0x07, 0xbf, 0xdd, 0x83, 0x16, 0x9b,
-  0x66, 0x3a, 0x41, 0xc4, 0x59, 0xf3, 0x54, 0xd1, 0xb5, 0x75, 0x6e, 0x6e,
-  0xc3, 0x1b, 0x00, 0xe4, 0xfd, 0xdb, 0xa0, 0x2c, 0x18, 0xe7, 0x10, 0x9b,
-  0x9b, 0x41, 0xa8, 0xce, 0x6d, 0xf3, 0x59, 0x92, 0x40, 0x1c, 0x68, 0x9c,
-  0x2d, 0xba, 0xb2, 0xb9, 0x42, 0x23, 0xd5, 0xe9, 0x20, 0xee, 0x3a, 0x4c,
-  0x6b, 0xea, 0x87, 0x6e, 0xfb, 0xa6, 0x93, 0x6b, 0x7b, 0x11, 0xad, 0x58,
-  0x7d, 0x5a, 0x43, 0x7b, 0x65, 0xa6, 0xeb, 0xf3, 0x98, 0xa6, 0x8e, 0x27,
-  0xc6, 0x88, 0x39, 0xa5, 0x96, 0xca, 0x68, 0x54, 0x15, 0x0c, 0x2a, 0xf8,
-  0x10, 0xfe, 0xec, 0xa1, 0xf1, 0xb0, 0x75, 0x61, 0x66, 0xed, 0x39, 0x5a,
-  0x2a, 0xfa, 0x24, 0xf8, 0xc1, 0xa7, 0xdf, 0x61, 0xf6, 0x14, 0x9f, 0x2a,
-  0xb0, 0xdb, 0x41, 0x49, 0x3f, 0x1d, 0x18, 0x06, 0x13, 0x65, 0xb2, 0x85,
-  0xd1, 0x54, 0x3e, 0x1e, 0x07, 0x41, 0x07, 0x23, 0x17, 0xe6, 0xdd, 0x08,
-  0x22, 0x95, 0x68, 0x6c, 0x1b, 0x8d, 0xe1, 0x09, 0x44, 0x6c, 0x50, 0xe9,
-  0x0b, 0xa6, 0xea, 0x86, 0x26, 0x41, 0x4c, 0x47, 0x5a, 0x36, 0xfa, 0x24,
-  0x58, 0x37, 0x3a, 0x05, 0x24, 0xd4, 0x0f, 0xd2, 0x7f, 0xdb, 0xe5, 0x38,
-  0xf6, 0x1d, 0x88, 0xc8, 0x9a, 0xa3, 0xd0, 0x54, 0x31, 0x22, 0xa7, 0x43,
-  0x39, 0x12, 0xf8, 0xa9, 0x6b, 0x49, 0xf3, 0xcd, 0x9a, 0x6c, 0x72, 0x8f,
-  0x83, 0x2a, 0x41, 0x05, 0x08, 0xf7, 0x94, 0x93, 0x94, 0x24, 0x8f, 0x94,
-  0x3a, 0x90, 0x42, 0x93, 0x8c, 0x09, 0xf6, 0x7d, 0xe4, 0x27, 0x51, 0x69,
-  0xe4, 0xce, 0xf5, 0x18, 0xe1, 0xe5, 0x5f, 0xb0, 0x63, 0x43, 0x90, 0xb9,
-  0x7c, 0x7f, 0xfa, 0x4e, 0x76, 0x37, 0xc4, 0xa7, 0x42, 0x0f, 0x81, 0x0a,
-  0x0a, 0xc0, 0xa1, 0x6b, 0xf9, 0x3c, 0xa7, 0x48, 0x46, 0xb8, 0x69, 0x16,
-  0x6e, 0x2a, 0x46, 0x03, 0x49, 0x05, 0xc4, 0xe4, 0x65, 0xce, 0x5f, 0x92,
-  0x89, 0x83, 0x42, 0xf1, 0x67, 0xf0, 0x50, 0x15, 0x8c, 0xa7, 0xe2, 0x1b,
-  0x84, 0xb3, 0xce, 0x66, 0xc2, 0x4f, 0x2e, 0x2e, 0xaf, 0x4f, 0xdf, 0xd4,
-  0x71, 0x06, 0x59, 0x10, 0xea, 0x00, 0xad, 0x2c, 0x00, 0xac, 0xdf, 0xb6,
-  0x00, 0xc9, 0x43, 0x6c, 0x89, 0x55, 0xdd, 0xd2, 0x91, 0x61, 0x2c, 0x5b,
-  0xa0, 0xc7, 0x11, 0x0f, 0x68, 0x0c, 0x00, 0x8e, 0x47, 0xa1, 0x68, 0x92,
-  0x8f, 0xd8, 0xb8, 0xa6, 0xfc, 0x04, 0x78, 0x91, 0xcd, 0xd9, 0x97, 0x26,
-  0xa1, 0x28, 0x17, 0xfb, 0x22, 0x32, 0xcf, 0x77, 0x31, 0x83, 0x2c, 0xec,
-  0x66, 0x76, 0xb0, 0x45, 0x28, 0xca, 0xb9, 0x90, 0x1f, 0x4d, 0xeb, 0x99,
-  0x05, 0x93, 0x97, 0xe4, 0x2d, 0x4d, 0xc1, 0x72, 0xa2, 0x75, 0x5b, 0xeb,
-  0x16, 0x89, 0xb4, 0xd1, 0x4c, 0x00, 0xdc, 0x46, 0xe7, 0x6c, 0x18, 0xfe,
-  0xe3, 0x8f, 0x08, 0x45, 0x64, 0x91, 0xe7, 0x7d, 0x61, 0x1d, 0x8c, 0x1c,
-  0x41, 0x4b, 0x53, 0x36, 0x87, 0xac, 0xba, 0xa1, 0x63, 0x82, 0x89, 0xf9,
-  0x3e, 0xb3, 0x2d, 0x15, 0xd4, 0xeb, 0xb1, 0xee, 0xbb, 0x88, 0xb6, 0xc8,
-  0x27, 0x2a, 0x50, 0x4e, 0x2d, 0xac, 0xb3, 0x95, 0x18, 0x1d, 0x69, 0x30,
-  0xd9, 0x20, 0x68, 0x75, 0x44, 0x37, 0xfa, 0x85, 0x78, 0xa8, 0xeb, 0xc2,
-  0xc9, 0x9d, 0x42, 0xe4, 0x93, 0x3f, 0x89, 0xec, 0x2c, 0x8d, 0x65, 0x44,
-  0x37, 0x1b, 0x85, 0x1c, 0xd5, 0x51, 0xc2, 0xb4, 0x45, 0x0d, 0x2b, 0xf2,
-  0x9a, 0x5e, 0x87, 0x21, 0xe2, 0x3c, 0xa3, 0xb4, 0x9f, 0xdb, 0x59, 0x82,
-  0xe1, 0x2c, 0x74, 0xeb, 0xd4, 0xa3, 0x4b, 0x7b, 0x9d, 0xac, 0x14, 0xfc,
-  0x0e, 0xbc, 0x20, 0x9a, 0x32, 0x23, 0x9e, 0x40, 0x0d, 0xe8, 0xb0, 0xd2,
-  0x4a, 0xa2, 0x35, 0x31, 0xce, 0xdf, 0x7d, 0x3c, 0xbe, 0x38, 0x7f, 0xf3,
-  0xf9, 0xfa, 0xc3, 0xf1, 0x87, 0xd3, 0xcf, 0xa7, 0x57, 0x57, 0x60, 0x22,
-  0xef, 0xe9, 0x92, 0xe3, 0x8a, 0x0d, 0x16, 0x75, 0xb9, 0x19, 0x92, 0x35,
-  0x9b, 0x72, 0x09, 0x19, 0x19, 0x16, 0x6c, 0xd4, 0x43, 0x53, 0x5e, 0xdc,
-  0x6b, 0x05, 0x5f, 0x51, 0xdd, 0x53, 0x24, 0xbe, 0x8d, 0x1a, 0x86, 0x3a,
-  0xb4, 0xa3, 0x6a, 0xae, 0x3e, 0x86, 0x2d, 0x68, 0xf7, 0x54, 0x9e, 0x90,
-  0x20, 0xee, 0xf3, 0x94, 0x3f, 0x4b, 0x60, 0x69, 0x54, 0xcb, 0x09, 0xa5,
-  0x29, 0x42, 0x09, 0x99, 0xdc, 0xa8, 0x8c, 0xdd, 0x88, 0x72, 0x53, 0x42,
-  0x01, 0xe0, 0xe5, 0x51, 0x75, 0x46, 0x9a, 0x87, 0xe5, 0x62, 0x7e, 0x78,
-  0x6c, 0x93, 0x6b, 0x35, 0x0e, 0xac, 0x9b, 0x72, 0x3e, 0x2c, 0x53, 0xba,
-  0xca, 0x11, 0x54, 0x0b, 0xba, 0x1b, 0xcb, 0x5d, 0x2a, 0xf2, 0x52, 0x43,
-  0xa2, 0xa2, 0x22, 0xee, 0xd7, 0xa6, 0xca, 0xb6, 0xac, 0xfb, 0xf4, 0x4d,
-  0x63, 0xa6, 0xa0, 0x50, 0xb7, 0xed, 0x97, 0x16, 0x98, 0xb0, 0x28, 0x26,
-  0xd9, 0xd2, 0x74, 0xbd, 0x5e, 0x5b, 0xeb, 0x21, 0x77, 0xbc, 0x28, 0x0a,
-  0xe4, 0x42, 0xd7, 0x8b, 0xd6, 0x69, 0x24, 0xff, 0xfd, 0xfc, 0x85, 0x7f,
-  0x4e, 0xe9, 0x14, 0x1c, 0x83, 0xc7, 0x44, 0xad, 0x97, 0xc5, 0x7a, 0x57,
-  0x6e, 0x43, 0xbc, 0x24, 0xdf, 0xc4, 0x27, 0x21, 0xd3, 0xe8, 0xd6, 0xe4,
-  0xfe, 0x57, 0x10, 0xee, 0x04, 0x9e, 0x13, 0x97, 0x25, 0x26, 0x34, 0xed,
-  0x8b, 0xde, 0xfb, 0x67, 0xe2, 0x03, 0xb7, 0x36, 0xba, 0xcf, 0xe4, 0x60,
-  0xf7, 0x2e, 0x9f, 0x19, 0x47, 0xdc, 0x47, 0xc9, 0xc1, 0x7a, 0x0e, 0x4c,
-  0x34, 0x58, 0xa6, 0x6c, 0x5f, 0xf5, 0xa4, 0x51, 0x3c, 0x81, 0x5c, 0x9c,
-  0x63, 0x48, 0xc1, 0x37, 0xb5, 0x86, 0x80, 0xcd, 0x52, 0xed, 0x6b, 0xe2,
-  0xcf, 0x3d, 0xfd, 0xfb, 0x82, 0x26, 0x73, 0x3f, 0xd4, 0x1a, 0x62, 0xa8,
-  0x4f, 0x05, 0x7d, 0x05, 0x48, 0xea, 0xdc, 0xcc, 0x93, 0x08, 0xac, 0x7d,
-  0x42, 0x5e, 0xcc, 0x6c, 0xfc, 0x2f, 0xc7, 0xcd, 0x6e, 0x53, 0x93, 0x06,
-  0xfe, 0x1c, 0x20, 0x38, 0x0c, 0xe3, 0x6f, 0xd6, 0x83, 0x7b, 0x03, 0xa6,
-  0xdc, 0x07, 0x98, 0x90, 0x96, 0xdc, 0x09, 0x68, 0x75, 0x09, 0xa7, 0x21,
-  0x37, 0x39, 0x4b, 0xfc, 0x59, 0x36, 0x10, 0x8a, 0xda, 0x64, 0x16, 0x44,
-  0xeb, 0x09, 0xf1, 0x7c, 0xd7, 0x65, 0x61, 0x49, 0x18, 0x56, 0x08, 0x36,
-  0x1b, 0xa0, 0x67, 0x66, 0x72, 0x30, 0xc1, 0x45, 0x6f, 0xfc, 0xd4, 0x4c,
-  0xa3, 0xa5, 0xe3, 0x99, 0x0e, 0x0d, 0x02, 0x48, 0x2c, 0x13, 0x12, 0x82,
-  0x8d, 0x65, 0x10, 0x7b, 0x2f, 0x89, 0x7f, 0x79, 0x4d, 0xae, 0xe9, 0x8c,
-  0x26, 0x7e, 0xb6, 0xd7, 0x53, 0xcc, 0x5c, 0x02, 0x7a, 0x53, 0x42, 0xad,
-  0xcd, 0xab, 0xcd, 0xb9, 0x41, 0x75, 0x6c, 0x9d, 0xf2, 0x8f, 0x28, 0xc4,
-  0x5d, 0x0a, 0x30, 0xef, 0xb3, 0x0f, 0x6f, 0x2f, 0xb4, 0xa9, 0x8b, 0xe8,
-  0xeb, 0xd6, 0x89, 0x3f, 0xfb, 0xe0, 0xf7, 0xd1, 0xad, 0x3e, 0x83, 0x6f,
-  0x9d, 0x20, 0xf2, 0x5b, 0x08, 0x2b, 0xf7, 0xd3, 0xdb, 0x38, 0x88, 0x12,
-  0x96, 0xf4, 0x4e, 0x5d, 0x70, 0xbe, 0x7c, 0xfe, 0xb6, 0xb9, 0xef, 0xa0,
-  0x7c, 0x8d, 0x01, 0x9f, 0x7f, 0xcb, 0x5c, 0x02, 0x12, 0xe7, 0x60, 0x4a,
-  0x5d, 0x67, 0x99, 0x24, 0xa0, 0xb4, 0xe0, 0x8e, 0xf0, 0x65, 0x8c, 0x9b,
-  0x06, 0xd0, 0x37, 0xbd, 0x23, 0x27, 0x10, 0x34, 0x17, 0x8c, 0x50, 0x08,
-  0xdf, 0x10, 0xdf, 0x13, 0x9a, 0x61, 0x50, 0x3a, 0xa1, 0xb9, 0x2e, 0xa0,
-  0x74, 0x8c, 0x12, 0x30, 0xe4, 0x00, 0x0c, 0xa4, 0x64, 0x11, 0x2e, 0x04,
-  0xd4, 0x84, 0x4a, 0x73, 0x2d, 0x08, 0x51, 0xf3, 0x5f, 0x04, 0x91, 0x23,
-  0xfa, 0xa6, 0x90, 0x20, 0xbf, 0x6d, 0x32, 0xc3, 0xb5, 0xe7, 0xa7, 0xcc,
-  0x84, 0x7c, 0xe4, 0x30, 0x84, 0xb1, 0x4e, 0x68, 0x5c, 0xb7, 0x50, 0x32,
-  0x8e, 0xcb, 0xce, 0xf3, 0xc2, 0x0f, 0x67, 0xd1, 0x56, 0xb8, 0xcd, 0xe6,
-  0xb6, 0x05, 0x5f, 0x66, 0x89, 0xe0, 0xdf, 0x62, 0x5b, 0x2c, 0x83, 0xec,
-  0x31, 0xe9, 0x49, 0x83, 0x7e, 0x85, 0x06, 0x6b, 0xba, 0x04, 0x17, 0x14,
-  0xdc, 0xc9, 0xa7, 0xc2, 0xfb, 0x73, 0x47, 0x32, 0x95, 0xe8, 0x02, 0x84,
-  0x31, 0x4f, 0xd8, 0x5d, 0x46, 0x06, 0xa6, 0xe0, 0x00, 0x37, 0x25, 0x66,
-  0x01, 0xbb, 0xcd, 0x1a, 0x85, 0x83, 0x99, 0x40, 0xdf, 0x82, 0x43, 0x69,
-  0x13, 0xba, 0xb9, 0x8f, 0x05, 0x11, 0x05, 0x0a, 0xd0, 0xc3, 0x0b, 0xf7,
-  0xc7, 0xa0, 0x52, 0x56, 0x3f, 0x38, 0x48, 0x00, 0x59, 0xaa, 0xdc, 0x08,
-  0xba, 0xe7, 0x48, 0x41, 0x1c, 0xf9, 0xba, 0xdb, 0xe6, 0xf2, 0x22, 0x3b,
-  0xf1, 0x6d, 0x4d, 0xe0, 0xbb, 0xf1, 0x2d, 0x19, 0x0e, 0x8b, 0x8e, 0x34,
-  0x01, 0x77, 0x56, 0x61, 0xa9, 0x6f, 0x0d, 0x79, 0x99, 0x0a, 0xf0, 0xd1,
-  0xd8, 0x44, 0xe2, 0xcc, 0x84, 0xba, 0xfe, 0x12, 0x68, 0xd7, 0x60, 0x6a,
-  0x43, 0x44, 0x48, 0xda, 0x32, 0x46, 0x86, 0xb4, 0x32, 0xa4, 0x7e, 0xf3,
-  0x98, 0x32, 0xa8, 0xfe, 0x76, 0xbd, 0x4c, 0x3c, 0x34, 0x86, 0x2d, 0xda,
-  0x79, 0xe1, 0xba, 0x6e, 0xcd, 0x08, 0xd4, 0x0e, 0x60, 0x3e, 0x4d, 0x6c,
-  0xc3, 0x02, 0xd9, 0xfd, 0xbf, 0x55, 0x4d, 0xcc, 0x04, 0x35, 0x42, 0x36,
-  0x89, 0x82, 0xa0, 0x29, 0x5c, 0xea, 0x5a, 0x7b, 0x20, 0xb8, 0xef, 0xf4,
-  0x75, 0x99, 0xc8, 0xf8, 0xbe, 0x37, 0xaa, 0xca, 0xa9, 0xac, 0x5f, 0x3d,
-  0x68, 0xbb, 0x34, 0xb9, 0x29, 0x8c, 0x2c, 0x73, 0x95, 0xf7, 0x17, 0xc7,
-  0xff, 0xbc, 0x38, 0xbf, 0xfe, 0x90, 0x73, 0x52, 0x4d, 0x0d, 0x32, 0x73,
-  0xe4, 0x8c, 0x65, 0xf3, 0x96, 0x31, 0x6e, 0x05, 0xcb, 0x14, 0x65, 0xcd,
-  0xa2, 0x00, 0x50, 0xeb, 0x0d, 0x7e, 0xc0, 0xb4, 0xaf, 0x5c, 0x6c, 0xb0,
-  0x6a, 0x0d, 0x30, 0x19, 0xec, 0x38, 0x1b, 0x4c, 0x57, 0x51, 0x02, 0xdf,
-  0xb5, 0x7e, 0x51, 0x29, 0xa8, 0xba, 0x22, 0xc7, 0x01, 0x5c, 0x88, 0xed,
-  0xe7, 0xba, 0xaa, 0x26, 0x44, 0xf7, 0x9e, 0xa6, 0x80, 0x94, 0x59, 0xf4,
-  0x00, 0x6c, 0x37, 0x67, 0x4d, 0x64, 0x27, 0x48, 0xc4, 0x4c, 0xf7, 0x5f,
-  0xcd, 0xd0, 0x71, 0xb0, 0xad, 0x75, 0x94, 0x3c, 0xb0, 0x9c, 0xe8, 0x9e,
-  0x1c, 0x50, 0x34, 0x27, 0x0f, 0x7c, 0x9e, 0x0a, 0xa8, 0x65, 0x2b, 0xd3,
-  0x65, 0xd0, 0xc8, 0xb3, 0x43, 0x5d, 0x96, 0x4e, 0x83, 0x65, 0x25, 0xb0,
-  0x72, 0x58, 0x29, 0x3b, 0x9e, 0x1e, 0xfe, 0x1a, 0xc3, 0xc9, 0x66, 0x6b,
-  0x7b, 0xa0, 0x56, 0xc8, 0x6c, 0x6f, 0x47, 0xf3, 0xd1, 0x2c, 0x0c, 0x8e,
-  0x34, 0x69, 0x3d, 0x58, 0x53, 0x94, 0x09, 0x8e, 0x71, 0x9f, 0x27, 0xa9,
-  0x47, 0x56, 0xbb, 0x5f, 0xf8, 0x94, 0xf2, 0xb2, 0x2c, 0x87, 0x83, 0x95,
-  0x05, 0x26, 0x5d, 0x51, 0x3f, 0xa0, 0xd3, 0xa0, 0x70, 0x96, 0xed, 0xd5,
-  0x48, 0x5d, 0xdf, 0x5f, 0x4d, 0x1f, 0x4a, 0xf8, 0xdb, 0x09, 0x19, 0x96,
-  0xe8, 0xfa, 0xbb, 0xc8, 0xdd, 0xd9, 0xc6, 0x28, 0x81, 0x85, 0x85, 0xca,
-  0x9d, 0x58, 0xb5, 0xaa, 0xa9, 0x1b, 0x68, 0x2f, 0x28, 0x45, 0x10, 0x35,
-  0x0a, 0xef, 0x37, 0xe8, 0xcb, 0x0f, 0xe3, 0x65, 0x11, 0x52, 0xc0, 0xa2,
-  0x60, 0x6d, 0x45, 0x83, 0x8c, 0x97, 0x05, 0x18, 0x56, 0x01, 0xa3, 0x22,
-  0xdd, 0xcc, 0x68, 0xa4, 0x27, 0x62, 0x8a, 0x52, 0x6e, 0x53, 0xca, 0x56,
-  0x8a, 0xaa, 0x61, 0xbf, 0xae, 0x39, 0xbd, 0xed, 0x71, 0x98, 0xd1, 0x3b,
-  0xea, 0x61, 0xba, 0x16, 0xc0, 0xeb, 0x94, 0xc9, 0x88, 0x5b, 0x8a, 0x04,
-  0x7a, 0x93, 0x0a, 0x2d, 0xa5, 0x51, 0x45, 0x80, 0x29, 0x37, 0xab, 0x30,
-  0x53, 0x6a, 0x2c, 0x82, 0x4d, 0x79, 0xac, 0x16, 0x65, 0x2a, 0xb0, 0x55,
-  0x60, 0xa9, 0x64, 0x82, 0x0d, 0xb9, 0x51, 0xf7, 0xc0, 0x4a, 0xe2, 0xce,
-  0x35, 0x0a, 0xcb, 0x01, 0x9e, 0x8a, 0xea, 0x46, 0xb1, 0x24, 0x69, 0x12,
-  0xef, 0xa4, 0x4a, 0x2d, 0x58, 0xa8, 0xe4, 0x08, 0x37, 0x1b, 0x6e, 0x26,
-  0x72, 0x5b, 0x93, 0xf7, 0xa6, 0x88, 0xa3, 0x1b, 0x79, 0x4d, 0x09, 0x88,
-  0xa2, 0x56, 0x15, 0xd9, 0x8f, 0x54, 0x3d, 0x00, 0xc9, 0x68, 0xa7, 0x49,
-  0x2a, 0xcd, 0x76, 0xab, 0xbb, 0x6a, 0x25, 0x9a, 0xee, 0x6f, 0x1b, 0xdc,
-  0xf0, 0xa1, 0xda, 0xab, 0x84, 0xb6, 0x6c, 0xd7, 0x45, 0xbd, 0x52, 0x63,
-  0xf9, 0x05, 0x66, 0x6a, 0xc8, 0xbe, 0x31, 0x0d, 0x59, 0xf0, 0x88, 0x75,
-  0xd4, 0x53, 0x57, 0x4e, 0xba, 0x39, 0xf8, 0xa1, 0x07, 0x16, 0x9e, 0x96,
-  0xf1, 0xc7, 0xe2, 0xb5, 0x22, 0x9a, 0xc3, 0x92, 0xff, 0x09, 0x05, 0xa9,
-  0x04, 0xaf, 0x98, 0xac, 0x47, 0x7c, 0x3f, 0xc4, 0xa2, 0xcf, 0x9c, 0x27,
-  0xbe, 0x5b, 0x35, 0xa6, 0x4a, 0x14, 0x5e, 0x81, 0x18, 0x20, 0xdb, 0x04,
-  0xbe, 0xab, 0xf9, 0xc0, 0xf6, 0x48, 0x50, 0x8f, 0x1d, 0x4d, 0xc0, 0x4a,
-  0xbe, 0x0d, 0x16, 0x91, 0x39, 0x62, 0xa9, 0x5d, 0xd3, 0x6d, 0x16, 0x18,
-  0x20, 0xed, 0xc9, 0x0a, 0xad, 0xdb, 0xc4, 0xa9, 0x55, 0x44, 0x92, 0xed,
-  0x1e, 0x9b, 0x09, 0x0a, 0x31, 0x8b, 0x28, 0x52, 0x09, 0x16, 0x14, 0x39,
-  0xac, 0x97, 0x81, 0xaa, 0x98, 0x02, 0xe3, 0xf0, 0x5d, 0x62, 0x43, 0xa8,
-  0xd3, 0xca, 0x89, 0x0c, 0xa4, 0x0b, 0xab, 0xac, 0x94, 0x35, 0x97, 0x91,
-  0xdb, 0xe6, 0x97, 0xad, 0x26, 0x61, 0xe5, 0xf2, 0xf2, 0x05, 0x02, 0x02,
-  0x5e, 0xeb, 0xca, 0xd4, 0x2b, 0xbb, 0x3f, 0x6b, 0x27, 0x60, 0x4b, 0x81,
-  0x91, 0x57, 0x56, 0x25, 0x3b, 0x07, 0xdb, 0x05, 0xeb, 0xf4, 0xd3, 0x3b,
-  0x2c, 0xfe, 0xf7, 0xca, 0x29, 0xf4, 0x85, 0x2a, 0x5f, 0xaa, 0x1c, 0x3d,
-  0x40, 0xbc, 0xb6, 0xb6, 0x90, 0xd4, 0xda, 0x3b, 0x7f, 0xab, 0xd0, 0xab,
-  0xb5, 0x54, 0xca, 0xc0, 0xc2, 0x77, 0x1e, 0xd2, 0xc1, 0x86, 0x84, 0xa5,
-  0xc5, 0x2d, 0x3d, 0x32, 0x36, 0x68, 0x41, 0x71, 0x19, 0x27, 0x11, 0xe0,
-  0xe5, 0xbc, 0xb1, 0x48, 0x7b, 0x31, 0x9b, 0x31, 0xf8, 0xb3, 0xb9, 0x48,
-  0xaf, 0x00, 0xf9, 0xb4, 0xa2, 0x20, 0xf0, 0xdf, 0x8b, 0x9d, 0x0e, 0x51,
-  0x41, 0xc4, 0x31, 0xb8, 0x06, 0x0d, 0x9d, 0xca, 0xf2, 0x2d, 0x2b, 0x84,
-  0x36, 0xf5, 0x37, 0xb7, 0x57, 0x30, 0x4e, 0x26, 0x19, 0x98, 0xac, 0xc5,
-  0xd4, 0x8b, 0xc7, 0x8d, 0xcc, 0x3c, 0x0c, 0x46, 0xb0, 0xd2, 0xad, 0x8e,
-  0x42, 0x86, 0x1e, 0xc4, 0xa4, 0x29, 0x32, 0x0f, 0xa4, 0x6a, 0xce, 0x60,
-  0x73, 0x14, 0xad, 0xef, 0x5a, 0xa9, 0x8a, 0x67, 0xaf, 0x48, 0x4a, 0x1b,
-  0x57, 0xec, 0x39, 0x82, 0x72, 0x19, 0xa6, 0xcb, 0xb0, 0x62, 0xf8, 0x75,
-  0x50, 0x05, 0x4d, 0xb8, 0x39, 0xae, 0x11, 0x96, 0x1b, 0x7c, 0xc2, 0x02,
-  0x28, 0x0c, 0x56, 0x65, 0x83, 0x37, 0x07, 0xb6, 0x96, 0x07, 0x15, 0xc9,
-  0x76, 0xb1, 0x94, 0xcc, 0x1d, 0x2c, 0x23, 0x58, 0x9c, 0x29, 0x92, 0x5b,
-  0x8b, 0x07, 0x3d, 0x79, 0xe8, 0xe9, 0xd9, 0x81, 0xd8, 0x29, 0x74, 0x02,
-  0xca, 0xf9, 0xa1, 0x91, 0xed, 0x98, 0xc9, 0xa3, 0x29, 0x31, 0xf1, 0xdd,
-  0x43, 0x43, 0xdb, 0x71, 0x31, 0x8e, 0x7e, 0x08, 0xa7, 0x3c, 0xde, 0x3f,
-  0xe8, 0xc5, 0x62, 0x80, 0xeb, 0xaf, 0xb2, 0x99, 0xf9, 0xfa, 0xd8, 0x90,
-  0xdb, 0x96, 0x07, 0x6a, 0xfb, 0x42, 0x75, 0xc3, 0xda, 0x17, 0x6b, 0x25,
-  0x6e, 0x48, 0x90, 0xfe, 0x34, 0xa1, 0xc9, 0x9d, 0x1c, 0x62, 0x10, 0x51,
-  0xe0, 0x1c, 0x1a, 0x17, 0x80, 0x28, 0x20, 0xaa, 0x4f, 0x81, 0x01, 0x40,
-  0xfe, 0x62, 0x2e, 0x0f, 0xfa, 0xf4, 0x54, 0x17, 0xc6, 0x5d, 0x8b, 0xaf,
-  0xe6, 0x86, 0x06, 0x5c, 0x1c, 0x55, 0x52, 0x98, 0x7b, 0x12, 0xee, 0x23,
-  0xe8, 0x40, 0x27, 0x8e, 0x2a, 0x54, 0xbc, 0x07, 0x5d, 0xb2, 0x94, 0x88,
-  0xae, 0x26, 0x22, 0x44, 0xc7, 0xf7, 0x23, 0x21, 0x4b, 0x6b, 0xbc, 0x42,
-  0xc6, 0x35, 0x5d, 0x31, 0x97, 0xe4, 0xbd, 0x4d, 0x94, 0x64, 0x9d, 0xdf,
-  0x8f, 0x18, 0xb5, 0xa6, 0x28, 0x53, 0x72, 0x85, 0x0c, 0x9b, 0xd3, 0x04,
-  0x8a, 0x53, 0x86, 0x47, 0xd6, 0xf8, 0x32, 0x48, 0x1b, 0xe9, 0x91, 0xb3,
-  0x9f, 0x40, 0xcd, 0x41, 0x0f, 0x0c, 0x28, 0x37, 0x24, 0x24, 0x20, 0xdb,
-  0x56, 0xd0, 0x27, 0xab, 0x3d, 0x93, 0x6c, 0x7e, 0x9c, 0x75, 0xe9, 0x0b,
-  0x5d, 0xe3, 0xe8, 0x00, 0x8a, 0x9d, 0x82, 0x2b, 0xa8, 0x57, 0xa1, 0xa9,
-  0x20, 0x0d, 0xdf, 0x0f, 0xd6, 0xed, 0x46, 0x92, 0xf5, 0x1b, 0xf5, 0xf3,
-  0x53, 0x7e, 0x18, 0xaa, 0x71, 0x5d, 0x6d, 0x59, 0x16, 0x78, 0x0a, 0x40,
-  0x3c, 0xca, 0x4c, 0xbd, 0x46, 0xea, 0xc5, 0xf9, 0x4f, 0x57, 0xc7, 0x57,
-  0xff, 0x7c, 0x3a, 0xa5, 0x99, 0xe0, 0x80, 0x92, 0x12, 0x21, 0xe4, 0x76,
-  0x11, 0x84, 0x5c, 0x9e, 0x67, 0xcb, 0xdf, 0x19, 0x58, 0x51, 0x32, 0xef,
-  0x0d, 0xfa, 0xfd, 0x7e, 0x4f, 0x10, 0x2e, 0x43, 0xc7, 0xa1, 0x31, 0x18,
-  0x19, 0x04, 0x4f, 0xfb, 0xfd, 0x14, 0xdd, 0x1e, 0x1a, 0x7d, 0x2c, 0x60,
-  0x47, 0x04, 0xdb, 0xe4, 0x19, 0x3f, 0xec, 0xce, 0xd0, 0x20, 0x1d, 0x34,
-  0xf5, 0x08, 0x50, 0xfc, 0x16, 0x06, 0x7a, 0x83, 0xd1, 0x6a, 0x30, 0x3a,
-  0xeb, 0x7f, 0x35, 0x08, 0x2e, 0x83, 0xd1, 0xe3, 0x43, 0x66, 0x90, 0x5e,
-  0x65, 0x78, 0xfe, 0x8d, 0x88, 0x89, 0xf6, 0x1e, 0x19, 0x07, 0xe6, 0x88,
-  0x8c, 0xbc, 0xa1, 0xd3, 0x27, 0x43, 0x6b, 0x68, 0x9b, 0x03, 0x6b, 0x77,
-  0x8f, 0xec, 0x9a, 0xbb, 0xf0, 0xd7, 0xb6, 0xfa, 0x36, 0xe9, 0xc3, 0xc7,
-  0xde, 0x2b, 0xd3, 0x1a, 0xec, 0x40, 0xd7, 0xd8, 0xb4, 0x5e, 0x05, 0xd0,
-  0x30, 0xda, 0x25, 0xf8, 0xcf, 0xc9, 0x18, 0xba, 0x88, 0xbd, 0x67, 0xed,
-  0x8c, 0x20, 0x37, 0x5a, 0xa3, 0x21, 0x84, 0x3e, 0x62, 0x0f, 0xe0, 0x5f,
-  0x67, 0x64, 0x8d, 0x06, 0xb8, 0x15, 0x6b, 0x0e, 0xad, 0x9d, 0x31, 0x7c,
-  0x8c, 0xbd, 0x21, 0x20, 0x32, 0x47, 0x5f, 0xdf, 0xc2, 0xd4, 0x81, 0xd3,
-  0x37, 0x11, 0x19, 0x41, 0x64, 0x02, 0x15, 0xc2, 0x43, 0x64, 0x04, 0x91,
-  0x01, 0x2e, 0xe8, 0x19, 0x03, 0x2a, 0x44, 0x22, 0xd0, 0x9d, 0xd8, 0x3b,
-  0x56, 0x7f, 0x48, 0x46, 0x02, 0x33, 0x80, 0x7c, 0x45, 0x46, 0x88, 0x68,
-  0xe4, 0x98, 0x12, 0x91, 0x39, 0x26, 0x88, 0x08, 0x3e, 0xc6, 0x67, 0x76,
-  0x00, 0x0c, 0x11, 0xc0, 0x75, 0xb6, 0xfb, 0x55, 0x93, 0xc0, 0x01, 0x4a,
-  0xba, 0x50, 0x52, 0xcd, 0xaa, 0x74, 0x73, 0x51, 0x01, 0xa9, 0xb0, 0x16,
-  0x65, 0xe2, 0x1b, 0x4c, 0xe6, 0xb7, 0x53, 0x30, 0x99, 0x37, 0xe7, 0x97,
-  0x8d, 0x36, 0x53, 0x1f, 0xfe, 0xf3, 0xf1, 0xc7, 0xcb, 0xab, 0xf3, 0x0f,
-  0xa7, 0xd7, 0xff, 0x85, 0x37, 0x3c, 0xce, 0xf4, 0x1f, 0x60, 0x2f, 0x8f,
-  0x3e, 0x8f, 0x65, 0xf0, 0xfa, 0xf4, 0xf8, 0xea, 0xe4, 0xec, 0x0f, 0x91,
-  0xbb, 0x21, 0x88, 0x68, 0x11, 0xa4, 0x51, 0x2b, 0xbf, 0x72, 0x26, 0x8e,
-  0xd7, 0xaa, 0x75, 0x1e, 0x24, 0xd1, 0x99, 0x1f, 0xba, 0x64, 0xb1, 0xe4,
-  0xbe, 0x43, 0xf0, 0x3c, 0xaa, 0x1e, 0xc4, 0x2c, 0x5c, 0x3f, 0x3f, 0x8a,
-  0x21, 0x55, 0x81, 0x66, 0xe4, 0x7b, 0x43, 0x19, 0x26, 0x8b, 0x85, 0x3a,
-  0xea, 0xcd, 0x1b, 0xe6, 0xdc, 0x89, 0xde, 0x62, 0xd1, 0x6e, 0x64, 0xe1,
-  0x03, 0x3b, 0x8f, 0x0e, 0xf2, 0x8a, 0x0f, 0x87, 0xe5, 0x75, 0x89, 0x18,
-  0xa4, 0xbe, 0x80, 0x24, 0x44, 0x15, 0xa1, 0x0f, 0x10, 0x2d, 0x86, 0x78,
-  0x43, 0x8c, 0x19, 0x2b, 0x04, 0x81, 0xc1, 0x82, 0x2a, 0x04, 0xbf, 0x37,
-  0xea, 0xd1, 0x29, 0xd6, 0xe3, 0x38, 0x26, 0x63, 0x05, 0x50, 0xce, 0x16,
-  0xb2, 0xd2, 0x46, 0xa8, 0x0d, 0x28, 0x03, 0xe3, 0x9e, 0xc3, 0x3c, 0xb1,
-  0xce, 0x01, 0x2d, 0x4a, 0x19, 0x8a, 0x03, 0xca, 0x28, 0x36, 0xa2, 0x78,
-  0xe5, 0x95, 0xd4, 0x2e, 0x99, 0xcd, 0x17, 0x60, 0x19, 0x89, 0x59, 0xfa,
-  0xc0, 0x97, 0xc6, 0xbe, 0x73, 0x73, 0x68, 0xa8, 0x37, 0x45, 0xef, 0xe5,
-  0xcb, 0xde, 0xfe, 0xfe, 0x9c, 0xa5, 0xd7, 0x0a, 0x62, 0xbb, 0x44, 0x87,
-  0x25, 0x2b, 0x3f, 0xa2, 0x4d, 0xe8, 0xec, 0x3f, 0x21, 0xd3, 0x28, 0xa3,
-  0x2e, 0x65, 0x98, 0xb8, 0xa4, 0x4f, 0x7d, 0x55, 0x6f, 0x94, 0xb4, 0xa6,
-  0xaf, 0xb7, 0x8d, 0xfa, 0xb9, 0xe0, 0xb8, 0x6a, 0xc0, 0xa5, 0x65, 0xa5,
-  0x5e, 0x3c, 0xac, 0xfc, 0x08, 0x56, 0xec, 0xb8, 0x3b, 0x85, 0xfe, 0x55,
-  0x8d, 0xf1, 0x52, 0xb1, 0x72, 0x90, 0x12, 0x54, 0x1e, 0x6b, 0x1f, 0x11,
-  0xff, 0x8b, 0xf8, 0xfe, 0x50, 0x2a, 0x68, 0x8a, 0xff, 0x10, 0x41, 0xbd,
-  0xc1, 0xca, 0x1e, 0x40, 0xc0, 0x5b, 0x40, 0x18, 0x24, 0xbb, 0xc1, 0x18,
-  0xff, 0xfd, 0x58, 0x8a, 0x7f, 0x4f, 0x4c, 0x18, 0x5a, 0xb8, 0x7c, 0x58,
-  0x4a, 0x99, 0xa0, 0x63, 0xba, 0xe4, 0xac, 0x10, 0x1a, 0xb4, 0xf4, 0x64,
-  0xd3, 0x26, 0x89, 0x61, 0xe7, 0xff, 0x83, 0xb8, 0xec, 0x3d, 0x6f, 0xf4,
-  0x71, 0xe7, 0x6c, 0x77, 0x65, 0x8f, 0xbe, 0x2e, 0xc6, 0xa6, 0x3d, 0x82,
-  0x07, 0x6c, 0xf1, 0x20, 0x41, 0xfd, 0x45, 0x22, 0x53, 0x32, 0x7a, 0x87,
-  0x3b, 0x70, 0xdb, 0x8c, 0x2a, 0x84, 0x01, 0x99, 0xe7, 0x3d, 0x2c, 0x99,
-  0x9c, 0xf0, 0x3f, 0x2c, 0xa1, 0x31, 0xda, 0x90, 0xb9, 0x7b, 0x01, 0xb6,
-  0x05, 0x96, 0xf5, 0xf5, 0xad, 0x2d, 0x1f, 0xbc, 0xc1, 0xc7, 0x5d, 0xcf,
-  0x1c, 0xfc, 0xc5, 0x52, 0xba, 0x86, 0xc0, 0xdc, 0xf3, 0x7c, 0x17, 0xf2,
-  0x80, 0xf0, 0x5f, 0x82, 0x81, 0x7e, 0x93, 0xc4, 0xc4, 0xdb, 0xde, 0xa7,
-  0xdb, 0xd4, 0x77, 0x2b, 0xc1, 0x3e, 0x3e, 0xb5, 0x08, 0xb3, 0xc9, 0x2b,
-  0x70, 0xdf, 0x01, 0x8a, 0x75, 0xd1, 0x87, 0x5a, 0x6c, 0xb0, 0x12, 0x22,
-  0x5e, 0xd8, 0xe6, 0xde, 0xc9, 0xae, 0x35, 0x1a, 0x13, 0xa8, 0xa8, 0x88,
-  0x7a, 0xb0, 0x07, 0x7c, 0x84, 0x4f, 0x76, 0x3f, 0xff, 0xdf, 0x54, 0x0d,
-  0xa6, 0xdd, 0xbf, 0xb6, 0x5f, 0x59, 0x3b, 0x03, 0x31, 0x8c, 0x08, 0x60,
-  0xf6, 0x58, 0x54, 0x48, 0x58, 0xc6, 0x89, 0x52, 0x6c, 0x0f, 0x3e, 0xc6,
-  0x5c, 0x3e, 0x10, 0x51, 0x2e, 0x61, 0xdd, 0x04, 0x55, 0xa0, 0xac, 0xd4,
-  0xf6, 0x64, 0xdb, 0x86, 0xb2, 0xe9, 0xd1, 0xea, 0xfa, 0x28, 0xb6, 0xfb,
-  0x48, 0xd6, 0x5c, 0x04, 0x7a, 0x2d, 0x65, 0xe9, 0x09, 0x6f, 0xb7, 0x6f,
-  0xe0, 0xd1, 0xfc, 0x43, 0xc3, 0xee, 0xf7, 0xa5, 0x0e, 0xf5, 0x0d, 0x43,
-  0x50, 0x07, 0xa6, 0x0f, 0x91, 0x17, 0x9f, 0x46, 0x07, 0x1e, 0xa6, 0x2c,
-  0x6a, 0xff, 0x4d, 0xf6, 0x22, 0xce, 0x92, 0xfe, 0x95, 0x41, 0xa8, 0xaa,
-  0xff, 0x1d, 0x62, 0xef, 0x7a, 0x23, 0x34, 0x00, 0x88, 0x46, 0xa0, 0x28,
-  0xef, 0x15, 0x3e, 0xbf, 0x92, 0xc6, 0xb0, 0x8b, 0xcf, 0xbb, 0x5f, 0xdf,
-  0x0e, 0x51, 0x97, 0x58, 0x1f, 0x43, 0x85, 0x2c, 0x0c, 0x62, 0xe0, 0xed,
-  0x3a, 0xf0, 0x0d, 0x91, 0x98, 0xd8, 0x64, 0x0e, 0x3e, 0x8e, 0xcf, 0x86,
-  0x2b, 0xbb, 0x0f, 0xbe, 0x3a, 0x22, 0x10, 0xca, 0xa0, 0xe0, 0xb6, 0x4d,
-  0xfb, 0x6c, 0xf7, 0x62, 0x87, 0xec, 0x9c, 0xa1, 0x7d, 0xd9, 0x8d, 0x6e,
-  0xab, 0x5b, 0x6a, 0xdd, 0x85, 0xb7, 0xd8, 0x41, 0xbd, 0xaa, 0x2a, 0x6f,
-  0xef, 0xe9, 0xa5, 0xaf, 0x7e, 0xff, 0x4a, 0x5e, 0xb0, 0x42, 0xc9, 0x7e,
-  0xf6, 0x22, 0x8e, 0xa7, 0x81, 0x33, 0x31, 0x1b, 0xe4, 0x47, 0xd2, 0x5e,
-  0x43, 0x7d, 0x17, 0xad, 0xad, 0x6c, 0x77, 0xc2, 0xc2, 0x31, 0x78, 0xdd,
-  0x86, 0xbc, 0x26, 0x1b, 0xbb, 0x26, 0xd9, 0x7d, 0xad, 0xce, 0xbe, 0x86,
-  0x62, 0xcd, 0x73, 0x04, 0x6b, 0xfe, 0x7d, 0xc0, 0x03, 0x04, 0xa3, 0xb7,
-  0xe6, 0x86, 0x8e, 0x46, 0x94, 0xbc, 0xe2, 0xfd, 0xc3, 0x21, 0x69, 0xfd,
-  0xd9, 0xab, 0xbf, 0x47, 0x45, 0x9c, 0x9e, 0x36, 0x0c, 0xa2, 0x8b, 0xbd,
-  0x53, 0x84, 0x17, 0xb0, 0xae, 0x2c, 0xbc, 0x58, 0x7b, 0x7b, 0xe6, 0x0e,
-  0x06, 0x98, 0x57, 0xf5, 0x00, 0xf3, 0x0a, 0x43, 0xcb, 0x1e, 0x8c, 0x80,
-  0xcf, 0x13, 0x15, 0x54, 0xc4, 0xff, 0xf9, 0xb3, 0x3d, 0x28, 0x82, 0x8d,
-  0x8d, 0x03, 0x31, 0x47, 0x88, 0xa5, 0x5f, 0xbe, 0x24, 0x33, 0xe5, 0x92,
-  0x4c, 0x06, 0x9c, 0xb1, 0x1e, 0x70, 0xc6, 0x59, 0xc0, 0x19, 0x67, 0x01,
-  0xa7, 0x77, 0x24, 0x0d, 0xac, 0xa5, 0x4b, 0x56, 0xde, 0x6e, 0x50, 0x55,
-  0x29, 0x0a, 0xb7, 0xa8, 0x14, 0xe5, 0x5e, 0x7b, 0x63, 0xa5, 0x48, 0xf4,
-  0x7d, 0x78, 0x00, 0x5c, 0x02, 0xa9, 0x55, 0x1c, 0xb9, 0xba, 0xbe, 0xaf,
-  0xaf, 0x3f, 0xba, 0xce, 0xe8, 0x35, 0x2b, 0xb3, 0xa6, 0xca, 0xba, 0x5c,
-  0x30, 0xa2, 0x3d, 0x9d, 0x87, 0x3f, 0x6a, 0x65, 0x9b, 0x6d, 0x6c, 0x4c,
-  0x76, 0x80, 0xb1, 0xc0, 0xb6, 0x21, 0x68, 0xe9, 0x14, 0x0b, 0x92, 0xf1,
-  0xc4, 0xb3, 0x5a, 0x4f, 0xff, 0x7a, 0x75, 0x81, 0xce, 0xa8, 0xbc, 0x47,
-  0xef, 0xe0, 0xe2, 0x3e, 0x4b, 0x43, 0xcf, 0xfb, 0xb5, 0x5b, 0xe9, 0x50,
-  0x8b, 0x08, 0x81, 0x1c, 0xb8, 0xef, 0xb5, 0x6a, 0x5d, 0xe7, 0x50, 0x4e,
-  0x41, 0x97, 0x69, 0x17, 0x3d, 0xf2, 0xc4, 0xcd, 0xfb, 0x08, 0x6f, 0x28,
-  0x7c, 0xfa, 0x7d, 0x9f, 0xf4, 0x7a, 0x34, 0x49, 0xe8, 0x1d, 0xae, 0x27,
-  0x6f, 0x18, 0x8b, 0xf1, 0xcc, 0x92, 0x73, 0x83, 0xf7, 0x34, 0x43, 0xc6,
-  0xf1, 0xc0, 0x9b, 0x7c, 0x35, 0xc4, 0x25, 0x07, 0xf9, 0xf9, 0xd4, 0x65,
-  0xec, 0xd2, 0x94, 0x5d, 0xa8, 0xf8, 0xf0, 0x13, 0x4d, 0xb4, 0x57, 0xff,
-  0xff, 0xd3, 0x6e, 0xe9, 0x67, 0xd8, 0x5a, 0x1d, 0x0b, 0x0f, 0x09, 0xb6,
-  0x8d, 0x0b, 0xc9, 0x07, 0x41, 0x7a, 0x27, 0x04, 0x43, 0x90, 0xc6, 0x40,
-  0xa7, 0xb4, 0xe3, 0x5c, 0xc5, 0x23, 0x67, 0xfe, 0x2c, 0x48, 0x69, 0x4b,
-  0x8a, 0xba, 0x04, 0x3e, 0xb2, 0x47, 0x58, 0x44, 0xa6, 0x51, 0xc2, 0x24,
-  0x6f, 0x1a, 0x25, 0x16, 0x2c, 0xc4, 0xda, 0x9a, 0xc8, 0x21, 0x66, 0xbd,
-  0x9e, 0xa9, 0x35, 0x20, 0x7c, 0x61, 0x21, 0xde, 0x48, 0xf8, 0xf5, 0xea,
-  0xfc, 0x24, 0x5a, 0xc4, 0xa0, 0xca, 0x30, 0x55, 0xc0, 0x3b, 0xdd, 0x3c,
-  0x35, 0x7c, 0x23, 0xb8, 0x8b, 0x0c, 0x12, 0x98, 0xc0, 0x63, 0xeb, 0x58,
-  0xdc, 0x73, 0xf4, 0xbf, 0x0a, 0xe6, 0x5a, 0x13, 0xd2, 0xfa, 0x89, 0xe2,
-  0xf2, 0xbb, 0x05, 0xc0, 0xa6, 0x69, 0x44, 0xdb, 0xba, 0x16, 0x01, 0xd9,
-  0x04, 0xb1, 0x14, 0xfa, 0x13, 0x67, 0x94, 0x3b, 0x39, 0x68, 0xcb, 0x05,
-  0x9c, 0xda, 0xa1, 0x7f, 0x71, 0x30, 0x5e, 0x3b, 0x2a, 0x21, 0x45, 0xa9,
-  0x76, 0xe1, 0x32, 0x31, 0x8a, 0x41, 0x96, 0xe4, 0xf4, 0x43, 0x14, 0xb7,
-  0xfb, 0x9d, 0x7d, 0x6d, 0x02, 0x1e, 0x1f, 0xaf, 0x08, 0xa3, 0x0c, 0xa3,
-  0x98, 0x98, 0x1b, 0x82, 0x15, 0xc3, 0xb7, 0x4e, 0x09, 0x4c, 0x79, 0x8e,
-  0xc3, 0x79, 0xfb, 0x1b, 0x31, 0xd4, 0x66, 0xbb, 0x31, 0x21, 0x36, 0x1e,
-  0x05, 0xd6, 0x86, 0x37, 0x58, 0x43, 0xd1, 0xad, 0x33, 0x3c, 0xa3, 0x7e,
-  0x50, 0xbe, 0xe5, 0xb0, 0x9d, 0xd9, 0xd6, 0xa6, 0xed, 0x14, 0x14, 0x78,
-  0x91, 0x6d, 0x7e, 0x24, 0xad, 0xd3, 0xab, 0xab, 0xcb, 0xab, 0x09, 0x39,
-  0x89, 0x96, 0x81, 0x4b, 0xc2, 0x28, 0x25, 0xe2, 0xd0, 0xb7, 0xd1, 0x2a,
-  0xe4, 0xdf, 0xa0, 0x7f, 0xf9, 0x88, 0xd3, 0x0d, 0xcc, 0xe4, 0xad, 0x12,
-  0x53, 0x65, 0xef, 0xca, 0x8d, 0xed, 0xbf, 0x16, 0xd3, 0xfd, 0x06, 0x13,
-  0x07, 0x13, 0x95, 0x1b, 0xf2, 0xbc, 0x5d, 0xb5, 0xdc, 0xa2, 0x32, 0xc0,
-  0x64, 0x9b, 0xef, 0x51, 0x3c, 0xc5, 0x82, 0x84, 0xcb, 0xab, 0x89, 0x78,
-  0x9b, 0x11, 0x06, 0x58, 0x1c, 0x8f, 0x96, 0xb4, 0x5b, 0xff, 0x0a, 0x5b,
-  0x35, 0xa5, 0x67, 0xfb, 0x77, 0xb9, 0x02, 0xca, 0x43, 0x32, 0x48, 0xd6,
-  0x2c, 0x4a, 0x4e, 0xa9, 0xe3, 0x69, 0xa8, 0x71, 0xe5, 0x56, 0x46, 0x2d,
-  0xad, 0x51, 0xb6, 0x57, 0x60, 0xe3, 0xab, 0xa3, 0xd0, 0xd5, 0xd5, 0x5b,
-  0x9c, 0x4d, 0x29, 0xed, 0x95, 0x35, 0xbf, 0x8a, 0x50, 0xbb, 0x20, 0xda,
-  0x6e, 0x49, 0xf6, 0xb2, 0xba, 0x9e, 0x02, 0xf3, 0xae, 0xc6, 0xbd, 0x40,
-  0xb4, 0x0f, 0xa4, 0x10, 0x6d, 0x40, 0xdb, 0x0e, 0x2f, 0x73, 0xad, 0x59,
-  0xf0, 0x93, 0x8c, 0xb9, 0x26, 0xcc, 0x47, 0x5b, 0x73, 0x03, 0xa5, 0xcd,
-  0x06, 0xae, 0x14, 0x22, 0x4e, 0xca, 0x6d, 0xa0, 0xbf, 0x62, 0x77, 0x68,
-  0x10, 0xaa, 0x2c, 0xc5, 0xeb, 0x77, 0xca, 0x9e, 0x73, 0x36, 0xc0, 0x0e,
-  0x2f, 0x65, 0x2f, 0x5e, 0x4a, 0xba, 0x5c, 0xa6, 0x1a, 0x5f, 0xa5, 0xab,
-  0x66, 0x3a, 0x8c, 0x1c, 0x9b, 0xde, 0xb8, 0xed, 0xde, 0x21, 0x4a, 0x47,
-  0x8d, 0x55, 0x8e, 0xd3, 0x52, 0x6f, 0x91, 0x5b, 0x5d, 0xd2, 0x9a, 0x42,
-  0xf6, 0xb8, 0x01, 0x16, 0xf0, 0x02, 0xc4, 0x10, 0x92, 0x76, 0xbf, 0x81,
-  0x83, 0x10, 0x43, 0x36, 0x16, 0x37, 0xd5, 0x5b, 0x13, 0x5a, 0x12, 0x2a,
-  0x17, 0xe1, 0x0d, 0x88, 0x30, 0x7d, 0xd7, 0x2c, 0xfd, 0x7e, 0xbf, 0xe2,
-  0xa0, 0xb8, 0x17, 0xfa, 0x56, 0xdd, 0x7c, 0x55, 0x20, 0x35, 0x99, 0x14,
-  0x85, 0x2f, 0x50, 0xa2, 0xba, 0xe5, 0xe1, 0x09, 0xfe, 0x9b, 0x9f, 0x7a,
-  0x6d, 0x15, 0x99, 0x5a, 0x1d, 0x28, 0xab, 0xd3, 0x64, 0x89, 0x25, 0xf4,
-  0x8c, 0x06, 0x3c, 0x7f, 0xcd, 0xb9, 0x99, 0xd0, 0xe2, 0xad, 0x2f, 0xd0,
-  0x2a, 0x31, 0xbc, 0x26, 0x2d, 0x58, 0x3e, 0x2c, 0x38, 0xe4, 0x1e, 0x80,
-  0xd3, 0x12, 0xef, 0x82, 0x0b, 0x5d, 0x37, 0x82, 0x12, 0xcc, 0x65, 0x64,
-  0x6f, 0x12, 0x35, 0x10, 0x8c, 0x39, 0x40, 0x76, 0xab, 0x00, 0x86, 0xdd,
-  0x76, 0x4b, 0xb3, 0x77, 0x8a, 0xbf, 0xb3, 0x90, 0xb2, 0xb6, 0x66, 0xe5,
-  0xa5, 0x70, 0x07, 0xab, 0x52, 0xd0, 0x98, 0xde, 0x5b, 0x0a, 0x06, 0xff,
-  0x5e, 0xb2, 0x25, 0x53, 0xcc, 0x77, 0x4b, 0x3d, 0xee, 0x32, 0x3b, 0x0c,
-  0x9f, 0x71, 0x69, 0xa3, 0xd6, 0x09, 0x1e, 0xae, 0xed, 0xf7, 0xcb, 0x63,
-  0x1d, 0xa5, 0xf6, 0x89, 0x66, 0x02, 0xba, 0xab, 0xe6, 0xcf, 0x9d, 0x66,
-  0x65, 0xaa, 0xbb, 0x44, 0xc7, 0x90, 0x03, 0xe9, 0xf4, 0xc1, 0x88, 0x2b,
-  0xd6, 0x6a, 0xcb, 0x24, 0x78, 0x52, 0xc8, 0x95, 0x26, 0xa1, 0xb2, 0xce,
-  0x1b, 0x79, 0x9b, 0x4d, 0x8b, 0xbb, 0xc6, 0xbf, 0xf0, 0x1e, 0xa8, 0x36,
-  0xbe, 0x54, 0x12, 0x6a, 0xd3, 0x3e, 0xf5, 0x7f, 0xb7, 0x52, 0xd0, 0x76,
-  0xbb, 0x96, 0xe1, 0xb5, 0x41, 0x56, 0xc0, 0xc2, 0x39, 0x64, 0xa8, 0x23,
-  0x32, 0xa8, 0x46, 0xdf, 0x72, 0x45, 0xa9, 0x03, 0xb6, 0x9b, 0x00, 0x93,
-  0x72, 0xa1, 0xa9, 0x8f, 0x1f, 0x34, 0x8d, 0xbf, 0xd7, 0x9e, 0xb5, 0x5a,
-  0x62, 0xc9, 0xbd, 0xf6, 0xa6, 0x92, 0xa3, 0xd3, 0x54, 0x35, 0x94, 0x6a,
-  0x3b, 0x2d, 0xe9, 0x82, 0xf9, 0x81, 0x09, 0xa2, 0xcb, 0x74, 0x94, 0x12,
-  0x05, 0xd6, 0xcd, 0x01, 0xb8, 0x59, 0x13, 0x78, 0x47, 0x2e, 0x88, 0xe6,
-  0x78, 0x2b, 0x35, 0x8b, 0x9c, 0xa0, 0x68, 0xa2, 0x7e, 0x5e, 0x03, 0x7f,
-  0x65, 0xc0, 0xcc, 0xdc, 0x56, 0x16, 0xa5, 0xf2, 0x7a, 0x62, 0x23, 0x42,
-  0x1a, 0xac, 0xe9, 0x1d, 0xdf, 0x18, 0xf3, 0x1b, 0x62, 0xa7, 0xce, 0xaf,
-  0x9e, 0xe8, 0x6b, 0xf0, 0x55, 0x6c, 0xeb, 0xf5, 0xc8, 0x35, 0x50, 0x47,
-  0x89, 0xeb, 0xcf, 0x66, 0x2c, 0x11, 0xc7, 0x6b, 0x51, 0x7f, 0x40, 0x5d,
-  0x98, 0x76, 0x01, 0x03, 0x10, 0x99, 0x5d, 0xb9, 0x9a, 0xe3, 0x5b, 0xdc,
-  0x39, 0xc4, 0x98, 0xe5, 0x54, 0x5c, 0xb8, 0xc2, 0xca, 0x14, 0x2f, 0xbe,
-  0xf7, 0xec, 0xd1, 0x78, 0x6c, 0x0f, 0xd8, 0x9e, 0xe3, 0x8c, 0x66, 0xd3,
-  0x5d, 0x6a, 0xef, 0x0d, 0xec, 0x1d, 0x87, 0x0d, 0x06, 0x74, 0xe6, 0x8e,
-  0xd8, 0x0e, 0x1d, 0xd7, 0x22, 0x3e, 0x9a, 0xc8, 0x31, 0x62, 0x50, 0x7b,
-  0x02, 0x5d, 0x81, 0x54, 0xb4, 0x14, 0x1c, 0x02, 0x69, 0xbf, 0x45, 0xc9,
-  0x0d, 0xc7, 0x77, 0x4d, 0xea, 0x6e, 0x4e, 0x57, 0xdd, 0x85, 0xe9, 0xaa,
-  0x8b, 0x30, 0x78, 0x25, 0xe6, 0xfc, 0x74, 0xef, 0xc7, 0x67, 0x85, 0xa9,
-  0x86, 0x74, 0xe5, 0xcf, 0x29, 0xd4, 0xa3, 0xd6, 0xe7, 0xcf, 0xf2, 0x36,
-  0xe0, 0x2f, 0x0c, 0xdf, 0x84, 0x7c, 0xfe, 0xac, 0xcb, 0x6e, 0xf3, 0xa8,
-  0x76, 0x2b, 0x27, 0xa5, 0xd5, 0x6d, 0x8c, 0xf4, 0xf8, 0x47, 0x5d, 0xfb,
-  0xcb, 0x87, 0xd6, 0xb3, 0x1f, 0x3c, 0xc9, 0xeb, 0xcc, 0x48, 0xd4, 0xe5,
-  0xf4, 0x0b, 0x73, 0x52, 0x4b, 0x62, 0x7a, 0x9f, 0x40, 0x26, 0x4d, 0xd2,
-  0x3b, 0x1d, 0x62, 0xe3, 0x80, 0x82, 0x17, 0x30, 0x4d, 0x9d, 0xaa, 0x6f,
-  0x65, 0x25, 0x4f, 0x36, 0x92, 0xb9, 0x8d, 0x50, 0xdd, 0xa1, 0x34, 0xa2,
-  0x1b, 0x84, 0x2f, 0x2f, 0x61, 0x69, 0x32, 0x56, 0xbb, 0x35, 0x85, 0x10,
-  0x73, 0xf0, 0xe4, 0xf9, 0xe1, 0x61, 0x93, 0x2e, 0x65, 0x12, 0xcd, 0x3b,
-  0x90, 0x43, 0xfc, 0x05, 0x8f, 0xef, 0xce, 0x47, 0xd1, 0x9c, 0x26, 0x77,
-  0x25, 0x10, 0xcd, 0x12, 0xae, 0x72, 0x52, 0x11, 0x74, 0x89, 0x60, 0xdd,
-  0x87, 0x88, 0x83, 0xf7, 0x72, 0x49, 0x9b, 0x95, 0xe9, 0xac, 0x82, 0x03,
-  0x1e, 0x15, 0x5e, 0xf9, 0x63, 0x1e, 0xba, 0x46, 0xcb, 0xfc, 0xe5, 0x98,
-  0x26, 0x65, 0xa4, 0xa5, 0xaa, 0x50, 0x23, 0xa0, 0xa4, 0xae, 0xcc, 0x97,
-  0x5f, 0xa2, 0xbf, 0xe6, 0xee, 0xea, 0x32, 0x1b, 0xea, 0x5e, 0xdf, 0xaa,
-  0xbf, 0xa7, 0xed, 0x89, 0x17, 0x91, 0xd0, 0x27, 0x36, 0xf3, 0xb3, 0xeb,
-  0x64, 0xbd, 0x97, 0xe2, 0xe3, 0x3c, 0x25, 0x3e, 0x17, 0x61, 0x2b, 0x8e,
-  0x38, 0xf7, 0xa7, 0x01, 0xc3, 0xa5, 0xba, 0x1b, 0x41, 0x8c, 0xc0, 0x1f,
-  0x24, 0x4a, 0xc0, 0xa4, 0xdf, 0xbc, 0xbb, 0x26, 0x33, 0xf0, 0x43, 0x68,
-  0xca, 0xce, 0xb0, 0xdc, 0xb1, 0xd4, 0x12, 0xd3, 0x3f, 0x78, 0x8c, 0xcc,
-  0xfc, 0x44, 0xec, 0xf7, 0x24, 0x29, 0x5e, 0xbc, 0x0d, 0xa1, 0xf0, 0xa4,
-  0x01, 0x71, 0x61, 0x3d, 0x00, 0xd1, 0x28, 0x0a, 0x56, 0x20, 0x34, 0x19,
-  0x1b, 0xa7, 0x8c, 0x60, 0x72, 0xab, 0xc2, 0x9a, 0xde, 0x41, 0x33, 0xbe,
-  0x30, 0x7f, 0x73, 0x79, 0x46, 0xda, 0x88, 0x4c, 0x1c, 0xe8, 0x3c, 0xfb,
-  0xf0, 0xe1, 0x3d, 0x97, 0xc1, 0x0b, 0x08, 0xc2, 0x79, 0xe2, 0xc7, 0x9d,
-  0x18, 0x9e, 0x68, 0x5b, 0xe1, 0x6e, 0x35, 0xc7, 0x9b, 0x55, 0xd8, 0x92,
-  0x30, 0x8b, 0xb4, 0xe5, 0xcf, 0x20, 0x75, 0xa1, 0x0c, 0xa0, 0xee, 0x5e,
-  0xd7, 0xb2, 0x2c, 0x39, 0xf5, 0x3a, 0x22, 0x6b, 0x90, 0x11, 0x5d, 0x09,
-  0xb6, 0xa0, 0x38, 0x08, 0xb0, 0xec, 0xc1, 0x67, 0xca, 0x6f, 0x80, 0x08,
-  0xbc, 0x83, 0x1c, 0xe0, 0x4b, 0xef, 0x04, 0x71, 0x0a, 0x39, 0x89, 0x62,
-  0x57, 0x72, 0x07, 0xa2, 0x52, 0xb2, 0x92, 0xc2, 0x22, 0x2f, 0xc9, 0xb1,
-  0x9c, 0x16, 0x33, 0xc7, 0x9f, 0xf9, 0xcc, 0xad, 0xcf, 0x44, 0x32, 0x01,
-  0x0d, 0x89, 0x90, 0x32, 0xd5, 0x6d, 0xa9, 0xd9, 0xbd, 0xda, 0xd2, 0xec,
-  0xb3, 0x3c, 0x40, 0x25, 0x45, 0xf1, 0x19, 0x7f, 0x1c, 0xea, 0x33, 0xe4,
-  0x0c, 0xbd, 0x70, 0x50, 0xae, 0x80, 0xbf, 0x0a, 0x02, 0x16, 0xb2, 0xf0,
-  0x39, 0x6b, 0xb7, 0x95, 0x60, 0x71, 0x63, 0x02, 0xcd, 0xad, 0x43, 0x0e,
-  0x8f, 0x2a, 0xbe, 0xa7, 0x7e, 0x3d, 0x4a, 0xfd, 0x9c, 0xc8, 0xff, 0xbe,
-  0xbd, 0x38, 0x03, 0x33, 0xb9, 0x92, 0x8d, 0xed, 0x22, 0xe5, 0x80, 0xdf,
-  0x9f, 0xff, 0x5f, 0x7b, 0x47, 0xb6, 0xdc, 0xc6, 0x71, 0x7c, 0xcf, 0x57,
-  0xac, 0x20, 0x47, 0xbb, 0x08, 0x08, 0x80, 0xd4, 0x91, 0x8a, 0x29, 0x52,
-  0xb2, 0x2c, 0xd1, 0x2a, 0xa5, 0x64, 0x51, 0x25, 0x51, 0x76, 0xaa, 0x04,
-  0x9a, 0x81, 0x88, 0x05, 0xb9, 0x22, 0xae, 0x00, 0xe0, 0x21, 0xa7, 0x98,
-  0x6f, 0x4f, 0x1f, 0x73, 0xf4, 0xcc, 0xce, 0x5e, 0x34, 0xad, 0x72, 0x55,
-  0x82, 0x07, 0x09, 0xc4, 0xce, 0xd1, 0xd3, 0xd3, 0xd3, 0xd7, 0x74, 0xf7,
-  0x8e, 0xa3, 0x2f, 0xf3, 0x73, 0x68, 0x06, 0x8b, 0x21, 0x5a, 0xda, 0x88,
-  0x40, 0xeb, 0x01, 0x40, 0x90, 0x32, 0x09, 0xe1, 0x9c, 0xb5, 0xa8, 0x17,
-  0xba, 0x2c, 0x22, 0x33, 0xc2, 0x01, 0x55, 0xdf, 0xd2, 0x93, 0xcf, 0x67,
-  0x93, 0x2f, 0x66, 0x2a, 0xf5, 0x23, 0xa7, 0xa9, 0xc7, 0x2f, 0xf7, 0x0e,
-  0x50, 0x01, 0x54, 0x5e, 0x34, 0xc0, 0x57, 0x11, 0xed, 0x7e, 0x06, 0x65,
-  0xb4, 0xcf, 0x73, 0xaf, 0xac, 0xbc, 0xce, 0x0d, 0x3a, 0x9b, 0xcc, 0x87,
-  0xa3, 0x02, 0x5d, 0x1d, 0x3f, 0xec, 0xb8, 0xe0, 0xc6, 0x2a, 0x24, 0xfc,
-  0xc9, 0x6e, 0x74, 0x1f, 0xb4, 0xc0, 0x7b, 0xf7, 0x22, 0xef, 0xc1, 0x0e,
-  0x5a, 0x05, 0x3e, 0x47, 0x42, 0xa4, 0x52, 0x02, 0x12, 0x4c, 0xf2, 0xf7,
-  0xf7, 0xfb, 0x6f, 0x7a, 0x0b, 0x2c, 0x24, 0x66, 0xc6, 0x84, 0x1d, 0x59,
-  0x80, 0x36, 0x90, 0x1e, 0x80, 0x31, 0xd5, 0xee, 0x4d, 0x87, 0x8b, 0xe4,
-  0x0a, 0x37, 0xc5, 0x94, 0xd6, 0x42, 0xc9, 0x7f, 0xd5, 0x43, 0x1f, 0xb7,
-  0xa7, 0x14, 0xa9, 0xad, 0x24, 0x3b, 0x76, 0xe5, 0x2a, 0x40, 0x24, 0x50,
-  0xbc, 0xc6, 0xb8, 0xdd, 0xde, 0x42, 0x68, 0xca, 0x3c, 0xaf, 0xb0, 0xc8,
-  0xa1, 0x74, 0x7c, 0xcb, 0xf2, 0x5d, 0x6b, 0x27, 0x4f, 0xda, 0x96, 0xa0,
-  0xb3, 0xf5, 0x2a, 0x52, 0x15, 0xdc, 0x56, 0x75, 0x49, 0x98, 0xbb, 0x1f,
-  0x81, 0x6a, 0x34, 0xce, 0x4e, 0x12, 0x24, 0x68, 0xac, 0x79, 0xf1, 0x75,
-  0xa8, 0x39, 0x44, 0x62, 0x0a, 0x02, 0xb4, 0x7a, 0x99, 0x96, 0x18, 0xb2,
-  0x80, 0xea, 0x67, 0x69, 0x29, 0x9f, 0x2e, 0xef, 0x31, 0xfe, 0xb4, 0xa7,
-  0xaa, 0xb5, 0xbd, 0x48, 0xc7, 0xc3, 0xf3, 0x89, 0xa7, 0x88, 0x49, 0xb5,
-  0x30, 0x7e, 0xcf, 0xe8, 0xe4, 0x59, 0x23, 0xab, 0x24, 0x02, 0x33, 0x04,
-  0x5c, 0x2c, 0x33, 0x18, 0x66, 0xd4, 0x1b, 0xcc, 0xf6, 0x70, 0xca, 0x6d,
-  0x72, 0xf4, 0xe5, 0x77, 0x17, 0x81, 0x1f, 0xcc, 0xde, 0x41, 0xf3, 0x2f,
-  0xb0, 0x15, 0xb1, 0xaf, 0xf5, 0x79, 0xa1, 0x20, 0x54, 0xb4, 0xcd, 0x0b,
-  0x01, 0x11, 0xd4, 0xf1, 0x07, 0x3f, 0x3b, 0x7f, 0xd8, 0xd3, 0xf1, 0x92,
-  0xf4, 0xe6, 0x25, 0xe8, 0xa0, 0x28, 0xbd, 0x74, 0x66, 0x99, 0x1b, 0x16,
-  0xe5, 0xb1, 0xfb, 0xe8, 0x1d, 0x51, 0xfb, 0x6a, 0x1b, 0x2f, 0xd3, 0x51,
-  0xc2, 0x75, 0x89, 0x1c, 0xc9, 0x2a, 0x30, 0xb1, 0x41, 0xa6, 0x2f, 0x30,
-  0xc0, 0x86, 0x62, 0xe2, 0x88, 0xa1, 0xc9, 0x0b, 0x8b, 0x32, 0xc1, 0xd2,
-  0x03, 0x96, 0x3e, 0x4b, 0xd0, 0x06, 0x5d, 0xe5, 0x0f, 0x5a, 0xc6, 0x0e,
-  0x7d, 0x7a, 0xfa, 0x91, 0x4a, 0xcd, 0x8c, 0x27, 0xf3, 0xf9, 0x32, 0xa1,
-  0xaf, 0x66, 0xb6, 0xbf, 0x70, 0x03, 0x65, 0x1b, 0xb6, 0x0f, 0x25, 0x3f,
-  0xa6, 0xf9, 0x6d, 0x4e, 0x65, 0x0e, 0xa3, 0xc3, 0xd5, 0x97, 0xd9, 0xb1,
-  0x28, 0x70, 0x37, 0x1a, 0xbd, 0x1a, 0x7f, 0x98, 0x65, 0xb0, 0x17, 0xb4,
-  0xc9, 0x1b, 0x11, 0xa5, 0x04, 0x6e, 0x44, 0xc3, 0xe5, 0xd2, 0x2e, 0x8b,
-  0x1c, 0x7d, 0xf8, 0x7b, 0xb4, 0x0b, 0x0a, 0x27, 0x11, 0xc3, 0xdb, 0x74,
-  0xf9, 0xd6, 0xf1, 0x94, 0x80, 0xac, 0xa7, 0xd8, 0x39, 0x10, 0x1b, 0x70,
-  0x80, 0xa9, 0x18, 0x40, 0x07, 0xef, 0x6c, 0x82, 0x3e, 0xb1, 0xc8, 0x26,
-  0xb9, 0xd8, 0xe0, 0x8f, 0x45, 0xa3, 0x48, 0xba, 0x80, 0x0f, 0xed, 0xc7,
-  0xf9, 0x32, 0x8d, 0x06, 0x31, 0x1e, 0x62, 0x71, 0x14, 0xe9, 0xf4, 0xc6,
-  0x3a, 0xec, 0x57, 0x7a, 0xd1, 0x7c, 0xbc, 0xf9, 0x5a, 0xb9, 0xba, 0x83,
-  0xa2, 0xbb, 0x14, 0x5c, 0x34, 0xd6, 0x58, 0xe9, 0xf1, 0xc8, 0x49, 0xff,
-  0xe3, 0xe3, 0xa7, 0x87, 0xfd, 0x13, 0x43, 0xb8, 0xdc, 0x16, 0xe9, 0x6c,
-  0xb1, 0x48, 0x47, 0x5c, 0xdd, 0xce, 0xf6, 0x39, 0xff, 0xc4, 0x14, 0x98,
-  0x6c, 0x6e, 0xd0, 0x78, 0xa8, 0xb7, 0x77, 0xb7, 0xa2, 0xa7, 0xf4, 0xc7,
-  0xb6, 0x6d, 0xa8, 0x76, 0x54, 0x0f, 0x4a, 0x57, 0x3d, 0x54, 0xcc, 0x4c,
-  0x16, 0x06, 0x00, 0xaa, 0x4f, 0xf0, 0xd7, 0x1d, 0xde, 0xab, 0x36, 0x6d,
-  0x0f, 0xec, 0xd7, 0x47, 0xf8, 0xb1, 0xd3, 0x39, 0xe4, 0xd2, 0x7a, 0xbb,
-  0x12, 0x96, 0xb6, 0x59, 0xa0, 0x03, 0x2d, 0x05, 0x0f, 0xe0, 0xd5, 0xd2,
-  0xf3, 0xfd, 0x17, 0x7b, 0xcf, 0x99, 0xfb, 0x11, 0x28, 0x78, 0x6d, 0x72,
-  0x1c, 0x75, 0x0c, 0x7a, 0x88, 0x34, 0x7a, 0x9f, 0xb2, 0xf5, 0x12, 0x4b,
-  0x44, 0x3d, 0x8d, 0xd0, 0xb9, 0xfc, 0xfd, 0xab, 0x83, 0x77, 0xcf, 0x0e,
-  0xf6, 0x44, 0x2f, 0xfd, 0x1c, 0xf0, 0x7d, 0xf6, 0x69, 0xb1, 0x8a, 0xb1,
-  0xfa, 0x62, 0x0c, 0xff, 0xfa, 0xe3, 0x60, 0xe1, 0xd2, 0x73, 0x24, 0x02,
-  0x1e, 0xe8, 0xf5, 0xb3, 0x37, 0x2f, 0x3f, 0x3c, 0x7b, 0x29, 0x47, 0xd2,
-  0x2d, 0xd4, 0x08, 0x06, 0xec, 0x0a, 0x0a, 0x33, 0x09, 0x8d, 0x2d, 0xb2,
-  0xf2, 0xbb, 0x5c, 0xbb, 0xd2, 0x8c, 0x4a, 0x37, 0xdc, 0x78, 0x19, 0xc0,
-  0x4f, 0x01, 0x2f, 0xfc, 0x50, 0x6e, 0x9a, 0x85, 0x55, 0x37, 0x53, 0x2e,
-  0xd8, 0xee, 0xf9, 0x39, 0xd2, 0xa9, 0x19, 0x4c, 0xfd, 0x8c, 0xbf, 0xd2,
-  0x98, 0x2a, 0x10, 0x03, 0x9f, 0x33, 0x5a, 0xe5, 0x48, 0xf5, 0x89, 0xba,
-  0xa9, 0xcf, 0x3b, 0xce, 0x61, 0x97, 0xe8, 0x4d, 0xf8, 0x27, 0x49, 0x03,
-  0x22, 0xf7, 0xa4, 0xbc, 0x55, 0x9e, 0x81, 0xb1, 0x31, 0x09, 0x8f, 0x6e,
-  0x1e, 0x89, 0xe8, 0x92, 0x0c, 0x74, 0x76, 0x54, 0xf4, 0x51, 0x71, 0xa7,
-  0xc1, 0x59, 0xd1, 0x44, 0x8c, 0x65, 0x60, 0x26, 0x82, 0xf0, 0x00, 0x71,
-  0x07, 0x64, 0x39, 0x1e, 0xae, 0x40, 0x7f, 0x98, 0x62, 0x1d, 0xd3, 0xc1,
-  0x2c, 0x01, 0x5a, 0x05, 0xab, 0x6d, 0x8a, 0x97, 0xb1, 0x11, 0x3a, 0x73,
-  0xda, 0x08, 0xaf, 0x4f, 0x13, 0x21, 0x67, 0x78, 0x6e, 0xcb, 0xf2, 0xa7,
-  0x96, 0xcf, 0x28, 0xd3, 0xb1, 0x64, 0x48, 0x40, 0xce, 0x0f, 0x36, 0xed,
-  0x75, 0xa8, 0x56, 0x3f, 0x80, 0x4e, 0xf2, 0xd7, 0xa7, 0x26, 0x9e, 0xd3,
-  0x3c, 0x90, 0x6c, 0x83, 0xbb, 0x84, 0x98, 0xa6, 0x94, 0xf9, 0x4a, 0xda,
-  0x2f, 0x1c, 0x5e, 0x88, 0x07, 0xf2, 0x0e, 0x3d, 0x69, 0x7b, 0xac, 0xc5,
-  0x9d, 0x80, 0xfe, 0x7f, 0x5c, 0x44, 0xdc, 0x85, 0xdc, 0xf3, 0x37, 0x31,
-  0x49, 0x8e, 0x8d, 0x05, 0x5e, 0xe4, 0x66, 0x08, 0xc4, 0x2e, 0x84, 0x3a,
-  0x9e, 0x75, 0x94, 0xad, 0x50, 0xcc, 0xa2, 0x7a, 0x82, 0xfa, 0x5a, 0xb8,
-  0x91, 0x88, 0xbd, 0x45, 0xa0, 0xed, 0x0c, 0xd1, 0x5b, 0xb6, 0x64, 0x2e,
-  0x87, 0x19, 0x26, 0x24, 0x98, 0x39, 0xaa, 0x25, 0x2a, 0x4b, 0xc9, 0xe4,
-  0xca, 0x53, 0x46, 0xed, 0x76, 0x5e, 0xe5, 0x84, 0x5e, 0x85, 0x2a, 0x7c,
-  0x25, 0x74, 0x0c, 0x1e, 0x5d, 0xe9, 0x84, 0xce, 0x04, 0x13, 0xd0, 0x32,
-  0xae, 0x4e, 0x97, 0x05, 0x9a, 0xae, 0x9d, 0x13, 0xda, 0xb0, 0x9a, 0xdb,
-  0x7a, 0xbb, 0xff, 0xfe, 0xa0, 0x15, 0xd0, 0x73, 0xf5, 0x5d, 0x9a, 0xda,
-  0xa0, 0xa7, 0xc4, 0x8c, 0x90, 0xb0, 0x8d, 0x50, 0xba, 0x37, 0x1f, 0x8f,
-  0xb1, 0x16, 0x32, 0xfe, 0x98, 0x20, 0x01, 0x81, 0x60, 0x77, 0x65, 0x2b,
-  0x36, 0x9a, 0x64, 0xd3, 0x4c, 0xb5, 0x71, 0xe8, 0xbc, 0x13, 0x6d, 0x71,
-  0x03, 0x8c, 0x16, 0x84, 0x25, 0x9f, 0xa5, 0xb3, 0x5d, 0xdc, 0xa2, 0xd8,
-  0x87, 0x72, 0x46, 0xd5, 0xfd, 0x10, 0x9c, 0x54, 0x55, 0x73, 0x2e, 0x57,
-  0x35, 0xb1, 0x93, 0x2c, 0x08, 0x08, 0xa2, 0xe4, 0xa1, 0xaf, 0x51, 0x8a,
-  0x73, 0xe7, 0xea, 0x94, 0xdc, 0xb9, 0x50, 0x9f, 0x0c, 0xd1, 0x78, 0xec,
-  0x36, 0xd1, 0x97, 0x8a, 0x46, 0xbd, 0xf1, 0xa6, 0xe6, 0x16, 0x52, 0xbb,
-  0xf6, 0x1e, 0xff, 0x36, 0x45, 0x44, 0x87, 0x36, 0xff, 0x66, 0x65, 0xc4,
-  0x04, 0x52, 0xdf, 0x48, 0x21, 0x51, 0x2b, 0x25, 0x3c, 0xe8, 0xcb, 0x58,
-  0xa1, 0xab, 0x79, 0x68, 0x0d, 0x28, 0xe3, 0xcd, 0xf8, 0x49, 0x9d, 0x1b,
-  0x4a, 0x11, 0x54, 0xcf, 0x4b, 0x92, 0x8b, 0x39, 0x1d, 0xa2, 0x13, 0xab,
-  0x7a, 0x4d, 0x35, 0x18, 0x47, 0x20, 0x6c, 0xbf, 0x74, 0x10, 0xc1, 0xa2,
-  0x9c, 0x9b, 0x37, 0x42, 0x4c, 0xc8, 0x57, 0x89, 0x34, 0xea, 0x5a, 0x1d,
-  0x7a, 0x48, 0x26, 0x84, 0x1e, 0x45, 0xfd, 0xcb, 0xa7, 0xea, 0xba, 0x2d,
-  0xff, 0x20, 0x10, 0xfc, 0xef, 0x90, 0xb4, 0xeb, 0xfd, 0xff, 0x26, 0xd1,
-  0x45, 0x35, 0xda, 0x7c, 0xc2, 0x82, 0x57, 0x0d, 0x7c, 0xb6, 0x30, 0xa1,
-  0xb3, 0x30, 0xd2, 0x0e, 0x09, 0x55, 0x24, 0x94, 0x7f, 0x95, 0xd0, 0xbb,
-  0x92, 0xc0, 0x3b, 0xcc, 0x89, 0x52, 0x71, 0x97, 0x17, 0x1c, 0x7b, 0xf7,
-  0x50, 0xfd, 0xf9, 0xd3, 0x5f, 0x7f, 0x9d, 0x3e, 0x8c, 0xfe, 0x76, 0xd1,
-  0x7d, 0x78, 0xda, 0xbd, 0x7f, 0x01, 0xff, 0x60, 0xf0, 0xe7, 0xc3, 0x0b,
-  0x8c, 0xfc, 0x85, 0x9f, 0x1e, 0x42, 0x6b, 0x0c, 0x10, 0xfb, 0xf1, 0x3e,
-  0xc6, 0x85, 0x42, 0xab, 0xfb, 0xd8, 0x2d, 0x17, 0x22, 0xc7, 0xa2, 0xf9,
-  0x72, 0xa5, 0x98, 0x72, 0xb0, 0x14, 0x62, 0xa2, 0x42, 0x20, 0x37, 0x54,
-  0x6d, 0x54, 0x53, 0x37, 0x9b, 0xef, 0x23, 0x43, 0x75, 0xb2, 0x1f, 0x3c,
-  0x02, 0x0b, 0xfa, 0xda, 0x2a, 0x97, 0x97, 0xab, 0x82, 0x92, 0x7e, 0xa9,
-  0xef, 0x58, 0x3f, 0x9e, 0x4f, 0xa7, 0x43, 0xaa, 0xee, 0x98, 0xf6, 0x8a,
-  0x6f, 0xfe, 0x56, 0x97, 0x19, 0x39, 0xad, 0x55, 0xeb, 0x8f, 0x9b, 0x87,
-  0xde, 0xed, 0x15, 0x4a, 0x46, 0x93, 0x5a, 0xf2, 0x9a, 0x42, 0xe3, 0xb7,
-  0x1d, 0x3a, 0xc7, 0x7b, 0x36, 0x93, 0x64, 0xb3, 0xe1, 0xe5, 0xe9, 0xe2,
-  0xdd, 0x2f, 0x70, 0x7e, 0xff, 0x92, 0x0f, 0xfa, 0xa8, 0xd2, 0x22, 0xea,
-  0x9e, 0xb9, 0xe5, 0x17, 0x76, 0xc2, 0xaa, 0x91, 0x2d, 0xaf, 0x97, 0x1b,
-  0x4f, 0x46, 0xac, 0xfc, 0x15, 0x16, 0xe3, 0x54, 0xa0, 0x6f, 0x1d, 0xb6,
-  0xf3, 0x4c, 0xba, 0x4b, 0x05, 0x31, 0x45, 0xcf, 0x3c, 0xa7, 0xa6, 0x05,
-  0x88, 0xb4, 0x94, 0x0d, 0xa7, 0x44, 0x88, 0x89, 0x1c, 0x7b, 0x33, 0x5f,
-  0xa3, 0xba, 0x40, 0xd1, 0x7e, 0x5c, 0x55, 0x36, 0xc0, 0xdd, 0x42, 0x83,
-  0xdb, 0x95, 0xa6, 0xff, 0x92, 0xc0, 0x16, 0x2f, 0xdc, 0x64, 0xf6, 0xe7,
-  0x26, 0x71, 0xfe, 0xfa, 0x04, 0xc7, 0xf3, 0x4c, 0xf8, 0xa6, 0xf4, 0x6e,
-  0x99, 0x08, 0xeb, 0xed, 0x1c, 0x3a, 0xec, 0xf4, 0x88, 0x16, 0xd4, 0x71,
-  0x43, 0xd8, 0xd0, 0xe9, 0xa1, 0xb7, 0x12, 0x33, 0xf2, 0x66, 0xae, 0x44,
-  0x30, 0xe8, 0xe0, 0x1a, 0xb2, 0xc2, 0x28, 0x17, 0xfc, 0xb8, 0xba, 0x68,
-  0x68, 0xe1, 0x41, 0x18, 0xfd, 0x81, 0xf0, 0x0c, 0x60, 0x6c, 0xbb, 0x62,
-  0x50, 0x3a, 0x66, 0x51, 0x7f, 0x4c, 0x91, 0x78, 0xac, 0xfd, 0xb9, 0xf5,
-  0x18, 0xfe, 0xdb, 0xd1, 0x47, 0x46, 0x5f, 0x67, 0x77, 0xf9, 0x77, 0x90,
-  0xcb, 0xb9, 0x6b, 0xed, 0xfc, 0xc1, 0xc9, 0x50, 0xd7, 0x39, 0xcc, 0xb7,
-  0xd3, 0x9b, 0xf2, 0xc3, 0xab, 0xd7, 0x7b, 0xde, 0x86, 0xf0, 0x47, 0xc0,
-  0x18, 0xd7, 0x48, 0xc2, 0x56, 0x16, 0x95, 0x8f, 0x34, 0xfc, 0x28, 0x7a,
-  0x28, 0x98, 0x7f, 0xff, 0xc3, 0x9b, 0x17, 0x4d, 0x00, 0x28, 0x55, 0x25,
-  0x6e, 0x30, 0xff, 0xb3, 0x9f, 0xf6, 0x9b, 0x4c, 0x5f, 0x98, 0x75, 0x7d,
-  0x53, 0x00, 0xde, 0xbe, 0xdb, 0x7b, 0xbf, 0x77, 0xd0, 0x04, 0x84, 0xb2,
-  0xb8, 0xaf, 0x26, 0xf3, 0x8f, 0xd8, 0xff, 0x5b, 0x31, 0xb3, 0x4f, 0xa0,
-  0x25, 0x43, 0x5e, 0x97, 0x9f, 0xd9, 0x7c, 0x60, 0x1b, 0x73, 0x20, 0x3e,
-  0xaf, 0x4e, 0x14, 0x77, 0xc7, 0x42, 0x10, 0x3e, 0xbd, 0xd8, 0xc3, 0x90,
-  0xf8, 0x61, 0x69, 0x84, 0x5a, 0x5d, 0xf6, 0xa4, 0xb9, 0x87, 0x8b, 0x0f,
-  0x19, 0xe0, 0x54, 0xc8, 0xd1, 0x8b, 0x86, 0xe4, 0xfc, 0x94, 0x52, 0x7e,
-  0xc7, 0xe1, 0x7f, 0x32, 0x91, 0x05, 0x30, 0x05, 0x22, 0xb6, 0xf9, 0x64,
-  0x32, 0x2d, 0x35, 0x20, 0x0a, 0x2b, 0x25, 0x49, 0xa9, 0xbc, 0xd2, 0x0f,
-  0xef, 0x13, 0x83, 0x56, 0xa7, 0x16, 0x2b, 0x2f, 0xfb, 0x0f, 0xf0, 0x38,
-  0xf1, 0x9a, 0xdc, 0x29, 0xc0, 0x34, 0x50, 0xbb, 0x4f, 0x9b, 0xe9, 0x38,
-  0x47, 0xd0, 0x2f, 0x42, 0x97, 0x9c, 0xda, 0x2d, 0x42, 0xb7, 0x9d, 0xa6,
-  0xf4, 0x01, 0xee, 0xb5, 0xd6, 0xe8, 0xec, 0x46, 0xfb, 0x9b, 0x5c, 0x88,
-  0x16, 0x91, 0x8f, 0x9b, 0x47, 0x8b, 0x78, 0x5a, 0x89, 0x87, 0x42, 0xb9,
-  0xa6, 0x34, 0x8b, 0x86, 0x0a, 0x08, 0xe2, 0x27, 0xa0, 0x80, 0xd8, 0x3e,
-  0x78, 0x64, 0xd6, 0xeb, 0x65, 0xd2, 0x22, 0xd5, 0x18, 0x04, 0x70, 0x21,
-  0x64, 0xe1, 0x6e, 0xd3, 0xe1, 0x95, 0xe8, 0x74, 0xbf, 0xac, 0x93, 0x86,
-  0xa9, 0x56, 0xc7, 0x62, 0x4c, 0x53, 0xf6, 0x6c, 0x95, 0x74, 0xe7, 0x74,
-  0xce, 0x91, 0xa2, 0x12, 0x93, 0x0f, 0x6a, 0x85, 0x3a, 0x72, 0xba, 0x7c,
-  0x0e, 0xa8, 0x49, 0x66, 0x68, 0x31, 0x1b, 0x44, 0xaa, 0x90, 0x11, 0x69,
-  0xb1, 0xe7, 0xf4, 0xdb, 0xe9, 0xc3, 0x38, 0x39, 0x2a, 0x09, 0x81, 0xa3,
-  0x15, 0xa7, 0x66, 0xf0, 0x88, 0x9c, 0xd4, 0x22, 0x80, 0xa8, 0x8d, 0x01,
-  0xe8, 0x49, 0x18, 0xa2, 0x1c, 0x27, 0x55, 0xb1, 0x0d, 0xf2, 0xc3, 0xf8,
-  0x55, 0x2e, 0xe2, 0xa0, 0xa8, 0xc8, 0xc6, 0x92, 0x6e, 0x71, 0x21, 0xaa,
-  0xb5, 0xd1, 0x13, 0xbf, 0xe7, 0xbf, 0xb7, 0xa3, 0x56, 0xc7, 0xb6, 0xec,
-  0xb4, 0xd0, 0xd9, 0xec, 0xab, 0x73, 0x41, 0xb0, 0x0a, 0x80, 0xb2, 0x15,
-  0xe9, 0x82, 0x70, 0xd9, 0x33, 0x86, 0x4d, 0x2a, 0x8f, 0x58, 0x70, 0x66,
-  0x53, 0xa4, 0xd8, 0xce, 0x6a, 0xb9, 0x83, 0x3b, 0x29, 0x1b, 0x18, 0x5c,
-  0x64, 0x95, 0x52, 0x38, 0xf2, 0xba, 0x55, 0x95, 0x5e, 0xd5, 0xe9, 0xf8,
-  0x3e, 0x11, 0x35, 0x20, 0x87, 0xef, 0x49, 0x8f, 0xb9, 0xa8, 0x0d, 0x18,
-  0x94, 0x61, 0xf1, 0x6d, 0x45, 0x61, 0xd7, 0x96, 0x74, 0x1a, 0xd4, 0xd5,
-  0x7c, 0xb9, 0x0e, 0xf1, 0x16, 0x53, 0x53, 0xc2, 0xee, 0x04, 0x75, 0x08,
-  0xd1, 0xa4, 0xf8, 0x45, 0x6b, 0x0a, 0xfe, 0xde, 0x98, 0xd0, 0x1e, 0xd7,
-  0x0e, 0x0c, 0xd5, 0x94, 0x37, 0x7d, 0x9c, 0x0b, 0xe6, 0x9f, 0x75, 0xcd,
-  0xfc, 0x48, 0x59, 0x98, 0xe9, 0x48, 0x2e, 0xa9, 0x80, 0x43, 0x0b, 0x9d,
-  0xfa, 0xda, 0x99, 0x38, 0x58, 0xa6, 0xbe, 0x72, 0x66, 0xec, 0xe4, 0x4c,
-  0x8b, 0x4c, 0x22, 0xbe, 0xc8, 0x28, 0xa0, 0x28, 0x26, 0x1f, 0x9e, 0x79,
-  0xd1, 0x11, 0xfd, 0x9a, 0x81, 0xda, 0xc2, 0x0e, 0xbe, 0x7c, 0x5c, 0xfb,
-  0x6d, 0xdb, 0x28, 0x3f, 0xbf, 0xd7, 0xa8, 0xc1, 0x5c, 0x43, 0xc7, 0x7e,
-  0xf7, 0x7c, 0xd0, 0xce, 0x1e, 0x5e, 0xaa, 0x57, 0x2a, 0x04, 0xe3, 0xb0,
-  0x24, 0xca, 0x82, 0xd5, 0xf5, 0xff, 0x24, 0x86, 0x51, 0x41, 0xc1, 0x49,
-  0x1e, 0xe5, 0x68, 0x43, 0xea, 0x02, 0x42, 0xb0, 0xdc, 0xf9, 0x2c, 0x89,
-  0xc9, 0xc7, 0x53, 0x18, 0x8b, 0xe8, 0x75, 0xa8, 0x65, 0x60, 0x7f, 0x43,
-  0xef, 0x18, 0x2b, 0x69, 0xac, 0x0b, 0x14, 0x8b, 0x30, 0x64, 0x6d, 0x03,
-  0xe9, 0xbe, 0x24, 0xd5, 0xe2, 0x0c, 0xf6, 0x38, 0xe0, 0x44, 0x88, 0x9d,
-  0x6a, 0x54, 0x71, 0x5e, 0x86, 0xeb, 0x4c, 0x05, 0x10, 0xe1, 0xe6, 0xf8,
-  0xc0, 0x77, 0xf6, 0x10, 0x16, 0x3b, 0x12, 0x64, 0x90, 0x6f, 0x40, 0xd2,
-  0xe7, 0xb8, 0x1c, 0x03, 0x23, 0x4a, 0x52, 0x05, 0x40, 0x51, 0x43, 0x36,
-  0x85, 0x44, 0xe4, 0x5a, 0x34, 0x00, 0xc5, 0x2b, 0x4d, 0x55, 0x0a, 0x8e,
-  0xc0, 0x51, 0x25, 0x34, 0x92, 0x07, 0x35, 0x00, 0x47, 0x3a, 0x19, 0xeb,
-  0xc2, 0xe2, 0xb0, 0xbb, 0x02, 0x70, 0x0c, 0xbc, 0xb5, 0x60, 0xc9, 0xd9,
-  0x4c, 0xe6, 0x54, 0x59, 0x5f, 0x18, 0x8c, 0x8a, 0x45, 0xd5, 0xbc, 0x23,
-  0x11, 0xab, 0x0a, 0xb5, 0x65, 0xa7, 0xa3, 0x2c, 0x61, 0x6a, 0xb3, 0xf7,
-  0xc8, 0x09, 0xab, 0x64, 0x4f, 0xe7, 0x7c, 0x32, 0x52, 0x49, 0x58, 0x22,
-  0x3a, 0xdc, 0xe5, 0x64, 0xe2, 0x41, 0x2f, 0x03, 0x16, 0x79, 0x3e, 0x4a,
-  0x57, 0x49, 0xdc, 0xc7, 0xc3, 0xe0, 0xa6, 0x71, 0xc9, 0x86, 0x2a, 0x0d,
-  0xaa, 0x8f, 0x78, 0x81, 0x05, 0xa4, 0x78, 0xf7, 0xde, 0xdd, 0x6a, 0xf7,
-  0x3e, 0xcf, 0xb3, 0x19, 0xfd, 0xec, 0xce, 0x71, 0x47, 0x66, 0x2b, 0x16,
-  0xe5, 0x5e, 0xe2, 0xa7, 0x32, 0xae, 0x5d, 0x2d, 0xc8, 0x0b, 0x96, 0xab,
-  0xc6, 0xae, 0x28, 0xf6, 0xfb, 0xd5, 0x31, 0x0c, 0x2b, 0xc4, 0xb7, 0xf6,
-  0x15, 0xe2, 0xa0, 0xe3, 0x21, 0xc1, 0x7b, 0xa6, 0xd9, 0x14, 0xf2, 0x7c,
-  0xc7, 0x3f, 0xde, 0x3c, 0x71, 0xa0, 0x2e, 0x7a, 0x1b, 0x21, 0x56, 0x95,
-  0x4b, 0x76, 0xd0, 0x9a, 0x7a, 0x52, 0x82, 0xae, 0x04, 0x5a, 0xd8, 0x74,
-  0x3d, 0xd7, 0xde, 0xb4, 0xc1, 0x4c, 0x64, 0x78, 0x7e, 0x78, 0xf7, 0xda,
-  0x8d, 0xe4, 0x10, 0xbf, 0x83, 0xc8, 0x5b, 0xbf, 0xc2, 0x68, 0x8c, 0xfd,
-  0xb1, 0x22, 0xcc, 0x8e, 0x8b, 0x23, 0x44, 0x1f, 0xfc, 0xeb, 0x22, 0x4a,
-  0x2c, 0x3b, 0xa5, 0x1c, 0x1d, 0x8c, 0x41, 0x1e, 0x9e, 0x90, 0xc1, 0x99,
-  0xdc, 0x64, 0x81, 0xa2, 0xae, 0x6b, 0x8d, 0xb5, 0x1e, 0xdd, 0xce, 0x62,
-  0x37, 0x2a, 0x57, 0xbb, 0x18, 0xe2, 0xa3, 0xe4, 0xd6, 0x97, 0x6d, 0xb3,
-  0x0a, 0x1b, 0x2e, 0x7c, 0xc1, 0x89, 0x1a, 0x6c, 0xda, 0xf3, 0xba, 0x73,
-  0xb0, 0x52, 0x70, 0xcd, 0x6d, 0xee, 0x91, 0xd0, 0xb5, 0xeb, 0x10, 0xa2,
-  0x6a, 0xee, 0xef, 0xcf, 0xef, 0x45, 0x41, 0x02, 0xba, 0xa6, 0x54, 0x54,
-  0x01, 0xe9, 0xef, 0xb5, 0xfb, 0x2e, 0xc8, 0xb2, 0x16, 0x42, 0x31, 0xd4,
-  0x25, 0x33, 0x6a, 0x31, 0x80, 0x51, 0x01, 0xcb, 0x69, 0xd2, 0x7a, 0xb6,
-  0x4c, 0x29, 0x32, 0x7b, 0x75, 0xce, 0x71, 0x2f, 0x3c, 0x01, 0x7b, 0x78,
-  0xf4, 0xd4, 0x4f, 0xf1, 0xed, 0x60, 0xbe, 0x57, 0xdd, 0x60, 0x86, 0x7b,
-  0xe8, 0xb6, 0x8c, 0x94, 0xa4, 0x08, 0x2b, 0x4d, 0x56, 0x6e, 0x4a, 0x3a,
-  0x6f, 0xc8, 0x0a, 0xf1, 0xb5, 0xb6, 0xad, 0xdf, 0x3f, 0xd8, 0x7f, 0xb1,
-  0x8f, 0xb5, 0x81, 0xa7, 0x29, 0xdf, 0xba, 0x9c, 0xcc, 0xd3, 0x55, 0x74,
-  0xb9, 0x9c, 0xc3, 0x57, 0x0c, 0xf1, 0xb9, 0x23, 0x9a, 0xca, 0xd8, 0xfd,
-  0xe3, 0xd3, 0xf4, 0xf8, 0x0c, 0x6f, 0x1a, 0x30, 0x24, 0x9d, 0xb2, 0xe4,
-  0xa2, 0x63, 0x1d, 0xce, 0x9f, 0x8d, 0x39, 0x0f, 0x20, 0x82, 0x35, 0x45,
-  0x53, 0x50, 0x2e, 0xb2, 0xc5, 0x24, 0x25, 0x1e, 0x40, 0xef, 0x7b, 0x8e,
-  0x86, 0x6b, 0x2e, 0x6d, 0x47, 0x91, 0x43, 0x3a, 0x8d, 0x40, 0xd6, 0x87,
-  0xa1, 0x3a, 0x08, 0x2a, 0xbf, 0xdc, 0x26, 0xa7, 0x35, 0xe1, 0x41, 0xce,
-  0x33, 0x0e, 0x1c, 0x10, 0x3b, 0x2b, 0x82, 0x98, 0xf3, 0x92, 0x90, 0x72,
-  0x01, 0x4b, 0x08, 0xd6, 0x1d, 0xc6, 0xda, 0xe6, 0x66, 0x2b, 0x4f, 0xf1,
-  0x6d, 0x86, 0x43, 0xcc, 0xad, 0xb4, 0x1b, 0xd0, 0xc6, 0x88, 0xab, 0x10,
-  0x87, 0xdd, 0x8e, 0xf2, 0x32, 0x46, 0xd8, 0x0a, 0xcd, 0x4b, 0x1a, 0x38,
-  0x32, 0x5b, 0x2f, 0x25, 0xd0, 0xae, 0x90, 0xf0, 0x84, 0x6e, 0x58, 0x9d,
-  0xfd, 0x88, 0x64, 0x31, 0x1d, 0x9e, 0xe1, 0xfb, 0x91, 0x80, 0x18, 0x94,
-  0x85, 0x89, 0x09, 0x5e, 0xf8, 0x56, 0x56, 0xdf, 0x90, 0x07, 0xdd, 0x63,
-  0x86, 0xbf, 0x57, 0xbe, 0x67, 0xd7, 0xe9, 0x48, 0x5d, 0x7a, 0x54, 0xe5,
-  0xb7, 0xa7, 0x72, 0x59, 0xd1, 0x89, 0x4f, 0xf7, 0xce, 0xa1, 0x96, 0x19,
-  0x15, 0xce, 0x20, 0x60, 0x58, 0x5f, 0xf0, 0x5a, 0x99, 0xa9, 0xf1, 0x2c,
-  0x29, 0x17, 0xfe, 0xf3, 0xd3, 0x6c, 0x32, 0x4a, 0xa8, 0x7f, 0x4e, 0xa1,
-  0xe6, 0x5f, 0x45, 0x39, 0x86, 0xbc, 0xff, 0x4d, 0xd0, 0x92, 0x0c, 0xb6,
-  0x6b, 0xf5, 0xfb, 0xcc, 0x10, 0x24, 0xa5, 0x39, 0x6d, 0x0d, 0x35, 0x6f,
-  0xb5, 0x1f, 0xdb, 0xc3, 0xf8, 0xc3, 0xab, 0x7f, 0xdc, 0xa1, 0x64, 0xa2,
-  0xe1, 0xa7, 0xf9, 0x45, 0xea, 0x81, 0x13, 0xdf, 0x15, 0x4b, 0xb3, 0xaf,
-  0x7e, 0xc0, 0x4b, 0x4f, 0x37, 0x45, 0x3f, 0x7f, 0x43, 0xa6, 0x69, 0x15,
-  0x34, 0x34, 0x73, 0xba, 0x3a, 0x0e, 0x78, 0x61, 0xbd, 0x04, 0xc9, 0xc8,
-  0x21, 0x4b, 0xfc, 0x5c, 0xb7, 0xcb, 0xd0, 0xca, 0x7e, 0xa3, 0x62, 0xb4,
-  0x6a, 0xa6, 0x18, 0xf2, 0xd6, 0x5c, 0xdf, 0x9a, 0x48, 0x50, 0xf7, 0xc1,
-  0x45, 0xda, 0xb3, 0xe1, 0xcc, 0xe4, 0x30, 0x85, 0x96, 0x1e, 0x4f, 0x66,
-  0x91, 0x6f, 0xaf, 0x95, 0x1b, 0x31, 0x65, 0xee, 0x54, 0x57, 0x10, 0x79,
-  0x42, 0xa2, 0x04, 0x18, 0x67, 0xbc, 0xf6, 0xad, 0x89, 0xcf, 0xbb, 0xc2,
-  0xfd, 0x5b, 0x03, 0x61, 0xd8, 0x58, 0x8b, 0x75, 0xeb, 0x74, 0xf7, 0xfc,
-  0xfb, 0x4d, 0xf0, 0x75, 0xd7, 0xba, 0xc3, 0xab, 0xa7, 0x3f, 0x9f, 0x69,
-  0x00, 0x1a, 0xcd, 0xe0, 0x94, 0xa9, 0x2c, 0x9c, 0x45, 0x58, 0x98, 0x14,
-  0x00, 0xf1, 0x24, 0xda, 0x94, 0x3c, 0xd1, 0xe2, 0x40, 0x0d, 0xd7, 0x10,
-  0x0a, 0x5b, 0xd7, 0xb0, 0x36, 0x04, 0x3b, 0x6e, 0x70, 0x83, 0x75, 0xee,
-  0x06, 0xe1, 0xc2, 0x09, 0x1a, 0xc2, 0x24, 0x2a, 0xc1, 0x55, 0x23, 0x9f,
-  0x1a, 0x2b, 0x49, 0x75, 0x33, 0xed, 0xbc, 0x06, 0x7d, 0x15, 0x2b, 0xe4,
-  0xbe, 0x1e, 0xee, 0xce, 0xec, 0xbe, 0x88, 0x48, 0xc1, 0x70, 0x96, 0x7e,
-  0x19, 0xcd, 0x2f, 0x4b, 0x4e, 0x1f, 0x22, 0x3c, 0xed, 0x71, 0x7c, 0xf2,
-  0xee, 0x6e, 0xb4, 0xf5, 0x40, 0xdd, 0xf7, 0xd9, 0x5a, 0xb0, 0x68, 0x5d,
-  0xbb, 0xd1, 0x5e, 0xde, 0xbc, 0xb6, 0xf8, 0xa2, 0x9a, 0x74, 0x0a, 0xa4,
-  0x91, 0x9e, 0x2f, 0x4a, 0x4d, 0xf7, 0xc2, 0x5a, 0x15, 0x49, 0xc9, 0xd3,
-  0x36, 0xf9, 0x6f, 0x75, 0x2d, 0x07, 0x0c, 0xe4, 0xa6, 0xc2, 0x16, 0x18,
-  0x49, 0xad, 0x4b, 0x69, 0x58, 0x83, 0xbb, 0x38, 0x47, 0xdd, 0x83, 0xdf,
-  0x4e, 0xe6, 0x92, 0x86, 0x88, 0x2b, 0xbb, 0xa1, 0x1a, 0x4d, 0x49, 0xee,
-  0xe9, 0xb6, 0xfc, 0x5b, 0xa7, 0xe1, 0xa5, 0x93, 0x39, 0xc8, 0x9e, 0xd9,
-  0xfa, 0xf3, 0xf0, 0x62, 0xc8, 0x29, 0xfa, 0xbd, 0x59, 0xba, 0xee, 0x6f,
-  0x7e, 0x7b, 0xb4, 0x4c, 0x4f, 0xd2, 0xab, 0x05, 0x09, 0xdd, 0x50, 0xc7,
-  0xe1, 0x05, 0xdd, 0xfc, 0x9e, 0x61, 0xa1, 0x82, 0xc5, 0x7c, 0x44, 0x09,
-  0xf1, 0xe3, 0xe1, 0x7a, 0x34, 0xbf, 0xea, 0x63, 0x60, 0xed, 0x0a, 0x3b,
-  0xca, 0x7e, 0xf0, 0x6c, 0xbc, 0x22, 0x1d, 0x33, 0xa2, 0x18, 0xf2, 0x31,
-  0x66, 0xc5, 0xae, 0x23, 0x7e, 0xa1, 0x29, 0x01, 0x32, 0xed, 0x62, 0x34,
-  0x2c, 0x05, 0xc9, 0x8d, 0x57, 0x97, 0xfd, 0xf1, 0xb8, 0x0f, 0x02, 0xad,
-  0x8f, 0xd2, 0x15, 0x3b, 0x14, 0x02, 0x22, 0x20, 0xa7, 0xfc, 0x48, 0x86,
-  0xbb, 0x9b, 0xae, 0x8e, 0x87, 0x0b, 0x90, 0xeb, 0x9e, 0xe7, 0x05, 0xd8,
-  0x62, 0x06, 0xba, 0x06, 0xe8, 0xc0, 0xef, 0xb0, 0x1d, 0x68, 0x03, 0xfd,
-  0x8f, 0xbf, 0x0c, 0xbb, 0xbf, 0x6e, 0x76, 0xbf, 0x1d, 0xf4, 0xa2, 0x3b,
-  0x77, 0x07, 0xdf, 0xfc, 0xf9, 0x5e, 0x3c, 0x48, 0x06, 0xed, 0xef, 0x06,
-  0xbf, 0x1c, 0xfd, 0x73, 0xf0, 0xef, 0xc1, 0xf5, 0x7f, 0x06, 0x9d, 0x8d,
-  0xc7, 0xbb, 0x83, 0x8f, 0x83, 0xc3, 0xee, 0x61, 0xff, 0x24, 0x73, 0x75,
-  0x4f, 0x0d, 0x1d, 0xc6, 0x68, 0x2d, 0x41, 0xb1, 0x5b, 0x27, 0xf1, 0x1e,
-  0xc6, 0xb3, 0x45, 0x43, 0xf3, 0x08, 0xf6, 0x2c, 0x7f, 0x73, 0xcd, 0x52,
-  0x1d, 0x64, 0x34, 0x05, 0x5c, 0x26, 0x1e, 0x54, 0x58, 0x89, 0xa1, 0xad,
-  0x2a, 0x40, 0xf8, 0xd6, 0x90, 0x1e, 0x36, 0x97, 0x41, 0x42, 0x48, 0xc1,
-  0x68, 0x69, 0xae, 0x59, 0x4d, 0x49, 0x76, 0xcb, 0xf4, 0x38, 0xcd, 0xc0,
-  0x5a, 0x18, 0xea, 0x5c, 0xe6, 0x2f, 0xa8, 0x22, 0xe2, 0x64, 0x16, 0x72,
-  0x8c, 0x9b, 0xe3, 0x00, 0xe1, 0x11, 0x5a, 0x15, 0xd8, 0x9b, 0xfd, 0xf7,
-  0xca, 0xb2, 0xd0, 0x36, 0x45, 0x80, 0x0d, 0x31, 0x83, 0x5c, 0xcf, 0x8d,
-  0x57, 0x97, 0xf9, 0x84, 0x01, 0xb1, 0x9a, 0x35, 0x51, 0xf8, 0x33, 0x51,
-  0xb9, 0x13, 0xad, 0x50, 0x2d, 0xa4, 0xb9, 0x39, 0xcf, 0x47, 0xef, 0x2c,
-  0x26, 0x79, 0xd7, 0xec, 0x68, 0x15, 0x71, 0x05, 0x65, 0x43, 0x38, 0xbe,
-  0x5d, 0x77, 0x40, 0xa4, 0x45, 0xc9, 0x64, 0x28, 0x3f, 0x9b, 0xbe, 0x21,
-  0x97, 0x8b, 0x14, 0xe3, 0xe1, 0xff, 0x2f, 0x4f, 0xd3, 0x74, 0xc2, 0x5f,
-  0x51, 0x21, 0x53, 0xaf, 0x56, 0x63, 0x57, 0x1b, 0x22, 0x3e, 0xfb, 0x95,
-  0xcb, 0x95, 0x02, 0x45, 0x80, 0xf2, 0x76, 0x1e, 0xd1, 0x8b, 0x64, 0x55,
-  0x4a, 0x07, 0x7e, 0x4d, 0x69, 0x5f, 0xe0, 0x0b, 0xf5, 0xa6, 0x6f, 0xc7,
-  0xf8, 0x0e, 0x90, 0x49, 0xe1, 0x0a, 0xea, 0xb3, 0x1c, 0xff, 0xaa, 0xde,
-  0x60, 0xc7, 0x4c, 0x5d, 0xc6, 0x71, 0x8a, 0x53, 0x3e, 0x4b, 0xb9, 0x91,
-  0xd9, 0xc3, 0xcf, 0xe7, 0x70, 0x60, 0xe6, 0x40, 0x99, 0xb9, 0x6d, 0x6c,
-  0xe2, 0xa1, 0x55, 0x19, 0x46, 0x37, 0x64, 0x8d, 0xd6, 0xbb, 0xa3, 0x07,
-  0x12, 0xc0, 0x80, 0xe5, 0xf7, 0x0c, 0x94, 0xa9, 0x0c, 0xa4, 0x4a, 0x0a,
-  0xdc, 0x5f, 0xe5, 0x28, 0xc5, 0x6d, 0x4e, 0x3f, 0x8d, 0x4b, 0x9a, 0xd1,
-  0xc1, 0x97, 0x67, 0x97, 0xcd, 0xc8, 0x5c, 0x4e, 0x02, 0xfc, 0xd1, 0x2f,
-  0x1b, 0x47, 0xe6, 0x3a, 0xc5, 0x6d, 0xb9, 0x44, 0x65, 0x08, 0x3a, 0x17,
-  0x90, 0xea, 0x45, 0xef, 0xd7, 0x4d, 0x74, 0x02, 0xfb, 0x32, 0x4b, 0xbc,
-  0xf5, 0x23, 0xc6, 0xf4, 0x7b, 0xa0, 0x92, 0x6d, 0x5c, 0x65, 0x64, 0xd6,
-  0x45, 0x6c, 0x65, 0xa7, 0x1b, 0xa1, 0xb9, 0x72, 0xd4, 0xaf, 0x89, 0xf4,
-  0x6c, 0x7a, 0xd2, 0xe3, 0x1b, 0xfc, 0x6a, 0x4f, 0x51, 0x3d, 0xec, 0x1f,
-  0xfd, 0x1f, 0xfd, 0x37, 0x40, 0xbf, 0xc9, 0xb1, 0xbb, 0x21, 0xfa, 0x95,
-  0x6f, 0x05, 0x47, 0x51, 0xd9, 0x6d, 0xa8, 0x9f, 0xd4, 0x5f, 0x34, 0xe1,
-  0x5f, 0x78, 0x23, 0x1e, 0xd5, 0xd9, 0x5a, 0x33, 0xdd, 0xff, 0xc6, 0xbe,
-  0xdd, 0x95, 0xa9, 0x40, 0x85, 0xd2, 0xaf, 0x30, 0xff, 0xbf, 0xdb, 0x0d,
-  0x55, 0x00, 0xa8, 0x69, 0x2f, 0xde, 0x6c, 0xca, 0x4e, 0xa7, 0x7a, 0xca,
-  0x7c, 0x05, 0x39, 0x47, 0xad, 0x28, 0xb5, 0x5e, 0x6a, 0x16, 0xdc, 0x0b,
-  0x4c, 0x6c, 0x7c, 0x45, 0x60, 0x5d, 0xec, 0xa1, 0x14, 0x47, 0x0f, 0x51,
-  0x3a, 0x4b, 0x97, 0x2a, 0x48, 0x85, 0xc2, 0x51, 0x8c, 0x7a, 0x96, 0xba,
-  0x39, 0x79, 0x3a, 0x16, 0xa2, 0x5e, 0x04, 0x0b, 0x5f, 0xb5, 0xeb, 0xd0,
-  0x17, 0xf7, 0x96, 0x3d, 0x10, 0x52, 0x82, 0x9f, 0x82, 0xeb, 0x7a, 0x7e,
-  0x21, 0x65, 0x7e, 0x08, 0x8a, 0xb6, 0xb9, 0x95, 0x6b, 0x76, 0xbf, 0x5a,
-  0x9d, 0x79, 0x10, 0x2c, 0xda, 0xd5, 0xf2, 0xde, 0xe9, 0xa1, 0xac, 0x19,
-  0xae, 0x15, 0x66, 0xca, 0x84, 0x3d, 0x4f, 0x27, 0x93, 0x2c, 0x5d, 0x01,
-  0xe3, 0xc0, 0x6a, 0x0c, 0xab, 0xbe, 0xd7, 0xe9, 0xe8, 0xa7, 0xf7, 0x5b,
-  0x9b, 0x8f, 0x1e, 0xb4, 0x5c, 0xa2, 0x90, 0x31, 0x1b, 0x9e, 0xe1, 0xcb,
-  0x47, 0x66, 0xa7, 0xaf, 0x0b, 0x9b, 0xef, 0xf4, 0x91, 0x6a, 0xf1, 0xb5,
-  0x6b, 0x7d, 0xd4, 0x4b, 0x9f, 0xfc, 0x17, 0xe2, 0x54, 0xde, 0x09, 0x9d,
-  0x92, 0x00, 0x00
-};
-const unsigned int index_htm_gz_len = 9483;
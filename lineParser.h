@@ -0,0 +1,56 @@
+#ifndef __LINEPARSER_H
+#define __LINEPARSER_H
+
+#include <Arduino.h>
+
+/* Splits a message that arrives in pieces into lines without keeping the message.
+   A line is handed to 'onLine' as soon as its newline arrives - the last line may also end with finish().
+   Memory use is one line buffer. A line that does not fit is dropped and counted. */
+
+template<size_t SIZE>
+class lineParser {
+
+  public:
+    template<typename F>
+    void feed(const uint8_t* data, const size_t length, F onLine) {
+        for (size_t i = 0; i < length; i++) {
+            const char ch = data[i];
+            if (ch == '\n') {
+                endLine(onLine);
+                continue;
+            }
+            if (_length < SIZE - 1)
+                _line[_length++] = ch;
+            else
+                _overflow = true;
+        }
+    }
+
+    template<typename F>
+    void finish(F onLine) {
+        if (_length || _overflow) endLine(onLine);
+    }
+
+    size_t dropped() const {
+        return _dropped;
+    }
+
+  private:
+    template<typename F>
+    void endLine(F onLine) {
+        _line[_length] = 0;
+        if (_overflow)
+            _dropped++;
+        else
+            onLine(_line);
+        _length = 0;
+        _overflow = false;
+    }
+
+    char _line[SIZE];
+    size_t _length{ 0 };
+    size_t _dropped{ 0 };
+    bool _overflow{ false };
+};
+
+#endif
@@ -0,0 +1,55 @@
+#ifndef __LINESTREAMER_H
+#define __LINESTREAMER_H
+
+#include <Arduino.h>
+#include <functional>
+
+/* Generates a chunked response one line at a time.
+
+   'next' writes line 'index' into 'line' and returns its length - or a negative number after the last line.
+   Lines are produced on demand whenever the server asks for the next chunk.
+   The only buffer is 'line', so memory use stays the same no matter how many lines there are.
+   A line that does not fit in a chunk is finished in the next one.
+   Use as: request->beginChunkedResponse(type, [streamer](uint8_t* buffer, size_t maxLen, size_t) mutable { return streamer.fill(buffer, maxLen); }); */
+
+typedef std::function<int(const size_t index, char* line, const size_t size)> lineGenerator;
+
+class lineStreamer {
+
+  public:
+    static constexpr const size_t LINE_SIZE = 576;
+
+    explicit lineStreamer(lineGenerator next)
+      : _next(next) {}
+
+    size_t fill(uint8_t* buffer, const size_t maxLen) {
+        size_t filled = 0;
+        while (filled < maxLen) {
+            if (_sent == _length) {
+                if (_done) break;
+                const int length = _next(_index++, _line, sizeof(_line));
+                if (length < 0) {
+                    _done = true;
+                    break;
+                }
+                _length = min((size_t)length, sizeof(_line) - 1);
+                _sent = 0;
+            }
+            const size_t count = min(_length - _sent, maxLen - filled);
+            memcpy(buffer + filled, _line + _sent, count);
+            _sent += count;
+            filled += count;
+        }
+        return filled;
+    }
+
+  private:
+    lineGenerator _next;
+    char _line[LINE_SIZE];
+    size_t _length{ 0 };
+    size_t _sent{ 0 };
+    size_t _index{ 0 };
+    bool _done{ false };
+};
+
+#endif
@@ -0,0 +1,52 @@
+#ifndef __METRICS_H
+#define __METRICS_H
+
+#include <Arduino.h>
+#include <atomic>
+
+/* Prometheus text format - see https://prometheus.io/docs/instrumenting/exposition_formats/ */
+
+template<size_t N>
+class histogram {
+
+  public:
+    explicit histogram(const uint32_t (&bounds)[N])
+      : _bounds(bounds) {}
+
+    void observe(const uint32_t value) {
+        size_t bucket = 0;
+        while (bucket < N && value > _bounds[bucket]) bucket++;
+        _counts[bucket]++;
+        _sum += value;
+        _count++;
+    }
+
+    void print(Print& out, const char* name, const char* help) const {
+        out.printf("# HELP %s %s\n# TYPE %s histogram\n", name, help, name);
+        uint32_t cumulative = 0;
+        for (size_t bucket = 0; bucket < N; bucket++) {
+            cumulative += _counts[bucket];
+            out.printf("%s_bucket{le=\"%u\"} %u\n", name, _bounds[bucket], cumulative);
+        }
+        out.printf("%s_bucket{le=\"+Inf\"} %u\n", name, _count);
+        out.printf("%s_sum %llu\n%s_count %u\n", name, _sum, name, _count);
+    }
+
+  private:
+    const uint32_t (&_bounds)[N];
+    uint32_t _counts[N + 1]{};
+    uint64_t _sum{ 0 };
+    uint32_t _count{ 0 };
+};
+
+static const uint32_t LOOP_US_BOUNDS[]{ 100, 500, 1000, 5000, 10000, 50000, 100000, 500000 };
+static const uint32_t MAILBOX_WAIT_MS_BOUNDS[]{ 1, 5, 25, 100, 500, 1000, 5000 };
+
+struct playerMetrics {
+    histogram<sizeof(LOOP_US_BOUNDS) / sizeof(uint32_t)> loopTime{ LOOP_US_BOUNDS };
+    histogram<sizeof(MAILBOX_WAIT_MS_BOUNDS) / sizeof(uint32_t)> mailboxWait{ MAILBOX_WAIT_MS_BOUNDS };
+    std::atomic<uint32_t> wsMessagesIn{ 0 };
+    std::atomic<uint32_t> wsMessagesOut{ 0 };
+};
+
+#endif
@@ -0,0 +1,120 @@
+static void printMetric(Print& out, const char* name, const char* type, const char* help) {
+    out.printf("# HELP %s %s\n# TYPE %s %s\n", name, help, name, type);
+}
+
+void metricsToResponse(AsyncResponseStream* response) {
+    printMetric(*response, "estreamplayer_uptime_seconds", "gauge", "Seconds since boot.");
+    response->printf("estreamplayer_uptime_seconds %lu\n", millis() / 1000);
+
+    printMetric(*response, "estreamplayer_boot_stage_start_milliseconds", "gauge", "Milliseconds from power on until a boot stage started.");
+    for (uint8_t s = 0; s < bootStages::COUNT; s++) {
+        const auto stage = static_cast<bootStages::stage>(s);
+        if (boot.started(stage) != bootStages::NOT_YET)
+            response->printf("estreamplayer_boot_stage_start_milliseconds{stage=\"%s\"} %u\n", bootStages::name(stage), boot.started(stage));
+    }
+    printMetric(*response, "estreamplayer_boot_stage_done_milliseconds", "gauge", "Milliseconds from power on until a boot stage was done.");
+    for (uint8_t s = 0; s < bootStages::COUNT; s++) {
+        const auto stage = static_cast<bootStages::stage>(s);
+        if (boot.isDone(stage))
+            response->printf("estreamplayer_boot_stage_done_milliseconds{stage=\"%s\"} %u\n", bootStages::name(stage), boot.finished(stage));
+    }
+    if (boot.isDone(bootStages::FIRST_AUDIO)) {
+        printMetric(*response, "estreamplayer_time_to_first_audio_milliseconds", "gauge", "Milliseconds from power on until the first audio reached the decoder.");
+        response->printf("estreamplayer_time_to_first_audio_milliseconds %u\n", boot.finished(bootStages::FIRST_AUDIO));
+    }
+
+    printMetric(*response, "estreamplayer_stream_received_bytes_total", "counter", "Bytes received from streams.");
+    response->printf("estreamplayer_stream_received_bytes_total %llu\n", streamStatus.receivedBytes());
+    printMetric(*response, "estreamplayer_decoder_bytes_total", "counter", "Bytes moved from the stream buffer to the VS1053.");
+    response->printf("estreamplayer_decoder_bytes_total %llu\n", streamStatus.decodedBytes());
+    printMetric(*response, "estreamplayer_stream_buffer_used_bytes", "gauge", "Bytes in the stream buffer.");
+    response->printf("estreamplayer_stream_buffer_used_bytes %u\n", streamStatus.used());
+    printMetric(*response, "estreamplayer_stream_buffer_capacity_bytes", "gauge", "Size of the stream buffer.");
+    response->printf("estreamplayer_stream_buffer_capacity_bytes %u\n", streamStatus.capacity());
+    printMetric(*response, "estreamplayer_stream_bitrate_bps", "gauge", "Measured bitrate of the current stream.");
+    response->printf("estreamplayer_stream_bitrate_bps %u\n", streamStatus.bitrate());
+    printMetric(*response, "estreamplayer_stream_jitter_milliseconds", "gauge", "Arrival jitter of the current stream.");
+    response->printf("estreamplayer_stream_jitter_milliseconds %u\n", streamStatus.jitterMs());
+    printMetric(*response, "estreamplayer_stream_underruns", "gauge", "Buffer underruns of the current stream.");
+    response->printf("estreamplayer_stream_underruns %u\n", streamStatus.underruns());
+
+    metrics.loopTime.print(*response, "estreamplayer_playertask_loop_microseconds", "Time spent in one playerTask loop.");
+    printMetric(*response, "estreamplayer_player_mailbox_pending", "gauge", "Commands waiting for playerTask.");
+    response->printf("estreamplayer_player_mailbox_pending %u\n", mailbox.pending());
+    printMetric(*response, "estreamplayer_player_mailbox_coalesced_total", "counter", "Commands replaced by a newer command of the same kind.");
+    response->printf("estreamplayer_player_mailbox_coalesced_total %u\n", mailbox.coalesced());
+    metrics.mailboxWait.print(*response, "estreamplayer_player_mailbox_wait_milliseconds", "Time from the first waiting command until playerTask took it.");
+
+    printMetric(*response, "estreamplayer_handovers_total", "counter", "Track handovers at the end of a library file.");
+    response->printf("estreamplayer_handovers_total{kind=\"direct\"} %u\n", _directHandovers.count);
+    response->printf("estreamplayer_handovers_total{kind=\"queued\"} %u\n", _queuedHandovers.count);
+    printMetric(*response, "estreamplayer_handover_milliseconds_total", "counter", "Time from eof to the next track connected.");
+    response->printf("estreamplayer_handover_milliseconds_total{kind=\"direct\"} %u\n", _directHandovers.totalMs);
+    response->printf("estreamplayer_handover_milliseconds_total{kind=\"queued\"} %u\n", _queuedHandovers.totalMs);
+
+    printMetric(*response, "estreamplayer_playlist_journal_bytes", "gauge", "Size of the playlist journal on FFat.");
+    response->printf("estreamplayer_playlist_journal_bytes %u\n", journal.size());
+    printMetric(*response, "estreamplayer_playlist_journal_records", "gauge", "Records in the playlist journal.");
+    response->printf("estreamplayer_playlist_journal_records %u\n", journal.records());
+    printMetric(*response, "estreamplayer_playlist_journal_compactions_total", "counter", "Times the playlist journal was rewritten.");
+    response->printf("estreamplayer_playlist_journal_compactions_total %u\n", journal.compactions());
+
+    printMetric(*response, "estreamplayer_history_titles_total", "counter", "Titles added to the history.");
+    response->printf("estreamplayer_history_titles_total %u\n", history.added());
+    printMetric(*response, "estreamplayer_history_repeated_titles_total", "counter", "Titles that were the same as the newest history entry.");
+    response->printf("estreamplayer_history_repeated_titles_total %u\n", history.repeated());
+
+    printMetric(*response, "estreamplayer_ws_messages_received_total", "counter", "Websocket messages received.");
+    response->printf("estreamplayer_ws_messages_received_total %u\n", metrics.wsMessagesIn.load());
+    printMetric(*response, "estreamplayer_ws_broadcast_messages_total", "counter", "Websocket messages queued by broadcasts and state updates, once per client.");
+    response->printf("estreamplayer_ws_broadcast_messages_total %u\n", metrics.wsMessagesOut.load());
+    printMetric(*response, "estreamplayer_ws_state_dropped_total", "counter", "State messages held back from a lagging client.");
+    response->printf("estreamplayer_ws_state_dropped_total %u\n", ws.dropped());
+    printMetric(*response, "estreamplayer_ws_state_merged_total", "counter", "Held back state messages replaced by a newer value before they were sent.");
+    response->printf("estreamplayer_ws_state_merged_total %u\n", ws.merged());
+    printMetric(*response, "estreamplayer_ws_lagging_clients", "gauge", "Clients waiting for newer state values.");
+    response->printf("estreamplayer_ws_lagging_clients %u\n", ws.lagging());
+    printMetric(*response, "estreamplayer_ws_clients", "gauge", "Connected websocket clients.");
+    response->printf("estreamplayer_ws_clients %u\n", ws.count());
+    printMetric(*response, "estreamplayer_ws_client_queue_length", "gauge", "Messages waiting in the send queue of a client.");
+    for (const auto& client : ws.getClients())
+        if (client->status() == WS_CONNECTED)
+            response->printf("estreamplayer_ws_client_queue_length{client=\"%u\"} %u\n", client->id(), client->queueLen());
+
+    printMetric(*response, "estreamplayer_proxy_requests_total", "counter", "Proxied requests answered from the cache or queued for a fetch.");
+    response->printf("estreamplayer_proxy_requests_total{result=\"hit\"} %u\n", proxy.hits());
+    response->printf("estreamplayer_proxy_requests_total{result=\"miss\"} %u\n", proxy.misses());
+    printMetric(*response, "estreamplayer_proxy_revalidated_total", "counter", "Stale entries the upstream server answered with 304.");
+    response->printf("estreamplayer_proxy_revalidated_total %u\n", proxy.revalidated());
+    printMetric(*response, "estreamplayer_proxy_failures_total", "counter", "Upstream fetches that failed.");
+    response->printf("estreamplayer_proxy_failures_total %u\n", proxy.failures());
+    printMetric(*response, "estreamplayer_proxy_connections_total", "counter", "Upstream http connections used by the proxy - reused keep-alive or newly opened, a retry after a stale one counts as new.");
+    response->printf("estreamplayer_proxy_connections_total{result=\"reused\"} %u\n", proxy.reusedConnections());
+    response->printf("estreamplayer_proxy_connections_total{result=\"new\"} %u\n", proxy.newConnections());
+    printMetric(*response, "estreamplayer_proxy_stale_connections_total", "counter", "Pooled connections the server had closed - the fetch was retried.");
+    response->printf("estreamplayer_proxy_stale_connections_total %u\n", proxy.staleConnections());
+    printMetric(*response, "estreamplayer_proxy_cache_entries", "gauge", "Documents in the proxy cache.");
+    response->printf("estreamplayer_proxy_cache_entries %u\n", proxy.entries());
+    printMetric(*response, "estreamplayer_proxy_cache_bytes", "gauge", "Bytes in the proxy cache.");
+    response->printf("estreamplayer_proxy_cache_bytes %u\n", proxy.bytes());
+
+    printMetric(*response, "estreamplayer_radiobrowser_mirror_latency_milliseconds", "gauge", "Response time of the radio-browser mirror in use at the last probe.");
+    response->printf("estreamplayer_radiobrowser_mirror_latency_milliseconds %u\n", radio.latency());
+    printMetric(*response, "estreamplayer_radiobrowser_mirrors", "gauge", "Mirrors found at the last probe.");
+    response->printf("estreamplayer_radiobrowser_mirrors %u\n", radio.mirrors());
+    printMetric(*response, "estreamplayer_radiobrowser_probes_total", "counter", "Mirror probes done.");
+    response->printf("estreamplayer_radiobrowser_probes_total %u\n", radio.probes());
+
+    const uint32_t freeHeap = ESP.getFreeHeap();
+    const uint32_t largestBlock = heap_caps_get_largest_free_block(MALLOC_CAP_DEFAULT);
+    printMetric(*response, "estreamplayer_heap_free_bytes", "gauge", "Free heap.");
+    response->printf("estreamplayer_heap_free_bytes %u\n", freeHeap);
+    printMetric(*response, "estreamplayer_heap_min_free_bytes", "gauge", "Lowest free heap since boot.");
+    response->printf("estreamplayer_heap_min_free_bytes %u\n", ESP.getMinFreeHeap());
+    printMetric(*response, "estreamplayer_heap_largest_free_block_bytes", "gauge", "Largest block that can be allocated.");
+    response->printf("estreamplayer_heap_largest_free_block_bytes %u\n", largestBlock);
+    printMetric(*response, "estreamplayer_heap_fragmentation_ratio", "gauge", "1 - largest free block / free heap.");
+    response->printf("estreamplayer_heap_fragmentation_ratio %.3f\n", freeHeap ? 1.0 - (double)largestBlock / freeHeap : 0.0);
+    printMetric(*response, "estreamplayer_psram_free_bytes", "gauge", "Free PSRAM.");
+    response->printf("estreamplayer_psram_free_bytes %u\n", ESP.getFreePsram());
+}
@@ -1,29 +1,225 @@
 #include "playList.h"
 
-String& playList_t::toString(String& s) {
-    s = "playlist\n";
-    if (list.size()) {
-        for (const auto& item : list) {
-            switch (item.type) {
-
-                case HTTP_FILE:
-                    s.concat(item.url.substring(item.url.lastIndexOf("/") + 1) + "\n" + typeStr[item.type] + "\n");
-                    break;
-
-                case HTTP_PRESET:
-                    s.concat(preset[item.index].name + "\n" + typeStr[item.type] + "\n");
-                    break;
-
-                case HTTP_FOUND:
-                case HTTP_FAVORITE:
-                    s.concat(item.name + "\n" + typeStr[item.type] + "\n");
-                    break;
-
-                default:
-                    log_e("ERROR! Playlist 'item.type' has no handler!");
-                    break;
-            }
+static size_t append(char* buffer, const size_t size, size_t used, const char* src, size_t length) {
+    if (used + length >= size) length = size - used - 1;
+    memcpy(buffer + used, src, length);
+    used += length;
+    buffer[used] = 0;
+    return used;
+}
+
+bool playList_t::view(const uint32_t index, playListView& item) const {
+    item = { HTTP_FILE, { "", 0 }, { "", 0 }, { "", 0 } };
+    if (index >= list.size()) return false;
+    const playListRecord& record = list[index];
+    item.type = static_cast<streamType>(record.type);
+    if (record.type == HTTP_PRESET) {
+        item.name = { preset[record.offset].name.c_str(), preset[record.offset].name.length() };
+        item.rest = { preset[record.offset].url.c_str(), preset[record.offset].url.length() };
+        return true;
+    }
+    if (record.prefix != NO_PREFIX)
+        item.prefix = { at(prefixes[record.prefix].offset), prefixes[record.prefix].length };
+    item.rest = { at(record.offset) + record.nameLength, record.urlLength };
+    item.name = (record.type == HTTP_FILE) ? item.rest : playListSpan{ at(record.offset), record.nameLength };
+    return true;
+}
+
+size_t playList_t::url(const uint32_t index, char* buffer, const size_t size) {
+    if (!size) return 0;
+    playListView item;
+    view(index, item);
+    const size_t used = append(buffer, size, 0, item.prefix.data, item.prefix.length);
+    return append(buffer, size, used, item.rest.data, item.rest.length);
+}
+
+size_t playList_t::name(const uint32_t index, char* buffer, const size_t size) {
+    if (!size) return 0;
+    playListView item;
+    view(index, item);
+    return append(buffer, size, 0, item.name.data, item.name.length);
+}
+
+bool playList_t::add(const playListItem& item) {
+    if (full()) return false;
+
+    playListRecord record{};
+    record.type = item.type;
+    record.prefix = NO_PREFIX;
+
+    if (item.type == HTTP_PRESET) {
+        record.offset = item.index;
+        list.push_back(record);
+        return true;
+    }
+
+    const size_t urlLength = strlen(item.url);
+    if (urlLength >= PLAYLIST_MAX_URL_LENGTH) {
+        log_e("ERROR! url is too long - item not added");
+        return false;
+    }
+    const char* slash = strrchr(item.url, '/');
+    size_t prefixLength = slash ? slash - item.url + 1 : 0;
+    if (prefixLength) record.prefix = intern(item.url, prefixLength);
+    if (record.prefix == NO_PREFIX) prefixLength = 0;
+
+    const size_t nameLength = (item.type == HTTP_FILE) ? 0 : strnlen(item.name, UINT8_MAX);
+    record.offset = store(item.name, nameLength, item.url + prefixLength, urlLength - prefixLength);
+    if (record.offset == NO_ROOM) {
+        log_e("ERROR! out of memory - item not added");
+        if (record.prefix != NO_PREFIX) releasePrefix(record.prefix);
+        return false;
+    }
+    record.nameLength = nameLength;
+    record.urlLength = urlLength - prefixLength;
+    list.push_back(record);
+    return true;
+}
+
+void playList_t::remove(const uint32_t index) {
+    if (index >= list.size()) return;
+    const playListRecord record = list[index];
+    list.erase(list.begin() + index);
+    if (record.type == HTTP_PRESET) return;
+
+    release(record.offset, record.nameLength + record.urlLength);
+    if (record.prefix != NO_PREFIX) releasePrefix(record.prefix);
+}
+
+void playList_t::releasePrefix(const uint16_t id) {
+    playListPrefix& prefix = prefixes[id];
+    if (--prefix.references) return;
+    release(prefix.offset, prefix.length);
+    prefix.length = 0;
+}
+
+/* the items of a folder are usually added one after the other - so the last prefix is tried first */
+uint16_t playList_t::intern(const char* url, const size_t length) {
+    auto matches = [&](const playListPrefix& prefix) {
+        return prefix.references && prefix.length == length && !memcmp(at(prefix.offset), url, length);
+    };
+    if (_lastPrefix < prefixes.size() && matches(prefixes[_lastPrefix])) {
+        prefixes[_lastPrefix].references++;
+        return _lastPrefix;
+    }
+    uint16_t unused = NO_PREFIX;
+    for (uint16_t id = 0; id < prefixes.size(); id++) {
+        if (!prefixes[id].references) {
+            unused = id;
+            continue;
+        }
+        if (matches(prefixes[id])) {
+            prefixes[id].references++;
+            return _lastPrefix = id;
         }
     }
+    if (unused == NO_PREFIX && prefixes.size() == NO_PREFIX) return NO_PREFIX;
+    const uint32_t offset = store(url, length, "", 0);
+    if (offset == NO_ROOM) return NO_PREFIX;
+    const playListPrefix prefix{ offset, static_cast<uint16_t>(length), 1 };
+    if (unused != NO_PREFIX) {
+        prefixes[unused] = prefix;
+        return _lastPrefix = unused;
+    }
+    prefixes.push_back(prefix);
+    return _lastPrefix = prefixes.size() - 1;
+}
+
+/* copies both strings into the first page with room for them - a page with enough dead bytes is compacted first */
+uint32_t playList_t::store(const char* first, const size_t firstLength, const char* second, const size_t secondLength) {
+    const size_t length = firstLength + secondLength;
+    size_t page = pages.size();
+    if (page && PAGE_SIZE - pages[page - 1].used >= length)
+        page--;
+    else
+        for (size_t i = 0; i < pages.size(); i++)
+            if (PAGE_SIZE - pages[i].used >= length) {
+                page = i;
+                break;
+            }
+    if (page == pages.size())
+        for (size_t i = 0; i < pages.size(); i++)
+            if (PAGE_SIZE - pages[i].used + pages[i].dead >= length) {
+                compact(i);
+                page = i;
+                break;
+            }
+
+    if (page == pages.size()) pages.push_back({ nullptr, 0, 0 });
+    arenaPage& target = pages[page];
+    if (!target.data) {
+        target.data = static_cast<char*>(heap_caps_malloc(PAGE_SIZE, psramFound() ? MALLOC_CAP_SPIRAM : MALLOC_CAP_8BIT));
+        if (!target.data) return NO_ROOM;
+    }
+    memcpy(target.data + target.used, first, firstLength);
+    memcpy(target.data + target.used + firstLength, second, secondLength);
+    const uint32_t offset = page * PAGE_SIZE + target.used;
+    target.used += length;
+    return offset;
+}
+
+/* the range becomes dead bytes in its page - a page without live strings is freed */
+void playList_t::release(const uint32_t offset, const size_t length) {
+    if (!length) return;
+    arenaPage& page = pages[offset / PAGE_SIZE];
+    page.dead += length;
+    if (page.dead < page.used) return;
+    heap_caps_free(page.data);
+    page = { nullptr, 0, 0 };
+}
+
+/* moves the live strings of a page down over the dead bytes - walks all items once */
+void playList_t::compact(const size_t page) {
+    const uint32_t pageStart = page * PAGE_SIZE;
+    const uint32_t pageEnd = pageStart + PAGE_SIZE;
+    struct liveString {
+        uint32_t* offset;
+        size_t length;
+    };
+    std::vector<liveString> strings;
+    for (auto& record : list)
+        if (record.type != HTTP_PRESET && record.offset >= pageStart && record.offset < pageEnd)
+            strings.push_back({ &record.offset, static_cast<size_t>(record.nameLength + record.urlLength) });
+    for (auto& prefix : prefixes)
+        if (prefix.references && prefix.offset >= pageStart && prefix.offset < pageEnd)
+            strings.push_back({ &prefix.offset, prefix.length });
+    std::sort(strings.begin(), strings.end(), [](const liveString& a, const liveString& b) {
+        return *a.offset < *b.offset;
+    });
+
+    arenaPage& target = pages[page];
+    uint32_t used = 0;
+    for (const auto& string : strings) {
+        memmove(target.data + used, target.data + *string.offset - pageStart, string.length);
+        *string.offset = pageStart + used;
+        used += string.length;
+    }
+    target.used = used;
+    target.dead = 0;
+}
+
+
+String& playList_t::toString(String& s, const uint32_t sequence) {
+    s = "playlist\n";
+    s.concat(sequence);
+    s.concat("\n");
+    s.concat(list.size());
+    s.concat("\n");
+    return itemsToString(s, 0, PLAYLIST_WINDOW);
+}
+
+String& playList_t::itemsToString(String& s, const uint32_t first, const uint32_t count) {
+    /* one allocation for the whole range */
+    playListView item;
+    size_t length = s.length();
+    for (auto index = first; index < first + count && view(index, item); index++)
+        length += item.name.length + strlen(typeStr[item.type]) + 2;
+    s.reserve(length);
+    for (auto index = first; index < first + count && view(index, item); index++) {
+        s.concat(item.name.data, item.name.length);
+        s.concat('\n');
+        s.concat(typeStr[item.type]);
+        s.concat('\n');
+    }
     return s;
 }
@@ -2,10 +2,15 @@
 #define __PLAYLIST_H
 
 #include <Arduino.h>
+#include <algorithm>
 #include <vector>
+#include <deque>
+#include <new>
 #include "presets.h"
 
-#define PLAYLIST_MAX_ITEMS 100
+#define PLAYLIST_MAX_ITEMS 100          /* boards without PSRAM */
+#define PLAYLIST_MAX_ITEMS_PSRAM 16384
+#define PLAYLIST_WINDOW 100             /* items a client gets at a time */
 #define PLAYLIST_MAX_URL_LENGTH 255
 #define PLAYLIST_STOPPED -1 /* do not change */
 
@@ -13,12 +18,77 @@ enum streamType { HTTP_FILE,
                   HTTP_FOUND,
                   HTTP_FAVORITE,
                   HTTP_PRESET };
-static const char* typeStr[] = { "FILE", "FOUND", "FAVO", "PRESET" };
+constexpr const char* typeStr[] = { "FILE", "FOUND", "FAVO", "PRESET" };
 
+constexpr const size_t NUMBER_OF_PRESETS = sizeof(preset) / sizeof(source);
+
+/* build time checks of the preset table - C++11 constexpr functions are a single return statement */
+constexpr bool presetUrlsFit(const size_t index = 0) {
+    return index == NUMBER_OF_PRESETS || (preset[index].url.length() < PLAYLIST_MAX_URL_LENGTH && presetUrlsFit(index + 1));
+}
+constexpr bool sameString(const char* a, const char* b) {
+    return *a == *b && (!*a || sameString(a + 1, b + 1));
+}
+constexpr bool presetNameUnique(const size_t index, const size_t other) {
+    return other == NUMBER_OF_PRESETS || (!sameString(preset[index].name.c_str(), preset[other].name.c_str()) && presetNameUnique(index, other + 1));
+}
+constexpr bool presetNamesUnique(const size_t index = 0) {
+    return index == NUMBER_OF_PRESETS || (presetNameUnique(index, index + 1) && presetNamesUnique(index + 1));
+}
+static_assert(presetUrlsFit(), "a preset url in presets.h is PLAYLIST_MAX_URL_LENGTH or longer");
+static_assert(presetNamesUnique(), "two presets in presets.h have the same name");
+
+/* a string that is not zero terminated */
+struct playListSpan {
+    const char* data;
+    size_t length;
+};
+
+/* An item as it is stored - nothing is copied.
+   The url is 'prefix' followed by 'rest'. For a library file the prefix is the folder up to and including the last '/'
+   and the rest - which is also the name - is the file name. A preset points into the preset table.
+   A view is valid until the playlist is changed. */
+struct playListView {
+    streamType type;
+    playListSpan name;
+    playListSpan prefix;
+    playListSpan rest;
+};
+
+/* puts a container in PSRAM when the board has it - a failed allocation fails like any other */
+template<typename T>
+struct psramAllocator {
+    typedef T value_type;
+
+    psramAllocator() = default;
+    template<typename U>
+    psramAllocator(const psramAllocator<U>&) {}
+
+    T* allocate(const size_t n) {
+        /* internal ram comes from heap_caps_malloc too - deallocate() frees both with heap_caps_free */
+        void* data = psramFound() ? heap_caps_malloc(n * sizeof(T), MALLOC_CAP_SPIRAM) : nullptr;
+        if (!data) data = heap_caps_malloc(n * sizeof(T), MALLOC_CAP_8BIT);
+        if (!data) throw std::bad_alloc();
+        return static_cast<T*>(data);
+    }
+    void deallocate(T* data, size_t) {
+        heap_caps_free(data);
+    }
+};
+template<typename T, typename U>
+bool operator==(const psramAllocator<T>&, const psramAllocator<U>&) {
+    return true;
+}
+template<typename T, typename U>
+bool operator!=(const psramAllocator<T>&, const psramAllocator<U>&) {
+    return false;
+}
+
+/* only used to add items - the strings are copied into the playlist arena */
 struct playListItem {
     streamType type;
-    String name;
-    String url;
+    const char* name;
+    const char* url;
     uint32_t index;
 };
 
@@ -27,53 +97,145 @@ class playList_t {
   public:
     playList_t(){};
     ~playList_t() {
-        list.clear();
+        clear();
     }
     int size() {
         return list.size();
     }
 
-    void get(const uint32_t index, playListItem& item) {
-        item = (index < list.size()) ? list[index] : (playListItem){};
+    uint32_t maxItems() {
+        return psramFound() ? PLAYLIST_MAX_ITEMS_PSRAM : PLAYLIST_MAX_ITEMS;
     }
 
-    String url(const uint32_t index) {
-        return (index < list.size()) ? ((list[index].type == HTTP_PRESET) ? preset[list[index].index].url : list[index].url) : "";
+    bool full() {
+        return list.size() >= maxItems();
     }
 
-    String name(const uint32_t index) {
-        return (index < list.size()) ? ((list[index].type == HTTP_PRESET) ? preset[list[index].index].name : list[index].name) : "";
+    streamType type(const uint32_t index) {
+        return (index < list.size()) ? static_cast<streamType>(list[index].type) : HTTP_FILE;
     }
 
-    void add(const playListItem& item) {
-        if (list.size() < PLAYLIST_MAX_ITEMS) {
-            list.push_back(item);
-        }
+    /* the preset number of an HTTP_PRESET item */
+    uint32_t presetIndex(const uint32_t index) {
+        return (index < list.size() && list[index].type == HTTP_PRESET) ? list[index].offset : 0;
     }
-    void remove(const uint32_t index) {
-        if (list.size() > index) {
-            list.erase(list.begin() + index);
-        }
+
+    /* false and empty spans for an index that is not in the playlist */
+    bool view(const uint32_t index, playListView& item) const;
+
+    /* url and name are copied into 'buffer' - both return the length of the result */
+    size_t url(const uint32_t index, char* buffer, const size_t size);
+    size_t name(const uint32_t index, char* buffer, const size_t size);
+
+    /* false when the playlist is full, the url is too long or there is no memory - nothing is added then */
+    bool add(const playListItem& item);
+    void remove(const uint32_t index);
+
+    void move(const uint32_t from, const uint32_t to) {
+        if (from >= list.size() || to >= list.size() || from == to) return;
+        const playListRecord record = list[from];
+        list.erase(list.begin() + from);
+        list.insert(list.begin() + to, record);
+        if (_currentItem == PLAYLIST_STOPPED) return;
+        const uint32_t current = _currentItem;
+        if (current == from)
+            _currentItem = to;
+        else if (from < current && current <= to)
+            _currentItem--;
+        else if (to <= current && current < from)
+            _currentItem++;
+    }
+    /* moves the last 'count' items to 'to' - so items that were added at the end end up in the middle */
+    void moveTail(const uint32_t count, const uint32_t to) {
+        if (count > list.size() || to >= list.size() - count) return;
+        const uint32_t first = list.size() - count;
+        std::rotate(list.begin() + to, list.begin() + first, list.end());
+        if (_currentItem == PLAYLIST_STOPPED) return;
+        const uint32_t current = _currentItem;
+        if (current >= first)
+            _currentItem = to + (current - first);
+        else if (current >= to)
+            _currentItem += count;
     }
     void clear() {
-        if (list.size()) {
-            list.clear();
-            _currentItem = PLAYLIST_STOPPED;
-        }
+        if (list.size()) _currentItem = PLAYLIST_STOPPED;
+        list.clear();
+        prefixes.clear();
+        for (auto& page : pages) heap_caps_free(page.data);
+        pages.clear();
+        _lastPrefix = NO_PREFIX;
     }
-    String& toString(String& s);
 
-    int8_t currentItem() {
+    /* the size and the first PLAYLIST_WINDOW items - clients ask for the rest with itemsToString() */
+    String& toString(String& s, const uint32_t sequence);
+    String& itemsToString(String& s, const uint32_t first, const uint32_t count);
+
+    int32_t currentItem() {
         return _currentItem;
     }
 
-    void setCurrentItem(int8_t index) {
+    void setCurrentItem(const int32_t index) {
         _currentItem = index;
     }
 
+    bool directHandover() {
+        return _directHandover;
+    }
+
+    void setDirectHandover(const bool directHandover) {
+        _directHandover = directHandover;
+    }
+
   private:
-    std::vector<playListItem> list;
-    int8_t _currentItem{ PLAYLIST_STOPPED };
+    static constexpr const uint16_t NO_PREFIX = 0xFFFF;
+
+    /* All strings live in arena pages of PAGE_SIZE bytes - in PSRAM when there is PSRAM.
+       A string never crosses a page, an offset is the page number times PAGE_SIZE plus the position in the page.
+       A released string only adds to the dead bytes of its page and a page without live strings is freed.
+       A page is compacted when a new string does not fit anywhere else - so a removal does not walk the items.
+       Only the page table is in internal RAM.
+
+       An item stores its name followed by its url without the interned prefix.
+       A preset item has no strings and stores the preset number in 'offset'. */
+    static constexpr const uint32_t PAGE_SIZE = 2048;
+    static constexpr const uint32_t NO_ROOM = UINT32_MAX;
+    struct playListRecord {
+        uint32_t offset;
+        uint16_t prefix;
+        uint16_t urlLength;
+        uint8_t nameLength;
+        uint8_t type;
+    };
+
+    /* an url prefix is everything up to and including the last '/' */
+    struct playListPrefix {
+        uint32_t offset;
+        uint16_t length;
+        uint16_t references;
+    };
+
+    struct arenaPage {
+        char* data;
+        uint16_t used;
+        uint16_t dead; /* released bytes below 'used' */
+    };
+
+    const char* at(const uint32_t offset) const {
+        return pages[offset / PAGE_SIZE].data + offset % PAGE_SIZE;
+    }
+
+    uint32_t store(const char* first, const size_t firstLength, const char* second, const size_t secondLength);
+    uint16_t intern(const char* url, const size_t length);
+    void release(const uint32_t offset, const size_t length);
+    void compact(const size_t page);
+    void releasePrefix(const uint16_t id);
+
+    std::deque<playListRecord, psramAllocator<playListRecord>> list;
+    std::vector<playListPrefix, psramAllocator<playListPrefix>> prefixes;
+    std::vector<arenaPage> pages;
+    uint16_t _lastPrefix{ NO_PREFIX };
+    int32_t _currentItem{ PLAYLIST_STOPPED };
+    bool _directHandover{ true };
 };
 
 #endif
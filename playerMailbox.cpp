@@ -0,0 +1,92 @@
+#include "playerMailbox.h"
+
+/* call with the lock held */
+void playerMailbox::posted(const bool replaced) {
+    if (replaced)
+        _coalesced++;
+    else if (!_hasVolume && !_hasTone && _transport == NONE)
+        _posted = millis();
+}
+
+void playerMailbox::setVolume(const uint8_t volume) {
+    portENTER_CRITICAL(&_lock);
+    posted(_hasVolume);
+    _volume = volume;
+    _hasVolume = true;
+    portEXIT_CRITICAL(&_lock);
+    if (_receiver) xTaskNotifyGive(_receiver);
+}
+
+void playerMailbox::setTone(const uint8_t* tone) {
+    portENTER_CRITICAL(&_lock);
+    posted(_hasTone);
+    memcpy(_tone, tone, sizeof(_tone));
+    _hasTone = true;
+    portEXIT_CRITICAL(&_lock);
+    if (_receiver) xTaskNotifyGive(_receiver);
+}
+
+void playerMailbox::connect(const char* url, const size_t offset) {
+    const size_t length = strnlen(url, sizeof(_url[0]) - 1); /* outside the critical section - only a copy inside */
+    portENTER_CRITICAL(&_lock);
+    posted(_transport != NONE);
+    memcpy(_url[_write], url, length);
+    _url[_write][length] = 0;
+    _offset = offset;
+    _transport = CONNECT;
+    portEXIT_CRITICAL(&_lock);
+    if (_receiver) xTaskNotifyGive(_receiver);
+}
+
+void playerMailbox::connect(const playListView& item, const size_t offset) {
+    portENTER_CRITICAL(&_lock);
+    posted(_transport != NONE);
+    char* const url = _url[_write];
+    const size_t prefixLength = min(item.prefix.length, sizeof(_url[_write]) - 1);
+    const size_t restLength = min(item.rest.length, sizeof(_url[_write]) - 1 - prefixLength);
+    memcpy(url, item.prefix.data, prefixLength);
+    memcpy(url + prefixLength, item.rest.data, restLength);
+    url[prefixLength + restLength] = 0;
+    _offset = offset;
+    _transport = CONNECT;
+    portEXIT_CRITICAL(&_lock);
+    if (_receiver) xTaskNotifyGive(_receiver);
+}
+
+void playerMailbox::stop() {
+    portENTER_CRITICAL(&_lock);
+    posted(_transport != NONE);
+    _transport = STOP;
+    portEXIT_CRITICAL(&_lock);
+    if (_receiver) xTaskNotifyGive(_receiver);
+}
+
+bool playerMailbox::take(mail& m, const TickType_t ticks) {
+    if (!_receiver) _receiver = xTaskGetCurrentTaskHandle();
+    if (!pending()) ulTaskNotifyTake(pdTRUE, ticks);
+
+    portENTER_CRITICAL(&_lock);
+    const bool hasMail = _hasVolume || _hasTone || _transport != NONE;
+    if (hasMail) {
+        m.hasVolume = _hasVolume;
+        m.volume = _volume;
+        m.hasTone = _hasTone;
+        memcpy(m.tone, _tone, sizeof(m.tone));
+        m.transport = _transport;
+        m.url = _url[_write];
+        m.offset = _offset;
+        m.posted = _posted;
+        if (_transport == CONNECT) _write ^= 1;
+        _hasVolume = _hasTone = false;
+        _transport = NONE;
+    }
+    portEXIT_CRITICAL(&_lock);
+    return hasMail;
+}
+
+uint32_t playerMailbox::pending() {
+    portENTER_CRITICAL(&_lock);
+    const uint32_t count = _hasVolume + _hasTone + (_transport != NONE);
+    portEXIT_CRITICAL(&_lock);
+    return count;
+}
@@ -0,0 +1,64 @@
+#ifndef __PLAYERMAILBOX_H
+#define __PLAYERMAILBOX_H
+
+#include <Arduino.h>
+#include "playList.h"
+
+/* Commands for playerTask. Posting never blocks.
+   Every kind of command has one slot and a new command replaces a waiting one of the same kind.
+   So dragging the volume slider leaves only the latest volume, and a connect or stop replaces any waiting connect or stop.
+   The url has two buffers - playerTask reads one while the other one receives the next connect. */
+
+class playerMailbox {
+
+  public:
+    enum transportAction { NONE,
+                           CONNECT,
+                           STOP };
+
+    struct mail {
+        bool hasVolume;
+        uint8_t volume;
+        bool hasTone;
+        uint8_t tone[4];
+        transportAction transport;
+        const char* url;
+        size_t offset;
+        unsigned long posted;
+    };
+
+    playerMailbox(){};
+
+    void setVolume(const uint8_t volume);
+    void setTone(const uint8_t* tone);
+    void connect(const char* url, const size_t offset = 0);
+    void connect(const playListView& item, const size_t offset = 0); /* copies the url straight from the playlist */
+    void stop();
+
+    /* only called by playerTask - waits up to 'ticks' for mail
+       'url' stays valid until the next call */
+    bool take(mail& m, const TickType_t ticks);
+
+    uint32_t pending();
+    uint32_t coalesced() const {
+        return _coalesced;
+    }
+
+  private:
+    void posted(const bool replaced);
+
+    portMUX_TYPE _lock = portMUX_INITIALIZER_UNLOCKED;
+    TaskHandle_t _receiver{ NULL };
+    bool _hasVolume{ false };
+    uint8_t _volume{ 0 };
+    bool _hasTone{ false };
+    uint8_t _tone[4]{};
+    transportAction _transport{ NONE };
+    char _url[2][PLAYLIST_MAX_URL_LENGTH]{};
+    uint8_t _write{ 0 };
+    size_t _offset{ 0 };
+    unsigned long _posted{ 0 };
+    uint32_t _coalesced{ 0 };
+};
+
+#endif
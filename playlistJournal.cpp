@@ -0,0 +1,324 @@
+#include "playlistJournal.h"
+#include "scopedTimer.h"
+
+uint16_t playlistJournal::fletcher16(const uint8_t* data, const size_t length) {
+    uint16_t sum1 = 0;
+    uint16_t sum2 = 0;
+    for (size_t i = 0; i < length; i++) {
+        sum1 = (sum1 + data[i]) % 255;
+        sum2 = (sum2 + sum1) % 255;
+    }
+    return (sum2 << 8) | sum1;
+}
+
+void playlistJournal::put32(uint8_t* to, const uint32_t value) {
+    to[0] = value;
+    to[1] = value >> 8;
+    to[2] = value >> 16;
+    to[3] = value >> 24;
+}
+
+uint32_t playlistJournal::get32(const uint8_t* from) {
+    return from[0] | from[1] << 8 | from[2] << 16 | (uint32_t)from[3] << 24;
+}
+
+size_t playlistJournal::encode(uint8_t* record, const recordType type, const uint8_t* payload, const size_t length) {
+    record[0] = MAGIC;
+    record[1] = type;
+    record[2] = length & 0xFF;
+    record[3] = length >> 8;
+    if (length) memcpy(record + HEADER_SIZE, payload, length);
+    const uint16_t checksum = fletcher16(record, HEADER_SIZE + length);
+    record[HEADER_SIZE + length] = checksum & 0xFF;
+    record[HEADER_SIZE + length + 1] = checksum >> 8;
+    return HEADER_SIZE + length + CHECKSUM_SIZE;
+}
+
+/* library files need only their url - presets only their number */
+size_t playlistJournal::encodeItem(uint8_t* payload, playList_t& list, const uint32_t index) {
+    const streamType type = list.type(index);
+    payload[0] = type;
+    payload[1] = 0;
+    payload[2] = 0;
+    put32(payload + 3, 0);
+    if (type == HTTP_PRESET) {
+        put32(payload + 3, list.presetIndex(index));
+        return ADD_SIZE;
+    }
+    playListView item;
+    list.view(index, item);
+    payload[1] = (type == HTTP_FILE) ? 0 : item.name.length;
+    payload[2] = item.prefix.length + item.rest.length;
+    memcpy(payload + ADD_SIZE, item.name.data, payload[1]);
+    memcpy(payload + ADD_SIZE + payload[1], item.prefix.data, item.prefix.length);
+    memcpy(payload + ADD_SIZE + payload[1] + item.prefix.length, item.rest.data, item.rest.length);
+    return ADD_SIZE + payload[1] + payload[2];
+}
+
+bool playlistJournal::begin(const char* path, SemaphoreHandle_t listLock) {
+    _path = path;
+    _tempPath = _path + ".tmp";
+    _lock = listLock;
+    if (!_lock) return false;
+
+    /* power was lost during compaction between removing the journal and renaming the temp file */
+    if (!FFat.exists(_path.c_str()) && FFat.exists(_tempPath.c_str()))
+        FFat.rename(_tempPath.c_str(), _path.c_str());
+
+    if (!FFat.exists(_path.c_str())) {
+        File empty = FFat.open(_path, FILE_WRITE);
+        empty.close();
+        return true;
+    }
+
+    xSemaphoreTakeRecursive(_lock, portMAX_DELAY);
+    bool success;
+    {
+        scopedTimer timer("playlist journal replay");
+        success = replay();
+    }
+    if (!success) {
+        xSemaphoreGiveRecursive(_lock);
+        log_e("ERROR! Could not read %s", path);
+        return false;
+    }
+
+    if (_current >= _list.size()) _current = PLAYLIST_STOPPED;
+    _resumeItem = _current;
+    _resumeOffset = (_current != PLAYLIST_STOPPED && _list.type(_current) == HTTP_FILE) ? _offset : 0;
+    xSemaphoreGiveRecursive(_lock);
+    log_i("Restored %i playlist items from %i records - resume at item %i offset %i", _list.size(), _records, _resumeItem, _resumeOffset);
+    _compactedSize = _fileSize;
+    return true;
+}
+
+bool playlistJournal::replay() {
+    File file = FFat.open(_path);
+    if (!file) return false;
+    const uint32_t fileSize = file.size();
+    uint8_t record[HEADER_SIZE + MAX_PAYLOAD + CHECKSUM_SIZE];
+    uint32_t offset = 0;
+    while (offset + HEADER_SIZE <= fileSize) {
+        if (file.read(record, HEADER_SIZE) != HEADER_SIZE) break;
+        const size_t length = record[2] | record[3] << 8;
+        if (record[0] != MAGIC || record[1] < ADD || record[1] > SPLICE || length > MAX_PAYLOAD) break;
+        const size_t size = HEADER_SIZE + length + CHECKSUM_SIZE;
+        if (offset + size > fileSize || file.read(record + HEADER_SIZE, size - HEADER_SIZE) != size - HEADER_SIZE) break;
+        if (fletcher16(record, size - CHECKSUM_SIZE) != (record[size - 2] | record[size - 1] << 8)) break;
+
+        apply(static_cast<recordType>(record[1]), record + HEADER_SIZE, length);
+        _items = _list.size();
+        _records++;
+        offset += size;
+    }
+    file.close();
+    _fileSize = offset;
+
+    if (offset < fileSize) {
+        log_w("Dropping %i bytes of corrupt data at the end of %s", fileSize - offset, _path.c_str());
+        if (!compact()) _damaged = true;
+    }
+    return true;
+}
+
+void playlistJournal::apply(const recordType type, const uint8_t* payload, const size_t length) {
+    switch (type) {
+        case ADD:
+            {
+                if (length < ADD_SIZE || length != ADD_SIZE + payload[1] + payload[2] || payload[0] > HTTP_PRESET) return;
+                const uint32_t presetIndex = get32(payload + 3);
+                if (payload[0] == HTTP_PRESET && presetIndex >= NUMBER_OF_PRESETS) return;
+                char name[UINT8_MAX + 1];
+                char url[UINT8_MAX + 1];
+                memcpy(name, payload + ADD_SIZE, payload[1]);
+                name[payload[1]] = 0;
+                memcpy(url, payload + ADD_SIZE + payload[1], payload[2]);
+                url[payload[2]] = 0;
+                if (!_list.add({ static_cast<streamType>(payload[0]), name, url, presetIndex }))
+                    log_w("Could not restore '%s'", url);
+            }
+            break;
+        case REMOVE:
+            if (length == 4) _list.remove(get32(payload));
+            break;
+        case MOVE:
+            if (length == 8) _list.move(get32(payload), get32(payload + 4));
+            break;
+        case CLEAR:
+            _list.clear();
+            _current = PLAYLIST_STOPPED;
+            _offset = 0;
+            break;
+        case CURRENT:
+            if (length != 4) return;
+            _current = get32(payload);
+            _offset = 0;
+            break;
+        case POSITION:
+            if (length == 8 && (int32_t)get32(payload) == _current) _offset = get32(payload + 4);
+            break;
+        case SPLICE:
+            if (length == 8) _list.moveTail(get32(payload + 4), get32(payload));
+            break;
+    }
+}
+
+/* after a failed write nothing is appended until compact() has rewritten the file */
+bool playlistJournal::append(const recordType type, const uint8_t* payload, const size_t length) {
+    if (_damaged) return false;
+    uint8_t record[HEADER_SIZE + MAX_PAYLOAD + CHECKSUM_SIZE];
+    const size_t size = encode(record, type, payload, length);
+
+    File file = FFat.open(_path, FILE_APPEND);
+    if (!file) {
+        log_e("ERROR! Could not open %s", _path.c_str());
+        return false;
+    }
+    const size_t bytesWritten = file.write(record, size);
+    file.close();
+    if (bytesWritten != size) {
+        log_e("ERROR! Could not write to %s - disk full?", _path.c_str());
+        _damaged = true;
+        return false;
+    }
+    _fileSize += size;
+    _records++;
+    return true;
+}
+
+void playlistJournal::added(const uint32_t first, const uint32_t count) {
+    if (!_lock) return;
+    xSemaphoreTakeRecursive(_lock, portMAX_DELAY);
+    uint8_t payload[MAX_PAYLOAD];
+    uint32_t written = 0;
+    for (uint32_t index = first; index < first + count && index < (uint32_t)_list.size(); index++) {
+        append(ADD, payload, encodeItem(payload, _list, index));
+        _items++;
+        written++;
+    }
+    if (written && first + written < (uint32_t)_list.size()) {
+        put32(payload, first);
+        put32(payload + 4, written);
+        append(SPLICE, payload, 8);
+    }
+    compactIfGrown();
+    xSemaphoreGiveRecursive(_lock);
+}
+
+void playlistJournal::removed(const uint32_t index) {
+    if (!_lock) return;
+    xSemaphoreTakeRecursive(_lock, portMAX_DELAY);
+    uint8_t payload[4];
+    put32(payload, index);
+    append(REMOVE, payload, sizeof(payload));
+    _items--;
+    compactIfGrown();
+    xSemaphoreGiveRecursive(_lock);
+}
+
+void playlistJournal::moved(const uint32_t from, const uint32_t to) {
+    if (!_lock) return;
+    xSemaphoreTakeRecursive(_lock, portMAX_DELAY);
+    uint8_t payload[8];
+    put32(payload, from);
+    put32(payload + 4, to);
+    append(MOVE, payload, sizeof(payload));
+    compactIfGrown();
+    xSemaphoreGiveRecursive(_lock);
+}
+
+/* nothing before a clear is alive - start a new file */
+void playlistJournal::cleared() {
+    if (!_lock) return;
+    xSemaphoreTakeRecursive(_lock, portMAX_DELAY);
+    _current = PLAYLIST_STOPPED;
+    _offset = 0;
+    compact();
+    xSemaphoreGiveRecursive(_lock);
+}
+
+void playlistJournal::current(const int32_t item) {
+    if (!_lock) return;
+    xSemaphoreTakeRecursive(_lock, portMAX_DELAY);
+    if (item != _current) {
+        uint8_t payload[4];
+        put32(payload, item);
+        append(CURRENT, payload, sizeof(payload));
+        _current = item;
+        _offset = 0;
+        _lastPositionWrite = millis();
+        compactIfGrown();
+    }
+    xSemaphoreGiveRecursive(_lock);
+}
+
+void playlistJournal::position(const int32_t item, const uint32_t offset) {
+    if (!_lock || item == PLAYLIST_STOPPED || millis() - _lastPositionWrite < POSITION_INTERVAL_MS) return;
+    xSemaphoreTakeRecursive(_lock, portMAX_DELAY);
+    if (item == _current && offset != _offset) {
+        uint8_t payload[8];
+        put32(payload, item);
+        put32(payload + 4, offset);
+        append(POSITION, payload, sizeof(payload));
+        _offset = offset;
+        _lastPositionWrite = millis();
+        compactIfGrown();
+    }
+    xSemaphoreGiveRecursive(_lock);
+}
+
+void playlistJournal::compactIfGrown() {
+    if (inStep() && (_damaged || (_fileSize > MIN_COMPACT_SIZE && _fileSize > 2 * _compactedSize))) compact();
+}
+
+/* writes the playlist as it is now to a temp file that replaces the journal */
+bool playlistJournal::compact() {
+    File out = FFat.open(_tempPath, FILE_WRITE);
+    if (!out) {
+        log_e("ERROR! Could not compact %s", _path.c_str());
+        return false;
+    }
+
+    uint32_t size = 0;
+    uint32_t records = 0;
+    bool success = true;
+    uint8_t payload[MAX_PAYLOAD];
+    uint8_t record[HEADER_SIZE + MAX_PAYLOAD + CHECKSUM_SIZE];
+    auto write = [&](const recordType type, const size_t length) {
+        const size_t recordSize = encode(record, type, payload, length);
+        success = success && out.write(record, recordSize) == recordSize;
+        size += recordSize;
+        records++;
+    };
+    for (uint32_t index = 0; index < (uint32_t)_list.size(); index++)
+        write(ADD, encodeItem(payload, _list, index));
+    if (_current != PLAYLIST_STOPPED) {
+        put32(payload, _current);
+        write(CURRENT, 4);
+        if (_offset) {
+            put32(payload + 4, _offset);
+            write(POSITION, 8);
+        }
+    }
+    out.close();
+
+    if (!success || (FFat.exists(_path.c_str()) && !FFat.remove(_path.c_str()))) {
+        log_e("ERROR! Compacting %s failed", _path.c_str());
+        FFat.remove(_tempPath.c_str());
+        return false;
+    }
+    /* the temp file is the only copy now - begin() renames it, appends wait for the next compaction */
+    if (!FFat.rename(_tempPath.c_str(), _path.c_str())) {
+        log_e("ERROR! Could not rename %s", _tempPath.c_str());
+        _damaged = true;
+        return false;
+    }
+
+    log_d("Compacted %s from %i to %i bytes", _path.c_str(), _fileSize, size);
+    _fileSize = _compactedSize = size;
+    _items = _list.size();
+    _records = records;
+    _damaged = false;
+    _compactions++;
+    return true;
+}
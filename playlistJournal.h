@@ -0,0 +1,104 @@
+#ifndef __PLAYLISTJOURNAL_H
+#define __PLAYLISTJOURNAL_H
+
+#include <Arduino.h>
+#include <FFat.h>
+#include "playList.h"
+
+/* The playlist, the current item and the position in it survive a reboot in an append-only file on FFat.
+
+   A record is a 4 byte header - magic, type and payload length - followed by the payload and a Fletcher-16 checksum.
+   Every playlist change appends one small record, begin() replays them into the playlist.
+   Items inserted in the middle are written as added at the end followed by a SPLICE record that moves them in place.
+   A torn or corrupt tail - power lost while writing - is dropped.
+
+   Position records are written at most once every POSITION_INTERVAL_MS so the progress updates do not wear the flash.
+   The file is rewritten with one record per item when it has grown to twice its size after the previous compaction.
+   That is only done when the playlist and the journal are in step, the playlist is written out as it is. */
+
+class playlistJournal {
+
+  public:
+    explicit playlistJournal(playList_t& list)
+      : _list(list) {}
+
+    /* replay 'path' into the playlist - 'listLock' is the recursive mutex that guards the playlist
+       the journal takes it for every change, so a compaction writes the playlist as one state */
+    bool begin(const char* path, SemaphoreHandle_t listLock);
+
+    /* call these after the playlist has changed */
+    void added(const uint32_t first, const uint32_t count);
+    void removed(const uint32_t index);
+    void moved(const uint32_t from, const uint32_t to);
+    void cleared();
+    void current(const int32_t item);
+    void position(const int32_t item, const uint32_t offset);
+
+    /* where playback was when the journal was last written */
+    int32_t resumeItem() const {
+        return _resumeItem;
+    }
+    uint32_t resumeOffset() const {
+        return _resumeOffset;
+    }
+
+    uint32_t records() const {
+        return _records;
+    }
+    uint32_t compactions() const {
+        return _compactions;
+    }
+    uint32_t size() const {
+        return _fileSize;
+    }
+
+  private:
+    enum recordType : uint8_t { ADD = 1,
+                                REMOVE,
+                                MOVE,
+                                CLEAR,
+                                CURRENT,
+                                POSITION,
+                                SPLICE };
+
+    static constexpr const uint8_t MAGIC = 0xB7;
+    static constexpr const size_t HEADER_SIZE = 4;
+    static constexpr const size_t CHECKSUM_SIZE = 2;
+    static constexpr const size_t ADD_SIZE = 7; /* item type, name length, url length, preset number */
+    static constexpr const size_t MAX_PAYLOAD = ADD_SIZE + 2 * PLAYLIST_MAX_URL_LENGTH;
+    static constexpr const uint32_t POSITION_INTERVAL_MS = 20 * 1000;
+    static constexpr const uint32_t MIN_COMPACT_SIZE = 8 * 1024;
+
+    static uint16_t fletcher16(const uint8_t* data, const size_t length);
+    static size_t encode(uint8_t* record, const recordType type, const uint8_t* payload, const size_t length);
+    static size_t encodeItem(uint8_t* payload, playList_t& list, const uint32_t index);
+    static void put32(uint8_t* to, const uint32_t value);
+    static uint32_t get32(const uint8_t* from);
+
+    bool append(const recordType type, const uint8_t* payload, const size_t length);
+    void apply(const recordType type, const uint8_t* payload, const size_t length);
+    bool replay();
+    bool compact();
+    void compactIfGrown();
+    bool inStep() {
+        return _items == (uint32_t)_list.size();
+    }
+
+    playList_t& _list;
+    String _path;
+    String _tempPath;
+    SemaphoreHandle_t _lock{ nullptr }; /* the playlist lock */
+    uint32_t _fileSize{ 0 };
+    uint32_t _compactedSize{ 0 };
+    uint32_t _items{ 0 }; /* items the journal knows of - the playlist can be ahead while a change is on its way */
+    int32_t _current{ PLAYLIST_STOPPED };
+    uint32_t _offset{ 0 };
+    uint32_t _lastPositionWrite{ 0 };
+    int32_t _resumeItem{ PLAYLIST_STOPPED };
+    uint32_t _resumeOffset{ 0 };
+    uint32_t _records{ 0 };
+    uint32_t _compactions{ 0 };
+    bool _damaged{ false }; /* a write failed - the tail of the file can be a partial record */
+};
+
+#endif
@@ -0,0 +1,143 @@
+#include "playlistParser.h"
+#include <memory>
+#include "copyText.h"
+
+bool playlistParser::isPlaylist(const char* url) {
+    const size_t length = strcspn(url, "?#");
+    const char* extension = nullptr;
+    for (size_t i = 0; i < length; i++)
+        if (url[i] == '.') extension = url + i;
+    if (!extension) return false;
+    if (url + length - extension != 4) return false;
+    return !strncasecmp(extension, ".m3u", 4) || !strncasecmp(extension, ".pls", 4);
+}
+
+bool playlistParser::fetch(const char* url, const char* user, const char* password, entryHandler onEntry) {
+    HTTPClient http;
+    http.setTimeout(TIMEOUT_MS);
+    http.setConnectTimeout(TIMEOUT_MS);
+    http.setFollowRedirects(HTTPC_STRICT_FOLLOW_REDIRECTS);
+    if (!http.begin(url)) {
+        log_e("Could not fetch '%s'", url);
+        return false;
+    }
+    if (strlen(user) || strlen(password))
+        http.setAuthorization(user, password);
+    const int code = http.GET();
+    if (code != HTTP_CODE_OK) {
+        log_w("'%s' returned %i", url, code);
+        http.end();
+        return false;
+    }
+    /* about 1kB - not on the stack of the calling task */
+    std::unique_ptr<playlistParser> parser(new playlistParser(url, onEntry));
+    http.writeToStream(parser.get()); /* fails when the parser stopped - that is not an error */
+    parser->finish();
+    http.end();
+    log_i("'%s' read %u entries%s", url, parser->entries(), parser->stopped() ? " and stopped" : "");
+    return true;
+}
+
+playlistParser::playlistParser(const char* url, entryHandler onEntry)
+  : _onEntry(onEntry) {
+    copyText(_base, sizeof(_base), url);
+    const char* scheme = strstr(_base, "://");
+    const char* host = scheme ? scheme + 3 : _base;
+    _originLength = (host - _base) + strcspn(host, "/?#");
+    const size_t pathLength = _originLength + strcspn(_base + _originLength, "?#");
+    for (size_t i = _originLength; i < pathLength; i++)
+        if (_base[i] == '/') _folderLength = i + 1;
+}
+
+void playlistParser::feed(const uint8_t* data, const size_t length) {
+    _lines.feed(data, length, [this](char* text) {
+        line(text);
+    });
+}
+
+void playlistParser::finish() {
+    _lines.finish([this](char* text) {
+        line(text);
+    });
+    emit();
+}
+
+void playlistParser::line(char* line) {
+    if (_stopped) return;
+    size_t length = strlen(line);
+    while (length && isspace((uint8_t)line[length - 1])) line[--length] = 0;
+    if (_format == UNKNOWN && !strncmp(line, "\xEF\xBB\xBF", 3)) line += 3; /* utf8 byte order mark */
+    while (isspace((uint8_t)*line)) line++;
+    if (!*line) return;
+
+    if (_format == UNKNOWN) {
+        _format = strcasecmp(line, "[playlist]") ? M3U : PLS;
+        if (_format == PLS) return;
+    }
+    if (_format == M3U)
+        m3uLine(line);
+    else
+        plsLine(line);
+}
+
+/* #EXTINF:<seconds>,<title> names the next entry - other comments are skipped */
+void playlistParser::m3uLine(const char* line) {
+    if (!strncasecmp(line, "#EXTINF:", 8)) {
+        const char* title = strchr(line, ',');
+        copyText(_title, sizeof(_title), title ? title + 1 : "");
+        return;
+    }
+    if (line[0] == '#') return;
+    pending(line);
+    emit();
+}
+
+/* FileN=<url> and TitleN=<title> - both may come first, an entry is complete when another number shows up */
+void playlistParser::plsLine(const char* line) {
+    const bool isFile = !strncasecmp(line, "File", 4) && isdigit((uint8_t)line[4]);
+    const bool isTitle = !strncasecmp(line, "Title", 5) && isdigit((uint8_t)line[5]);
+    const char* value = strchr(line, '=');
+    if (!(isFile || isTitle) || !value) return;
+    const int32_t number = atoi(line + (isFile ? 4 : 5));
+    if (_url[0] && number != _urlNumber) emit();
+    if (isFile) {
+        if (_titleNumber != number) _title[0] = 0;
+        pending(value + 1);
+        _urlNumber = number;
+    } else {
+        copyText(_title, sizeof(_title), value + 1);
+        _titleNumber = number;
+    }
+}
+
+void playlistParser::pending(const char* url) {
+    _url[0] = 0;
+    if (isalpha((uint8_t)url[0]) && url[1] == ':') return; /* a windows drive letter */
+    int length;
+    if (strstr(url, "://"))
+        length = snprintf(_url, sizeof(_url), "%s", url);
+    else if (url[0] == '/')
+        length = snprintf(_url, sizeof(_url), "%.*s%s", (int)_originLength, _base, url);
+    else if (_folderLength)
+        length = snprintf(_url, sizeof(_url), "%.*s%s", (int)_folderLength, _base, url);
+    else
+        length = snprintf(_url, sizeof(_url), "%.*s/%s", (int)_originLength, _base, url);
+    if (length < 0 || (size_t)length >= sizeof(_url)) {
+        log_w("Playlist entry '%s' is too long", url);
+        _url[0] = 0;
+        return;
+    }
+    if (!strstr(url, "://"))
+        for (char* c = _url + length - strlen(url); *c; c++)
+            if (*c == '\\') *c = '/';
+}
+
+void playlistParser::emit() {
+    if (_url[0]) {
+        _entries++;
+        if (!_onEntry(_url, _title)) _stopped = true;
+    }
+    _url[0] = 0;
+    _title[0] = 0;
+    _urlNumber = _titleNumber = -1;
+}
@@ -0,0 +1,89 @@
+#ifndef __PLAYLISTPARSER_H
+#define __PLAYLISTPARSER_H
+
+#include <Arduino.h>
+#include <HTTPClient.h>
+#include <functional>
+#include "lineParser.h"
+#include "playList.h"
+
+/* Reads an M3U, extended M3U or PLS playlist as it arrives and hands every entry to a callback.
+
+   The playlist is never kept - memory use is one line, one pending url and one title.
+   HTTPClient::writeToStream() writes the body to the parser, so chunked transfer encoding is taken care of.
+   The format is found on the first line: '[playlist]' is PLS, anything else is M3U.
+   A relative entry is resolved against the url of the playlist, backslashes in a relative path become '/'.
+   An entry that does not fit in PLAYLIST_MAX_URL_LENGTH is dropped.
+   The callback returns false to stop reading - the rest of the playlist is not downloaded. */
+
+class playlistParser : public Stream {
+
+  public:
+    typedef std::function<bool(const char* url, const char* title)> entryHandler;
+
+    /* a .m3u or .pls url - .m3u8 is HLS and not a list of streams */
+    static bool isPlaylist(const char* url);
+
+    /* fetch 'url' and parse it while it arrives - false when it could not be fetched */
+    static bool fetch(const char* url, const char* user, const char* password, entryHandler onEntry);
+
+    playlistParser(const char* url, entryHandler onEntry);
+
+    void feed(const uint8_t* data, const size_t length);
+    void finish();
+
+    uint32_t entries() const {
+        return _entries;
+    }
+    bool stopped() const {
+        return _stopped;
+    }
+
+    size_t write(uint8_t c) override {
+        return write(&c, 1);
+    }
+    size_t write(const uint8_t* data, size_t size) override {
+        if (_stopped) return 0;
+        feed(data, size);
+        return size;
+    }
+    int available() override {
+        return 0;
+    }
+    int read() override {
+        return -1;
+    }
+    int peek() override {
+        return -1;
+    }
+    void flush() override {}
+
+  private:
+    static constexpr const uint16_t TIMEOUT_MS = 5000;
+    static constexpr const size_t MAX_TITLE = 128;
+
+    enum playlistFormat : uint8_t { UNKNOWN,
+                                    M3U,
+                                    PLS };
+
+    void line(char* line);
+    void m3uLine(const char* line);
+    void plsLine(const char* line);
+    void pending(const char* url);
+    void emit();
+
+    lineParser<PLAYLIST_MAX_URL_LENGTH + 16> _lines; /* room for 'File12345=' */
+    entryHandler _onEntry;
+    char _base[PLAYLIST_MAX_URL_LENGTH];
+    size_t _originLength{ 0 }; /* scheme and host */
+    size_t _folderLength{ 0 }; /* up to and including the last '/' */
+    char _url[PLAYLIST_MAX_URL_LENGTH]{};
+    char _title[MAX_TITLE]{};
+    int32_t _urlNumber{ -1 };   /* PLS entry number of the pending url */
+    int32_t _titleNumber{ -1 }; /* PLS entry number of the title */
+    playlistFormat _format{ UNKNOWN };
+    uint32_t _entries{ 0 };
+    bool _stopped{ false };
+};
+
+#endif
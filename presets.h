@@ -1,9 +1,30 @@
+/* a string literal and its length - nothing is copied to the heap */
+class presetString {
+
+  public:
+    template<size_t N>
+    constexpr presetString(const char (&str)[N])
+      : _str(str), _length(N - 1) {}
+
+    constexpr const char* c_str() const {
+        return _str;
+    }
+    constexpr size_t length() const {
+        return _length;
+    }
+
+  private:
+    const char* const _str;
+    const size_t _length;
+};
+
 struct source {
-    const String name;
-    const String url;
+    const presetString name;
+    const presetString url;
 };
 
-const source preset[]{
+/* the names should be unique and the urls shorter than PLAYLIST_MAX_URL_LENGTH - the build fails otherwise */
+constexpr source preset[]{
     { "NPO Radio1", "http://icecast.omroep.nl/radio1-bb-aac" },
     { "NPO Radio2", "http://icecast.omroep.nl/radio2-bb-aac" },
     { "NPO Soul&Jazz", "http://icecast.omroep.nl/radio6-bb-aac" },
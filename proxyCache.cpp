@@ -0,0 +1,325 @@
+#include "proxyCache.h"
+
+/* HTTPClient::writeToStream() takes care of chunked transfer encoding - this is the stream it writes to */
+class bodyCollector : public Stream {
+
+  public:
+    explicit bodyCollector(const size_t maxSize)
+      : _maxSize(maxSize) {}
+    ~bodyCollector() {
+        free(_data);
+    }
+
+    size_t write(uint8_t c) override {
+        return write(&c, 1);
+    }
+    size_t write(const uint8_t* data, size_t size) override {
+        if (_length + size > _maxSize) {
+            _overflow = true;
+            return 0;
+        }
+        if (_length + size > _capacity && !grow(_length + size)) return 0;
+        memcpy(_data + _length, data, size);
+        _length += size;
+        return size;
+    }
+    int available() override {
+        return 0;
+    }
+    int read() override {
+        return -1;
+    }
+    int peek() override {
+        return -1;
+    }
+    void flush() override {}
+
+    bool overflow() const {
+        return _overflow;
+    }
+    size_t length() const {
+        return _length;
+    }
+    /* hand the buffer over - it has to be freed with free() */
+    uint8_t* release() {
+        uint8_t* const data = _data;
+        _data = nullptr;
+        _length = _capacity = 0;
+        return data;
+    }
+
+  private:
+    bool grow(const size_t needed) {
+        size_t capacity = _capacity ? _capacity : 2048;
+        while (capacity < needed) capacity *= 2;
+        capacity = min(capacity, _maxSize);
+        void* const data = psramFound() ? heap_caps_realloc(_data, capacity, MALLOC_CAP_SPIRAM) : realloc(_data, capacity);
+        if (!data) {
+            _overflow = true;
+            return false;
+        }
+        _data = static_cast<uint8_t*>(data);
+        _capacity = capacity;
+        return true;
+    }
+
+    const size_t _maxSize;
+    uint8_t* _data{ nullptr };
+    size_t _length{ 0 };
+    size_t _capacity{ 0 };
+    bool _overflow{ false };
+};
+
+static uint32_t fnv1a(const uint8_t* data, const size_t length) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < length; i++) {
+        hash ^= data[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+bool proxyCache::begin(const size_t budget, const size_t maxBodySize, const char* userAgent) {
+    _userAgent = userAgent;
+    _budget = budget;
+    _maxBodySize = maxBodySize;
+    _mutex = xSemaphoreCreateMutex();
+    if (!_mutex) return false;
+    const BaseType_t result = xTaskCreatePinnedToCore(
+        workerTask,   /* Function to implement the task */
+        "proxyCache", /* Name of the task */
+        8192,         /* Stack size in BYTES! - https needs the room */
+        this,         /* Task input parameter */
+        1,            /* Priority of the task */
+        &_worker,     /* Task handle. */
+        0             /* Core where the task should run */
+    );
+    return result == pdPASS;
+}
+
+std::shared_ptr<proxyEntry> proxyCache::fresh(const String& key, const uint32_t ttl) {
+    std::shared_ptr<proxyEntry> entry = find(key);
+    if (!entry || millis() - entry->fetched > ttl) return nullptr;
+    _hits++;
+    return entry;
+}
+
+std::shared_ptr<proxyFetch> proxyCache::fetch(const String& key, const String& url, const proxyFilter filter, const char* user, const char* password) {
+    xSemaphoreTake(_mutex, portMAX_DELAY);
+    std::shared_ptr<proxyFetch> job;
+    if (_running && _running->state == proxyFetch::PENDING && _running->key.equals(key))
+        job = _running;
+    for (const auto& queued : _jobs)
+        if (!job && queued->key.equals(key)) job = queued;
+    if (!job) {
+        job = std::make_shared<proxyFetch>();
+        job->key = key;
+        job->url = url;
+        job->filter = filter;
+        job->user = user;
+        job->password = password;
+        _jobs.push_back(job);
+        _misses++;
+    }
+    xSemaphoreGive(_mutex);
+    xTaskNotifyGive(_worker);
+    return job;
+}
+
+size_t proxyCache::entries() {
+    xSemaphoreTake(_mutex, portMAX_DELAY);
+    const size_t count = _lru.size();
+    xSemaphoreGive(_mutex);
+    return count;
+}
+
+void proxyCache::appendEncoded(String& url, const char* value) {
+    static const char* HEX_DIGITS = "0123456789ABCDEF";
+    for (const char* c = value; *c; c++) {
+        if (isalnum(*c) || strchr("-_.~/", *c))
+            url.concat(*c);
+        else {
+            url.concat('%');
+            url.concat(HEX_DIGITS[(uint8_t)*c >> 4]);
+            url.concat(HEX_DIGITS[(uint8_t)*c & 0xF]);
+        }
+    }
+}
+
+void proxyCache::workerTask(void* cache) {
+    static_cast<proxyCache*>(cache)->work();
+}
+
+void proxyCache::work() {
+    while (true) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        while (true) {
+            xSemaphoreTake(_mutex, portMAX_DELAY);
+            _running.reset();
+            if (!_jobs.empty()) {
+                _running = _jobs.front();
+                _jobs.pop_front();
+            }
+            std::shared_ptr<proxyFetch> job = _running;
+            xSemaphoreGive(_mutex);
+            if (!job) break;
+            download(*job);
+            if (job->state != proxyFetch::DONE) _failures++;
+        }
+    }
+}
+
+void proxyCache::download(proxyFetch& job) {
+    std::shared_ptr<proxyEntry> stale = find(job.key);
+
+    pooledConnection* const connection = connectionFor(job.url);
+    HTTPClient ownClient; /* https - a new connection every fetch */
+    HTTPClient& http = connection ? connection->http : ownClient;
+    const bool reused = connection && connection->client.connected();
+
+    job.httpCode = get(http, connection, job, stale);
+    if (reused && job.httpCode < 0) {
+        /* the server closed the idle connection - the retry opens a new one */
+        _staleConnections++;
+        _newConnections++;
+        job.httpCode = get(http, connection, job, stale);
+    }
+
+    if (!job.httpCode) {
+        log_e("Could not fetch '%s'", job.url.c_str());
+        job.state = proxyFetch::FAILED;
+        return;
+    }
+
+    if (job.httpCode == HTTP_CODE_NOT_MODIFIED && stale) {
+        stale->fetched = millis();
+        _revalidated++;
+        job.entry = stale;
+        job.state = proxyFetch::DONE;
+        finish(http, connection, true);
+        return;
+    }
+
+    if (job.httpCode != HTTP_CODE_OK) {
+        log_w("'%s' returned %i", job.url.c_str(), job.httpCode);
+        job.state = proxyFetch::FAILED;
+        finish(http, connection, false);
+        return;
+    }
+
+    bodyCollector body(_maxBodySize);
+    const int written = http.writeToStream(&body);
+    if (body.overflow()) {
+        log_w("'%s' is larger than %u bytes or out of memory", job.url.c_str(), _maxBodySize);
+        job.state = proxyFetch::FAILED;
+        finish(http, connection, false);
+        return;
+    }
+
+    std::shared_ptr<proxyEntry> entry = std::make_shared<proxyEntry>();
+    entry->key = job.key;
+    entry->upstreamEtag = http.header("ETag");
+    entry->length = body.length();
+    entry->body = body.release();
+    if (job.filter)
+        entry->length = job.filter(entry->body, entry->length);
+    snprintf(entry->etag, sizeof(entry->etag), "\"%08x\"", fnv1a(entry->body, entry->length));
+    entry->fetched = millis();
+    finish(http, connection, written >= 0);
+
+    insert(entry);
+    job.entry = entry;
+    job.state = proxyFetch::DONE;
+}
+
+/* the pool slot for the host of 'url' - nullptr for https */
+proxyCache::pooledConnection* proxyCache::connectionFor(const String& url) {
+    static const char* HTTP = "http://";
+    if (!url.startsWith(HTTP)) return nullptr;
+    const int path = url.indexOf('/', strlen(HTTP));
+    const String host = url.substring(strlen(HTTP), path == -1 ? url.length() : path);
+
+    pooledConnection* slot = nullptr;
+    for (auto& connection : _pool) {
+        if (connection.client.connected() && millis() - connection.idleSince > IDLE_TIMEOUT_MS)
+            connection.client.stop();
+        if (connection.host.equals(host)) slot = &connection;
+    }
+    if (slot && slot->client.connected()) {
+        _reusedConnections++;
+        return slot;
+    }
+    if (!slot) {
+        /* a free slot - or the one that is idle the longest */
+        for (auto& connection : _pool)
+            if (!slot || (slot->client.connected() && (!connection.client.connected() || connection.idleSince < slot->idleSince)))
+                slot = &connection;
+        slot->client.stop();
+        slot->host = host;
+    }
+    _newConnections++;
+    return slot;
+}
+
+/* 0 when the url could not be used */
+int proxyCache::get(HTTPClient& http, pooledConnection* connection, const proxyFetch& job, const std::shared_ptr<proxyEntry>& stale) {
+    const char* headerKeys[]{ "ETag" };
+    http.collectHeaders(headerKeys, 1);
+    http.setTimeout(TIMEOUT_MS);
+    http.setConnectTimeout(TIMEOUT_MS);
+    http.setReuse(connection != nullptr);
+    if (!(connection ? http.begin(connection->client, job.url) : http.begin(job.url)))
+        return 0;
+    if (_userAgent)
+        http.setUserAgent(_userAgent);
+    if (strlen(job.user) || strlen(job.password))
+        http.setAuthorization(job.user, job.password);
+    else
+        http.setAuthorization(""); /* a pooled client still has the previous one */
+    if (stale && stale->upstreamEtag.length())
+        http.addHeader("If-None-Match", stale->upstreamEtag);
+    return http.GET();
+}
+
+/* a connection goes back to the pool when the server keeps it open and the response was read to the end */
+void proxyCache::finish(HTTPClient& http, pooledConnection* connection, const bool drained) {
+    http.end();
+    if (!connection) return;
+    if (drained && connection->client.connected())
+        connection->idleSince = millis();
+    else
+        connection->client.stop();
+}
+
+std::shared_ptr<proxyEntry> proxyCache::find(const String& key) {
+    std::shared_ptr<proxyEntry> entry;
+    xSemaphoreTake(_mutex, portMAX_DELAY);
+    for (auto it = _lru.begin(); it != _lru.end(); ++it) {
+        if ((*it)->key.equals(key)) {
+            entry = *it;
+            _lru.splice(_lru.begin(), _lru, it);
+            break;
+        }
+    }
+    xSemaphoreGive(_mutex);
+    return entry;
+}
+
+/* a response that is still sending an evicted entry keeps it alive through its shared_ptr */
+void proxyCache::insert(std::shared_ptr<proxyEntry> entry) {
+    xSemaphoreTake(_mutex, portMAX_DELAY);
+    for (auto it = _lru.begin(); it != _lru.end(); ++it) {
+        if ((*it)->key.equals(entry->key)) {
+            _bytes -= (*it)->length;
+            _lru.erase(it);
+            break;
+        }
+    }
+    _lru.push_front(entry);
+    _bytes += entry->length;
+    while (_bytes > _budget && _lru.size() > 1) {
+        _bytes -= _lru.back()->length;
+        _lru.pop_back();
+    }
+    xSemaphoreGive(_mutex);
+}
@@ -0,0 +1,143 @@
+#ifndef __PROXYCACHE_H
+#define __PROXYCACHE_H
+
+#include <Arduino.h>
+#include <HTTPClient.h>
+#include <atomic>
+#include <deque>
+#include <list>
+#include <memory>
+
+/* Fetches documents from other http servers for the web interface and keeps the recent ones.
+
+   The web server runs on the async_tcp task and can not wait for an upstream server.
+   fetch() queues the url for a worker task and returns at once, a response polls the returned job until it is done.
+   Jobs for a key that is already queued or being fetched share the same job.
+
+   Bodies are stored in PSRAM when the board has it.
+   The least recently used entry is evicted when the cache is over budget.
+   An entry older than its ttl is revalidated with If-None-Match when the upstream server sent an ETag.
+   A 304 makes the entry fresh again without a transfer.
+
+   Entries are stored under a key, so the same document fetched from another mirror is the same entry.
+   A filter can rewrite a body before it is stored - in place, it may only shrink it.
+
+   The worker keeps the connection to a plain http host open after a fetch - one per host for POOL_SIZE hosts.
+   The next fetch from that host skips the tcp handshake. A connection that is idle longer than IDLE_TIMEOUT_MS
+   is closed, one that the server closed in the meantime is retried once on a new connection.
+   Only the fetches of this cache use the pool - library listings and station searches.
+   Tracks and seeks are not pooled: ESP32_VS1053_Stream makes a connection of its own for every connect
+   and has no way to take one from here. */
+
+typedef size_t (*proxyFilter)(uint8_t* body, const size_t length);
+
+struct proxyEntry {
+    ~proxyEntry() {
+        free(body);
+    }
+    String key;
+    String upstreamEtag;
+    char etag[11]{}; /* quoted FNV-1a of the body */
+    uint8_t* body{ nullptr };
+    size_t length{ 0 };
+    std::atomic<uint32_t> fetched{ 0 }; /* millis */
+};
+
+struct proxyFetch {
+    enum fetchState : uint8_t { PENDING,
+                                DONE,
+                                FAILED };
+    String key;
+    String url;
+    const char* user;
+    const char* password;
+    proxyFilter filter;
+    std::atomic<fetchState> state{ PENDING };
+    int httpCode{ 0 };
+    std::shared_ptr<proxyEntry> entry;
+};
+
+class proxyCache {
+
+  public:
+    proxyCache(){};
+
+    bool begin(const size_t budget, const size_t maxBodySize, const char* userAgent);
+
+    /* the entry for 'key' when it is younger than 'ttl' ms - or nullptr */
+    std::shared_ptr<proxyEntry> fresh(const String& key, const uint32_t ttl);
+
+    /* 'user' and 'password' are not copied and should be static */
+    std::shared_ptr<proxyFetch> fetch(const String& key, const String& url, const proxyFilter filter = nullptr, const char* user = "", const char* password = "");
+
+    /* percent-encode 'value' - '/' is kept */
+    static void appendEncoded(String& url, const char* value);
+
+    uint32_t hits() const {
+        return _hits;
+    }
+    uint32_t misses() const {
+        return _misses;
+    }
+    uint32_t revalidated() const {
+        return _revalidated;
+    }
+    uint32_t failures() const {
+        return _failures;
+    }
+    uint32_t reusedConnections() const {
+        return _reusedConnections;
+    }
+    uint32_t newConnections() const {
+        return _newConnections;
+    }
+    uint32_t staleConnections() const {
+        return _staleConnections;
+    }
+    size_t entries();
+    size_t bytes() const {
+        return _bytes;
+    }
+
+  private:
+    static constexpr const uint16_t TIMEOUT_MS = 5000;
+    static constexpr const size_t POOL_SIZE = 4;
+    static constexpr const uint32_t IDLE_TIMEOUT_MS = 4000; /* below the 5 s keep-alive timeout of apache */
+
+    /* only the worker task uses the pool */
+    struct pooledConnection {
+        String host; /* host:port */
+        WiFiClient client;
+        HTTPClient http; /* stops its client when it is destroyed - so it lives as long as the connection */
+        uint32_t idleSince{ 0 };
+    };
+
+    static void workerTask(void* cache);
+    void work();
+    void download(proxyFetch& job);
+    pooledConnection* connectionFor(const String& url);
+    int get(HTTPClient& http, pooledConnection* connection, const proxyFetch& job, const std::shared_ptr<proxyEntry>& stale);
+    void finish(HTTPClient& http, pooledConnection* connection, const bool drained);
+    std::shared_ptr<proxyEntry> find(const String& key);
+    void insert(std::shared_ptr<proxyEntry> entry);
+
+    SemaphoreHandle_t _mutex{ nullptr };
+    TaskHandle_t _worker{ nullptr };
+    std::list<std::shared_ptr<proxyEntry>> _lru; /* most recently used first */
+    std::deque<std::shared_ptr<proxyFetch>> _jobs;
+    std::shared_ptr<proxyFetch> _running;
+    pooledConnection _pool[POOL_SIZE];
+    const char* _userAgent{ nullptr };
+    size_t _budget{ 0 };
+    size_t _maxBodySize{ 0 };
+    std::atomic<size_t> _bytes{ 0 };
+    std::atomic<uint32_t> _hits{ 0 };
+    std::atomic<uint32_t> _misses{ 0 };
+    std::atomic<uint32_t> _revalidated{ 0 };
+    std::atomic<uint32_t> _failures{ 0 };
+    std::atomic<uint32_t> _reusedConnections{ 0 };
+    std::atomic<uint32_t> _newConnections{ 0 };
+    std::atomic<uint32_t> _staleConnections{ 0 };
+};
+
+#endif
@@ -0,0 +1,349 @@
+#include "radioBrowser.h"
+
+/* just enough json to read an array of flat objects */
+class jsonReader {
+
+  public:
+    jsonReader(const uint8_t* data, const size_t length)
+      : _pos(data), _end(data + length) {}
+
+    const uint8_t* position() const {
+        return _pos;
+    }
+
+    bool take(const char c) {
+        while (_pos < _end && isspace(*_pos)) _pos++;
+        if (_pos == _end || *_pos != c) return false;
+        _pos++;
+        return true;
+    }
+
+    bool peek(const char c) {
+        while (_pos < _end && isspace(*_pos)) _pos++;
+        return _pos < _end && *_pos == c;
+    }
+
+    /* decode a string into 'out' - a value that does not fit is cut at a character boundary */
+    bool string(char* out, const size_t size) {
+        if (!take('"')) return false;
+        size_t length = 0;
+        bool full = false;
+        while (_pos < _end && *_pos != '"') {
+            char utf8[4];
+            size_t n = 1;
+            if (*_pos != '\\') {
+                utf8[0] = *_pos++;
+            } else {
+                if (++_pos == _end) return false;
+                const char escaped = *_pos++;
+                if (escaped == 'u') {
+                    uint32_t code = hex4();
+                    if (code >= 0xD800 && code < 0xDC00 && _end - _pos >= 6 && _pos[0] == '\\' && _pos[1] == 'u') {
+                        _pos += 2;
+                        code = 0x10000 + ((code - 0xD800) << 10) + (hex4() - 0xDC00);
+                    }
+                    n = encode(code, utf8);
+                } else
+                    utf8[0] = strchr("\"\\/", escaped) ? escaped : ' ';
+            }
+            if ((uint8_t)utf8[0] < ' ') utf8[0] = ' ';
+            /* a raw multibyte character is copied byte by byte - do not start one that will not fit */
+            if (n == 1 && ((uint8_t)utf8[0] & 0xC0) == 0xC0) {
+                const uint8_t lead = utf8[0];
+                const size_t sequence = lead >= 0xF0 ? 4 : lead >= 0xE0 ? 3 : 2;
+                if (length + sequence >= size) full = true;
+            }
+            if (full || length + n >= size)
+                full = true;
+            else {
+                memcpy(out + length, utf8, n);
+                length += n;
+            }
+        }
+        if (_pos == _end) return false;
+        _pos++;
+        out[length] = 0;
+        return true;
+    }
+
+    /* copy a number or literal as text */
+    bool scalar(char* out, const size_t size) {
+        while (_pos < _end && isspace(*_pos)) _pos++;
+        const uint8_t* const start = _pos;
+        size_t length = 0;
+        while (_pos < _end && !strchr(",}] \t\r\n", *_pos)) {
+            if (length + 1 < size) out[length++] = *_pos;
+            _pos++;
+        }
+        out[length] = 0;
+        return _pos != start;
+    }
+
+    bool skipValue() {
+        if (peek('"')) {
+            char ignored[1];
+            return string(ignored, sizeof(ignored));
+        }
+        if (peek('{') || peek('[')) {
+            size_t depth = 0;
+            bool quoted = false;
+            while (_pos < _end) {
+                const uint8_t c = *_pos++;
+                if (quoted) {
+                    if (c == '\\' && _pos < _end)
+                        _pos++;
+                    else if (c == '"')
+                        quoted = false;
+                } else if (c == '"')
+                    quoted = true;
+                else if (c == '{' || c == '[')
+                    depth++;
+                else if ((c == '}' || c == ']') && !--depth)
+                    return true;
+            }
+            return false;
+        }
+        char ignored[1];
+        return scalar(ignored, sizeof(ignored));
+    }
+
+  private:
+    uint32_t hex4() {
+        uint32_t value = 0;
+        for (int i = 0; i < 4 && _pos < _end; i++, _pos++)
+            value = (value << 4) | (isdigit(*_pos) ? *_pos - '0' : (tolower(*_pos) - 'a' + 10) & 0xF);
+        return value;
+    }
+
+    static size_t encode(const uint32_t code, char* utf8) {
+        if (code < 0x80) {
+            utf8[0] = code;
+            return 1;
+        }
+        if (code < 0x800) {
+            utf8[0] = 0xC0 | code >> 6;
+            utf8[1] = 0x80 | (code & 0x3F);
+            return 2;
+        }
+        if (code < 0x10000) {
+            utf8[0] = 0xE0 | code >> 12;
+            utf8[1] = 0x80 | (code >> 6 & 0x3F);
+            utf8[2] = 0x80 | (code & 0x3F);
+            return 3;
+        }
+        utf8[0] = 0xF0 | code >> 18;
+        utf8[1] = 0x80 | (code >> 12 & 0x3F);
+        utf8[2] = 0x80 | (code >> 6 & 0x3F);
+        utf8[3] = 0x80 | (code & 0x3F);
+        return 4;
+    }
+
+    const uint8_t* _pos;
+    const uint8_t* const _end;
+};
+
+static uint32_t fnv1a(const char* str) {
+    uint32_t hash = 2166136261u;
+    while (*str) {
+        hash ^= (uint8_t)*str++;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+bool radioBrowser::begin(const char* serversUrl, const char* fallback, const char* userAgent) {
+    _serversUrl = serversUrl;
+    _userAgent = userAgent;
+    _mirror = fallback;
+    _mutex = xSemaphoreCreateMutex();
+    if (!_mutex) return false;
+    const BaseType_t result = xTaskCreatePinnedToCore(
+        probeTask,      /* Function to implement the task */
+        "radioBrowser", /* Name of the task */
+        6144,           /* Stack size in BYTES! */
+        this,           /* Task input parameter */
+        0,              /* Priority of the task */
+        NULL,           /* Task handle. */
+        0               /* Core where the task should run */
+    );
+    return result == pdPASS;
+}
+
+String radioBrowser::mirror() {
+    xSemaphoreTake(_mutex, portMAX_DELAY);
+    const String mirror = _mirror;
+    xSemaphoreGive(_mutex);
+    return mirror;
+}
+
+String radioBrowser::normalize(const String& name) {
+    String normalized;
+    bool space = false;
+    for (const char* c = name.c_str(); *c; c++) {
+        if (isspace(*c)) {
+            space = normalized.length();
+            continue;
+        }
+        if (space) normalized.concat(' ');
+        space = false;
+        normalized.concat((char)tolower(*c));
+    }
+    return normalized;
+}
+
+String radioBrowser::searchKey(const String& normalizedName, const uint32_t page) {
+    String key("radio-browser\n");
+    key.concat(page);
+    key.concat('\n');
+    key.concat(normalizedName);
+    return key;
+}
+
+String radioBrowser::searchUrl(const String& normalizedName, const uint32_t page) {
+    String url = mirror();
+    url.concat("/json/stations/search?name=");
+    proxyCache::appendEncoded(url, normalizedName.c_str());
+    url.concat("&offset=");
+    url.concat(page * SEARCH_PAGE_SIZE);
+    url.concat("&limit=");
+    url.concat(SEARCH_PAGE_SIZE + 1);
+    url.concat("&hidebroken=true");
+    return url;
+}
+
+/* Every line is written over the json it was read from.
+   A line is always shorter than its station object - the keys and quotes alone are longer than the tabs. */
+size_t radioBrowser::compact(uint8_t* body, const size_t length) {
+    jsonReader json(body, length);
+    uint32_t seen[SEARCH_PAGE_SIZE];
+    size_t unique = 0;
+    size_t stations = 0;
+    size_t out = 0;
+
+    if (!json.take('[')) return 0;
+    while (!json.take(']')) {
+        struct {
+            char uuid[40];
+            char url[PLAYLIST_MAX_URL_LENGTH];
+            char name[128];
+            char codec[16];
+            char bitrate[8];
+            char language[64];
+        } station{};
+
+        if (!json.take('{')) return out;
+        while (!json.take('}')) {
+            char key[16];
+            if (!json.string(key, sizeof(key)) || !json.take(':')) return out;
+            bool ok;
+            if (!strcmp(key, "stationuuid"))
+                ok = json.string(station.uuid, sizeof(station.uuid));
+            else if (!strcmp(key, "url"))
+                ok = json.string(station.url, sizeof(station.url));
+            else if (!strcmp(key, "name"))
+                ok = json.string(station.name, sizeof(station.name));
+            else if (!strcmp(key, "codec"))
+                ok = json.string(station.codec, sizeof(station.codec));
+            else if (!strcmp(key, "language"))
+                ok = json.string(station.language, sizeof(station.language));
+            else if (!strcmp(key, "bitrate"))
+                ok = json.scalar(station.bitrate, sizeof(station.bitrate));
+            else
+                ok = json.skipValue();
+            if (!ok) return out;
+            json.take(',');
+        }
+        json.take(',');
+
+        if (++stations > SEARCH_PAGE_SIZE || !station.url[0]) continue;
+        if (!isdigit(station.bitrate[0]) || !strcmp(station.bitrate, "0")) station.bitrate[0] = 0;
+
+        station.url[strcspn(station.url, ";?")] = 0;
+        const uint32_t hash = fnv1a(station.url);
+        bool duplicate = false;
+        for (size_t i = 0; i < unique; i++) duplicate |= seen[i] == hash;
+        if (duplicate) continue;
+        seen[unique++] = hash;
+
+        const size_t room = json.position() - (body + out);
+        const int written = snprintf((char*)body + out, room, "%s\t%s\t%s\t%s\t%s\t%s\n",
+                                     station.uuid, station.url, station.name, station.codec, station.bitrate, station.language);
+        if (written > 0 && (size_t)written < room) out += written;
+    }
+    if (stations > SEARCH_PAGE_SIZE && json.position() - (body + out) > 5) {
+        memcpy(body + out, "more\n", 5);
+        out += 5;
+    }
+    return out;
+}
+
+void radioBrowser::probeTask(void* browser) {
+    radioBrowser* const self = static_cast<radioBrowser*>(browser);
+    while (true) {
+        self->probe();
+        vTaskDelay(pdMS_TO_TICKS(PROBE_INTERVAL_MS));
+    }
+}
+
+/* the server list has an entry per address - so most names are in there twice */
+void radioBrowser::probe() {
+    HTTPClient http;
+    http.setTimeout(PROBE_TIMEOUT_MS);
+    if (!http.begin(_serversUrl)) return;
+    if (_userAgent) http.setUserAgent(_userAgent);
+    const int code = http.GET();
+    if (code != HTTP_CODE_OK) {
+        log_w("Mirror list '%s' returned %i", _serversUrl, code);
+        http.end();
+        return;
+    }
+    const String list = http.getString();
+    http.end();
+
+    String names[MAX_MIRRORS];
+    size_t count = 0;
+    static const char* NAME_KEY = "\"name\"";
+    for (int found = list.indexOf(NAME_KEY); found != -1 && count < MAX_MIRRORS; found = list.indexOf(NAME_KEY, found + 1)) {
+        const int start = list.indexOf('"', list.indexOf(':', found) + 1) + 1;
+        const int end = list.indexOf('"', start);
+        if (start <= 0 || end == -1) break;
+        const String name = list.substring(start, end);
+        bool known = false;
+        for (size_t i = 0; i < count; i++) known |= names[i].equals(name);
+        if (!known) names[count++] = name;
+    }
+
+    String fastest;
+    int32_t best = INT32_MAX;
+    for (size_t i = 0; i < count; i++) {
+        const String base = "http://" + names[i];
+        const int32_t latency = timeRequest(base + "/json/stats");
+        log_d("Mirror %s: %i ms", base.c_str(), latency);
+        if (latency >= 0 && latency < best) {
+            best = latency;
+            fastest = base;
+        }
+    }
+    _mirrors = count;
+    _probes++;
+    if (!fastest.length()) return;
+
+    _latency = best;
+    xSemaphoreTake(_mutex, portMAX_DELAY);
+    _mirror = fastest;
+    xSemaphoreGive(_mutex);
+    log_i("Using radio-browser mirror %s - %i ms", fastest.c_str(), best);
+}
+
+int32_t radioBrowser::timeRequest(const String& url) {
+    HTTPClient http;
+    http.setTimeout(PROBE_TIMEOUT_MS);
+    http.setConnectTimeout(PROBE_TIMEOUT_MS);
+    if (!http.begin(url)) return -1;
+    if (_userAgent) http.setUserAgent(_userAgent);
+    const uint32_t start = millis();
+    const int code = http.GET();
+    const uint32_t elapsed = millis() - start;
+    http.end();
+    return code == HTTP_CODE_OK ? elapsed : -1;
+}
@@ -0,0 +1,69 @@
+#ifndef __RADIOBROWSER_H
+#define __RADIOBROWSER_H
+
+#include <Arduino.h>
+#include <HTTPClient.h>
+#include <atomic>
+#include "playList.h"
+#include "proxyCache.h"
+
+/* Station search on radio-browser.info for the web interface - see https://api.radio-browser.info/
+
+   A background task gets the mirror list from 'serversUrl' and times a small request to each mirror.
+   Searches go to the fastest one, the fallback is used until the first probe is done.
+   The list is probed again every PROBE_INTERVAL_MS.
+
+   compact() is a proxyCache filter that turns the json answer into one line per station:
+   uuid <tab> url <tab> name <tab> codec <tab> bitrate <tab> language
+   Urls are stripped of their query and duplicates are dropped.
+   When there are more than SEARCH_PAGE_SIZE results the last line is 'more'. */
+
+class radioBrowser {
+
+  public:
+    static constexpr const uint8_t SEARCH_PAGE_SIZE = 30;
+
+    radioBrowser(){};
+
+    /* the strings are not copied and should be static */
+    bool begin(const char* serversUrl, const char* fallback, const char* userAgent);
+
+    /* base url of the fastest mirror - 'http://de1.api.radio-browser.info' */
+    String mirror();
+
+    /* trimmed, lower case and single spaced - searches that only differ in these share a cache entry */
+    static String normalize(const String& name);
+    static String searchKey(const String& normalizedName, const uint32_t page);
+    String searchUrl(const String& normalizedName, const uint32_t page);
+
+    static size_t compact(uint8_t* body, const size_t length);
+
+    uint32_t latency() const {
+        return _latency;
+    }
+    uint32_t mirrors() const {
+        return _mirrors;
+    }
+    uint32_t probes() const {
+        return _probes;
+    }
+
+  private:
+    static constexpr const uint32_t PROBE_INTERVAL_MS = 30 * 60 * 1000;
+    static constexpr const uint16_t PROBE_TIMEOUT_MS = 2000;
+    static constexpr const uint8_t MAX_MIRRORS = 8;
+
+    static void probeTask(void* browser);
+    void probe();
+    int32_t timeRequest(const String& url);
+
+    SemaphoreHandle_t _mutex{ nullptr };
+    const char* _serversUrl{ nullptr };
+    const char* _userAgent{ nullptr };
+    String _mirror;
+    std::atomic<uint32_t> _latency{ 0 };
+    std::atomic<uint32_t> _mirrors{ 0 };
+    std::atomic<uint32_t> _probes{ 0 };
+};
+
+#endif
@@ -0,0 +1,33 @@
+#ifndef __SCOPEDTIMER_H
+#define __SCOPEDTIMER_H
+
+#include <Arduino.h>
+
+/* Logs the time spent in a scope at debug level.
+   Compiles to nothing unless 'Tools->Core Debug Level' is set to 'Debug' or higher. */
+
+#if CORE_DEBUG_LEVEL >= ARDUHAL_LOG_LEVEL_DEBUG
+
+class scopedTimer {
+  public:
+    scopedTimer(const char* label)
+      : _label(label), _start(micros()) {}
+    ~scopedTimer() {
+        log_d("%s took %lu us", _label, micros() - _start);
+    }
+
+  private:
+    const char* _label;
+    const unsigned long _start;
+};
+
+#else
+
+class scopedTimer {
+  public:
+    scopedTimer(const char*) {}
+};
+
+#endif
+
+#endif
@@ -0,0 +1,77 @@
+#include "streamMonitor.h"
+
+void streamMonitor::reset(const char* label) {
+    if (_bytesPerSecond)
+        log_i("'%s' averaged %i kbps with %i ms jitter and %i underruns", _label, bitrate() / 1000, _jitterMs, _underruns);
+    snprintf(_label, sizeof(_label), "%s", label);
+    _position = SIZE_MAX; /* the first update sets the starting position */
+    _lastArrival = _windowStart = millis();
+    _windowBytes = 0;
+    _bytesPerSecond = 0;
+    _meanGapMs = 0;
+    _jitterMs = 0;
+    _used = 0;
+    _lowWatermark = _highWatermark = 0;
+    _underruns = 0;
+    _filled = false;
+}
+
+uint32_t streamMonitor::update(const size_t position, const size_t used, const size_t capacity, const bool streaming) {
+    const unsigned long now = millis();
+
+    if (position < _position) {
+        /* a new stream - which can start at an offset */
+        _position = position;
+        _lastArrival = _windowStart = now;
+        _windowBytes = 0;
+    }
+
+    const size_t received = position > _position ? position - _position : 0;
+    _receivedBytes += received;
+
+    /* whatever arrived and is no longer in the buffer went to the decoder */
+    if (_used + received > used) _decodedBytes += _used + received - used;
+
+    if (received) {
+        /* running averages like the rtp interarrival jitter - see rfc3550 section 6.4.1 */
+        const uint32_t gap = now - _lastArrival;
+        const uint32_t deviation = gap > _meanGapMs ? gap - _meanGapMs : _meanGapMs - gap;
+        _meanGapMs += ((int32_t)gap - (int32_t)_meanGapMs) / 8;
+        _jitterMs += ((int32_t)deviation - (int32_t)_jitterMs) / 16;
+        _windowBytes += received;
+        _position = position;
+        _lastArrival = now;
+    }
+
+    if (now - _windowStart >= RATE_WINDOW_MS) {
+        const uint32_t rate = _windowBytes * 1000 / (now - _windowStart);
+        _bytesPerSecond = _bytesPerSecond ? _bytesPerSecond + ((int32_t)rate - (int32_t)_bytesPerSecond) / 4 : rate;
+        _windowBytes = 0;
+        _windowStart = now;
+        updateWatermarks();
+    }
+
+    if (capacity != _capacity) {
+        _capacity = capacity;
+        updateWatermarks();
+    }
+
+    if (!_capacity) return HIGH_WAIT_MS;
+
+    if (streaming && !used && _used && _filled) {
+        _underruns++;
+        log_w("Buffer underrun #%i - bitrate %i kbps jitter %i ms", _underruns, bitrate() / 1000, _jitterMs);
+    }
+    if (used >= _lowWatermark && _lowWatermark) _filled = true;
+    _used = used;
+
+    if (used < _lowWatermark) return LOW_WAIT_MS;
+    if (used < _highWatermark) return MID_WAIT_MS;
+    return HIGH_WAIT_MS;
+}
+
+void streamMonitor::updateWatermarks() {
+    const size_t margin = (size_t)_bytesPerSecond * (BASE_MARGIN_MS + JITTER_MULTIPLIER * _jitterMs) / 1000;
+    _lowWatermark = min(margin, _capacity / 2);
+    _highWatermark = min(2 * margin, _capacity * 3 / 4);
+}
@@ -0,0 +1,85 @@
+#ifndef __STREAMMONITOR_H
+#define __STREAMMONITOR_H
+
+#include <Arduino.h>
+
+/* Watches the stream buffer of ESP32_VS1053_Stream. That buffer lives in PSRAM when the board has PSRAM.
+   Estimates bitrate and arrival jitter from the stream position, and adapts the buffer watermarks to them.
+   playerTask uses the result to decide how often audio.loop() should run.
+
+   This is not a jitter buffer of its own. ESP32_VS1053_Stream reads the network and feeds the VS1053 inside
+   audio.loop(), so there is no place to put a ring buffer between the two without changing the library.
+   The size of the buffer stays what the library makes it - the watermarks only steer the pacing of playerTask. */
+
+class streamMonitor {
+
+  public:
+    streamMonitor(){};
+
+    void reset(const char* label);
+
+    /* call after every audio.loop() - returns the number of ms playerTask may wait for a message */
+    uint32_t update(const size_t position, const size_t used, const size_t capacity, const bool streaming);
+
+    const char* label() const {
+        return _label;
+    }
+    uint32_t bitrate() const {
+        return _bytesPerSecond * 8;
+    }
+    uint32_t jitterMs() const {
+        return _jitterMs;
+    }
+    size_t used() const {
+        return _used;
+    }
+    size_t capacity() const {
+        return _capacity;
+    }
+    size_t lowWatermark() const {
+        return _lowWatermark;
+    }
+    size_t highWatermark() const {
+        return _highWatermark;
+    }
+    uint32_t underruns() const {
+        return _underruns;
+    }
+    /* totals since boot */
+    uint64_t receivedBytes() const {
+        return _receivedBytes;
+    }
+    uint64_t decodedBytes() const {
+        return _decodedBytes;
+    }
+
+  private:
+    static constexpr const uint32_t BASE_MARGIN_MS = 500;
+    static constexpr const uint32_t JITTER_MULTIPLIER = 4;
+    static constexpr const uint32_t RATE_WINDOW_MS = 1000;
+
+    static constexpr const uint32_t LOW_WAIT_MS = 1;
+    static constexpr const uint32_t MID_WAIT_MS = 10;
+    static constexpr const uint32_t HIGH_WAIT_MS = 25;
+
+    void updateWatermarks();
+
+    size_t _position{ SIZE_MAX };
+    unsigned long _lastArrival{ 0 };
+    unsigned long _windowStart{ 0 };
+    size_t _windowBytes{ 0 };
+    uint32_t _bytesPerSecond{ 0 };
+    uint32_t _meanGapMs{ 0 };
+    uint32_t _jitterMs{ 0 };
+    size_t _used{ 0 };
+    size_t _capacity{ 0 };
+    size_t _lowWatermark{ 0 };
+    size_t _highWatermark{ 0 };
+    uint32_t _underruns{ 0 };
+    bool _filled{ false };
+    uint64_t _receivedBytes{ 0 };
+    uint64_t _decodedBytes{ 0 };
+    char _label[64]{};
+};
+
+#endif
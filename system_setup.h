@@ -23,6 +23,10 @@ const IPAddress SUBNET(255, 255, 255, 0);     /* Usually 255,255,255,0 check in
 const IPAddress PRIMARY_DNS(192, 168, 0, 10); /* Check in your router */
 const IPAddress SECONDARY_DNS(0, 0, 0, 0);    /* Check in your router */
 
-const char* NTP_POOL = "nl.pool.ntp.org";
+/* radio-browser.info search - the player picks the fastest mirror from this list */
+const char* RADIOBROWSER_SERVERS_URL = "http://all.api.radio-browser.info/json/servers";
+const char* RADIOBROWSER_FALLBACK = "http://de1.api.radio-browser.info"; /* used until the mirrors are probed */
+
+const char* NTP_POOL = "nl.pool.ntp.org"; /* set to "" to skip the time sync - playback does not wait for it */
 
 const char* TIMEZONE = "CET-1CEST,M3.5.0/2,M10.5.0/3"; /* Central European Time - see https://sites.google.com/a/usapiens.com/opnode/time-zones */
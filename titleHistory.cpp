@@ -0,0 +1,56 @@
+#include "titleHistory.h"
+#include "copyText.h"
+
+static uint32_t fnv1a(uint32_t hash, const char* str, const size_t length) {
+    for (size_t i = 0; i < length; i++) {
+        hash ^= (uint8_t)str[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+bool titleHistory::begin() {
+    _mutex = xSemaphoreCreateMutex();
+    return _mutex != nullptr;
+}
+
+/* a tab or newline would break the line of the history */
+void titleHistory::copy(char* to, const size_t size, const char* from, const size_t length) {
+    const size_t copied = copyText(to, size, from, length);
+    for (size_t i = 0; i < copied; i++)
+        if (to[i] == '\t' || to[i] == '\n') to[i] = ' ';
+}
+
+bool titleHistory::add(const streamType type, const char* station, const size_t stationLength, const char* title, const size_t titleLength) {
+    if (!_mutex || !titleLength) return false;
+    const uint32_t hash = fnv1a(fnv1a(2166136261u, station, stationLength), title, titleLength);
+    xSemaphoreTake(_mutex, portMAX_DELAY);
+    if (_count && _entries[_newest].hash == hash) {
+        xSemaphoreGive(_mutex);
+        _repeated++;
+        return false;
+    }
+    _newest = _count ? (_newest + 1) % SIZE : 0;
+    if (_count < SIZE) _count++;
+    entry& newest = _entries[_newest];
+    newest.hash = hash;
+    newest.time = millis();
+    newest.type = type;
+    copy(newest.station, sizeof(newest.station), station, stationLength);
+    copy(newest.title, sizeof(newest.title), title, titleLength);
+    xSemaphoreGive(_mutex);
+    _added++;
+    return true;
+}
+
+int titleHistory::line(const size_t index, char* line, const size_t size) {
+    if (!_mutex) return -1;
+    xSemaphoreTake(_mutex, portMAX_DELAY);
+    int length = -1;
+    if (index < _count) {
+        const entry& e = _entries[(_newest + SIZE - index) % SIZE];
+        length = snprintf(line, size, "%lu\t%s\t%s\t%s\n", (millis() - e.time) / 1000, typeStr[e.type], e.station, e.title);
+    }
+    xSemaphoreGive(_mutex);
+    return length;
+}
@@ -0,0 +1,59 @@
+#ifndef __TITLEHISTORY_H
+#define __TITLEHISTORY_H
+
+#include <Arduino.h>
+#include <atomic>
+#include "playList.h"
+
+/* The last SIZE titles that were played - stream titles of radio stations and the files from the library.
+
+   Entries live in a fixed ring, the oldest is overwritten. A title is compared by its FNV-1a hash
+   with the newest entry so a station that repeats its metadata does not fill the history.
+   Strings are cut at a utf8 character boundary, tabs and newlines are replaced by spaces. */
+
+class titleHistory {
+
+  public:
+    static constexpr const size_t SIZE = 16;
+
+    titleHistory(){};
+
+    bool begin();
+
+    /* false when the title and station are the same as the newest entry */
+    bool add(const streamType type, const char* station, const size_t stationLength, const char* title, const size_t titleLength);
+
+    /* line generator for lineStreamer - newest first
+       seconds ago <tab> type <tab> station <tab> title */
+    int line(const size_t index, char* line, const size_t size);
+
+    uint32_t added() const {
+        return _added;
+    }
+    uint32_t repeated() const {
+        return _repeated;
+    }
+
+  private:
+    static constexpr const size_t MAX_STATION = 64;
+    static constexpr const size_t MAX_TITLE = 128;
+
+    struct entry {
+        uint32_t hash;
+        uint32_t time;
+        streamType type;
+        char station[MAX_STATION];
+        char title[MAX_TITLE];
+    };
+
+    static void copy(char* to, const size_t size, const char* from, const size_t length);
+
+    SemaphoreHandle_t _mutex{ nullptr };
+    entry _entries[SIZE];
+    size_t _newest{ 0 };
+    size_t _count{ 0 };
+    std::atomic<uint32_t> _added{ 0 };
+    std::atomic<uint32_t> _repeated{ 0 };
+};
+
+#endif
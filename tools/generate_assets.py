@@ -0,0 +1,218 @@
+#!/usr/bin/env python3
+"""Generates webAssets.h - the compressed web interface that is compiled into the firmware.
+
+Run this from the sketch folder after every change to index.htm or icons.h:
+
+    python3 tools/generate_assets.py
+
+What it does:
+- minifies index.htm: drops comments, indentation and empty lines - newlines are kept so no javascript statement changes
+- inlines the icons from icons.h as data urls, so the first load needs one request instead of thirteen
+- adds the icons the library listing links to as separate immutable assets
+- compresses the result with the 'zopfli' module at ZOPFLI_ITERATIONS iterations
+- adds a Brotli variant made with the 'brotli' (or 'brotlicffi') module at BROTLI_QUALITY and BROTLI_WINDOW
+- writes the byte arrays, a content hash ETag per variant and the perfect hash seed for assetHandler
+
+Both compressors are required - install them with 'pip install zopfli brotli'. A missing one is an error,
+so the header never silently changes with what happens to be installed. The header names the versions it was made with.
+--gzip (gzip -9 instead of zopfli) and --no-brotli are explicit choices and are also written into the header.
+Browsers only ask for Brotli over https, so on a plain http connection the gzip variant is sent.
+"""
+
+import argparse
+import gzip
+import hashlib
+import io
+import re
+import sys
+from pathlib import Path
+
+SKETCH = Path(__file__).resolve().parent.parent
+
+# (path, source, mime type, immutable) - 'icons.h:<name>' is an icon from icons.h
+# the library listing of the php script still links these icons, so they keep their own url
+ASSETS = [
+    ("/", "index.htm", "text/html", False),
+    ("/addfoldericon.svg", "icons.h:addfoldericon", "image/svg+xml", True),
+    ("/emptyicon.svg", "icons.h:emptyicon", "image/svg+xml", True),
+    ("/starticon.svg", "icons.h:starticon", "image/svg+xml", True),
+]
+
+# icon urls that do not match their name in icons.h
+ICON_ALIASES = {"streamicon": "pasteicon"}
+
+SLOTS = 32
+SLOT_SHIFT = 27
+
+ZOPFLI_ITERATIONS = 50
+BROTLI_QUALITY = 11
+BROTLI_WINDOW = 22
+
+
+def read_icons(path):
+    icons = {}
+    for name, svg in re.findall(r'^constexpr const char (\w+)\[\] = R"====\((.*?)\)====";', path.read_text(), re.M | re.S):
+        icons[name] = svg
+    return icons
+
+
+def data_url(svg):
+    # escape everything that could end an html attribute or a javascript string
+    svg = re.sub(r"\s+", " ", svg.strip())
+    for char in '%#"\'<>\\':
+        svg = svg.replace(char, "%{:02X}".format(ord(char)))
+    return "data:image/svg+xml," + svg
+
+
+def inline_icons(html, icons):
+    def replace(match):
+        name = ICON_ALIASES.get(match.group(2), match.group(2))
+        if name not in icons:
+            sys.exit("error: {} is used in index.htm but not found in icons.h".format(match.group(0)))
+        return data_url(icons[name])
+
+    # also catches "' + http_host + '/starticon.svg" - a data url needs no host
+    return re.sub(r"(' \+ http_host \+ ')?/(\w+icon)\.svg", replace, html)
+
+
+def minify(html):
+    html = re.sub(r"<!--(?!\[if).*?-->", "", html, flags=re.S)
+    lines = []
+    in_script = False
+    for line in html.splitlines():
+        line = line.strip()
+        if re.search(r"<script\b", line):
+            in_script = True
+        if re.search(r"</script>", line):
+            in_script = False
+        if not line or (in_script and line.startswith("//")):
+            continue
+        lines.append(line)
+    return "\n".join(lines) + "\n"
+
+
+def gzip_compressor(use_gzip):
+    """returns (compress function, description) - exits when zopfli is missing and --gzip is not given"""
+    if use_gzip:
+        def compress(data):
+            out = io.BytesIO()
+            with gzip.GzipFile(filename="", mode="wb", compresslevel=9, fileobj=out, mtime=0) as f:
+                f.write(data)
+            return out.getvalue()
+        return compress, "gzip -9"
+    try:
+        import zopfli
+        import zopfli.gzip
+    except ImportError:
+        sys.exit("error: the 'zopfli' module is missing - run 'pip install zopfli' or pass --gzip to use gzip -9")
+    version = getattr(zopfli, "__version__", "unknown version")
+    return lambda data: zopfli.gzip.compress(data, numiterations=ZOPFLI_ITERATIONS), "zopfli {} --i{}".format(version, ZOPFLI_ITERATIONS)
+
+
+def brotli_compressor(no_brotli):
+    """returns (compress function, description) or (None, "no brotli") - exits when brotli is missing and --no-brotli is not given"""
+    if no_brotli:
+        return None, "no brotli"
+    try:
+        import brotli
+    except ImportError:
+        try:
+            import brotlicffi as brotli
+        except ImportError:
+            sys.exit("error: the 'brotli' module is missing - run 'pip install brotli' or pass --no-brotli")
+    version = getattr(brotli, "__version__", "unknown version")
+    return (lambda data: brotli.compress(data, quality=BROTLI_QUALITY, lgwin=BROTLI_WINDOW, mode=brotli.MODE_TEXT),
+            "{} {} -q{} -w{}".format(brotli.__name__, version, BROTLI_QUALITY, BROTLI_WINDOW))
+
+
+def fnv1a(path, seed):
+    value = seed
+    for byte in path.encode():
+        value = ((value ^ byte) * 16777619) & 0xFFFFFFFF
+    return value
+
+
+def find_seed(paths):
+    for seed in range(1, 1 << 24):
+        if len({fnv1a(path, seed) >> SLOT_SHIFT for path in paths}) == len(paths):
+            return seed
+    sys.exit("error: no perfect hash seed found")
+
+
+def c_array(name, data):
+    lines = ["static const uint8_t {}[] = {{".format(name)]
+    for i in range(0, len(data), 16):
+        lines.append("    " + ", ".join("0x{:02x}".format(b) for b in data[i:i + 16]) + ",")
+    lines.append("};")
+    return "\n".join(lines)
+
+
+def etag(data, encoding):
+    return '\\"{}-{}\\"'.format(hashlib.sha256(data).hexdigest()[:16], encoding)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--output", default=str(SKETCH / "webAssets.h"))
+    parser.add_argument("--gzip", action="store_true", help="use gzip -9 instead of zopfli - bigger, for when zopfli can not be installed")
+    parser.add_argument("--no-brotli", action="store_true", help="leave out the Brotli variants to save flash")
+    args = parser.parse_args()
+
+    compress_gzip, gzip_method = gzip_compressor(args.gzip)
+    compress_brotli, brotli_method = brotli_compressor(args.no_brotli)
+
+    icons = read_icons(SKETCH / "icons.h")
+    arrays = []
+    entries = []
+    for path, source, mime, immutable in ASSETS:
+        if source.startswith("icons.h:"):
+            text = icons[source.split(":", 1)[1]]
+        else:
+            text = (SKETCH / source).read_text()
+        if source.endswith(".htm"):
+            text = minify(inline_icons(text, icons))
+        raw = text.encode()
+        name = re.sub(r"\W", "_", source)
+
+        gz = compress_gzip(raw)
+        arrays.append("/* {} - {} bytes, gzip {} bytes */\n{}".format(source, len(raw), len(gz), c_array(name + "_gz", gz)))
+        br = compress_brotli(raw) if compress_brotli else None
+        if br:
+            arrays.append("/* {} - brotli {} bytes */\n{}".format(source, len(br), c_array(name + "_br", br)))
+        print("{}: {} -> {} bytes gzip{}".format(path, len(raw), len(gz), ", {} bytes brotli".format(len(br)) if br else ", no brotli"))
+
+        entries.append('    {{ "{}", "{}", {}_gz, sizeof({}_gz), "{}", {}, {}, {}, {} }},'.format(
+            path, mime, name, name,
+            etag(raw, "gz"),
+            name + "_br" if br else "nullptr",
+            "sizeof({}_br)".format(name) if br else "0",
+            '"{}"'.format(etag(raw, "br")) if br else "nullptr",
+            "true" if immutable else "false"))
+
+    seed = find_seed([asset[0] for asset in ASSETS])
+
+    header = """/* generated by tools/generate_assets.py - do not edit
+   gzip: {}
+   brotli: {} */
+
+#ifndef __WEBASSETS_H
+#define __WEBASSETS_H
+
+#include "assetHandler.h"
+
+{}
+
+static constexpr const uint32_t WEB_ASSETS_SEED = {};
+
+static constexpr const staticAsset WEB_ASSETS[]{{
+{}
+}};
+
+#endif
+""".format(gzip_method, brotli_method, "\n\n".join(arrays), seed, "\n".join(entries))
+
+    Path(args.output).write_text(header)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,90 @@
+#!/usr/bin/env python3
+"""A stand-in for the php script in 'copy to server' - to try the /library proxy without a lamp server.
+
+    python3 tools/library_standin.py ~/Music --port 8000 --delay 0.5
+
+Then set SCRIPT_URL in system_setup.h to http://<this pc>:8000/eSP32_vs1053.php and flash.
+
+It answers ?folder= with the same markup and the same ETag rules as the php script.
+Every request is printed with its status so cache hits on the esp32 are visible as requests that never arrive
+and revalidations as 304 lines. --delay slows every answer down to see the deferred responses at work.
+"""
+
+import argparse
+import hashlib
+import html
+import time
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+from pathlib import Path
+from urllib.parse import parse_qs, unquote, urlparse
+
+VALID_FILES = (".mp3", ".aac", ".ogg", ".pls", ".m3u")
+ADDFOLDER_ICON = '<img src="/addfoldericon.svg" class="foldericon addfolder">'
+EMPTY_ICON = '<img src="/emptyicon.svg" class="foldericon">'
+START_ICON = '<img src="/starticon.svg" class="icon starticon">'
+
+
+def has_audio(folder):
+    return any(f.suffix.lower() in VALID_FILES for f in folder.iterdir() if f.is_file())
+
+
+def listing(root, path):
+    folder = root / path
+    parts = ['<div id="uplink">up</div>'] if path else []
+    for sub in sorted(f for f in folder.iterdir() if f.is_dir()):
+        icons = ADDFOLDER_ICON + START_ICON if has_audio(sub) else EMPTY_ICON + EMPTY_ICON
+        parts.append('<div class="folderlink">%s<span class="text">%s</span></div>' % (icons, html.escape(sub.name)))
+    for f in sorted(f for f in folder.iterdir() if f.is_file() and f.suffix.lower() in VALID_FILES):
+        parts.append('<div class="filelink">%s<span class="text">%s</span></div>' % (START_ICON, html.escape(f.name)))
+    return "".join(parts).encode()
+
+
+def etag(root, path):
+    folder = root / path
+    stamp = path + str(int(folder.stat().st_mtime))
+    for sub in sorted(f for f in folder.iterdir() if f.is_dir()):
+        stamp += str(int(sub.stat().st_mtime))
+    return '"%s"' % hashlib.md5(stamp.encode()).hexdigest()
+
+
+def handler(root, delay):
+    class Handler(BaseHTTPRequestHandler):
+        def do_GET(self):
+            time.sleep(delay)
+            query = parse_qs(urlparse(self.path).query)
+            path = unquote(query.get("folder", [""])[0]).lstrip("/")
+            if ".." in path:
+                return self.answer(403, b"No traversing")
+            if not (root / path).is_dir():
+                return self.answer(404, b"Requested resource could not be found.")
+            tag = etag(root, path)
+            if self.headers.get("If-None-Match", "").strip() == tag:
+                return self.answer(304, b"", tag)
+            self.answer(200, listing(root, path), tag)
+
+        def answer(self, code, body, tag=None):
+            self.send_response(code)
+            if tag:
+                self.send_header("ETag", tag)
+                self.send_header("Cache-Control", "no-cache")
+            self.send_header("Content-Type", "text/html")
+            self.send_header("Content-Length", str(len(body)))
+            self.end_headers()
+            self.wfile.write(body)
+
+    return Handler
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("root", type=Path, help="the music folder to serve")
+    parser.add_argument("--port", type=int, default=8000)
+    parser.add_argument("--delay", type=float, default=0.0, help="seconds to wait before every answer")
+    args = parser.parse_args()
+    server = ThreadingHTTPServer(("", args.port), handler(args.root.resolve(), args.delay))
+    print("serving %s on port %i" % (args.root, args.port))
+    server.serve_forever()
+
+
+if __name__ == "__main__":
+    main()
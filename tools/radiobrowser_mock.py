@@ -0,0 +1,86 @@
+#!/usr/bin/env python3
+"""Mock radio-browser.info mirrors - to try the /search proxy and the mirror probe without internet.
+
+    python3 tools/radiobrowser_mock.py --port 8100 --delays 0.4 0.05 0.2
+
+This starts one mirror per delay on consecutive ports, every answer of a mirror is slowed down by its delay.
+Set RADIOBROWSER_SERVERS_URL in system_setup.h to http://<this pc>:8100/json/servers and flash.
+The player should pick the mirror on port 8101, the one with the 0.05 second delay.
+
+A search returns made up stations for any name: a few per page share an url to show the duplicate removal.
+Every request is printed, so cached searches are visible as requests that never arrive.
+"""
+
+import argparse
+import json
+import threading
+import time
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+from urllib.parse import parse_qs, urlparse
+
+TOTAL_STATIONS = 75
+
+
+def stations(name, offset, limit):
+    result = []
+    for number in range(offset, min(offset + limit, TOTAL_STATIONS)):
+        result.append({
+            "changeuuid": "change-%04i" % number,
+            "stationuuid": "station-%04i" % number,
+            "name": "%s é \"%i\"" % (name, number),
+            "url": "http://%s.example/stream%i;stream.mp3" % (name.replace(" ", "-"), number - number % 3),
+            "url_resolved": "http://example/resolved",
+            "tags": "mock,test",
+            "bitrate": 128 if number % 2 else 0,
+            "codec": "MP3",
+            "language": "english",
+            "geo_lat": None,
+        })
+    return result
+
+
+def handler(port, delay, ports):
+    class Handler(BaseHTTPRequestHandler):
+        def do_GET(self):
+            time.sleep(delay)
+            url = urlparse(self.path)
+            if url.path == "/json/servers":
+                return self.answer([{"ip": "127.0.0.1", "name": "%s:%i" % (self.headers.get("Host", "127.0.0.1").split(":")[0], p)} for p in ports for _ in range(2)])
+            if url.path == "/json/stats":
+                return self.answer({"supported_version": 1, "stations": TOTAL_STATIONS})
+            if url.path == "/json/stations/search":
+                query = parse_qs(url.query)
+                return self.answer(stations(query.get("name", [""])[0], int(query.get("offset", ["0"])[0]), int(query.get("limit", ["100"])[0])))
+            self.send_error(404)
+
+        do_POST = do_GET
+
+        def answer(self, data):
+            body = json.dumps(data).encode()
+            self.send_response(200)
+            self.send_header("Content-Type", "application/json")
+            self.send_header("Content-Length", str(len(body)))
+            self.end_headers()
+            self.wfile.write(body)
+
+        def log_message(self, format, *args):
+            print("mirror %i: %s" % (port, format % args))
+
+    return Handler
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--port", type=int, default=8100)
+    parser.add_argument("--delays", type=float, nargs="+", default=[0.4, 0.05, 0.2], help="seconds per answer, one mirror each")
+    args = parser.parse_args()
+    ports = [args.port + i for i in range(len(args.delays))]
+    for port, delay in zip(ports, args.delays):
+        server = ThreadingHTTPServer(("", port), handler(port, delay, ports))
+        threading.Thread(target=server.serve_forever, daemon=True).start()
+        print("mirror on port %i answers in %.2f s" % (port, delay))
+    threading.Event().wait()
+
+
+if __name__ == "__main__":
+    main()
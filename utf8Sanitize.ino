@@ -0,0 +1,112 @@
+// https://www.unicode.org/versions/Unicode15.0.0/ch03.pdf - Table 3-7. Well-Formed UTF-8 Byte Sequences
+
+// https://en.wikipedia.org/wiki/Byte_order_mark
+
+/* byte classes - see UTF8_SEQUENCE for their meaning */
+static const uint8_t UTF8_CLASS[256] = {
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,  /* 0x00 */
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,  /* 0x10 */
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  /* 0x20 */
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  /* 0x30 */
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  /* 0x40 */
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  /* 0x50 */
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  /* 0x60 */
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,  /* 0x70 */
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,  /* 0x80 */
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,  /* 0x90 */
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,  /* 0xA0 */
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,  /* 0xB0 */
+    3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,  /* 0xC0 */
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,  /* 0xD0 */
+    5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 6, 6,  /* 0xE0 */
+    8, 9, 9, 9, 10, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, /* 0xF0 */
+};
+
+/* sequence length and the valid range of the second byte for each class
+   a length of 0 means the byte can not start a sequence */
+struct utf8Sequence {
+    uint8_t length;
+    uint8_t low;
+    uint8_t high;
+};
+
+static const utf8Sequence UTF8_SEQUENCE[] = {
+    { 1, 0x00, 0x00 }, /* printable ascii */
+    { 0, 0x00, 0x00 }, /* control char - replaced with a space */
+    { 0, 0x00, 0x00 }, /* stray continuation byte */
+    { 0, 0x00, 0x00 }, /* never valid in utf8 */
+    { 2, 0x80, 0xBF }, /* C2..DF */
+    { 3, 0xA0, 0xBF }, /* E0 - no overlong forms */
+    { 3, 0x80, 0xBF }, /* E1..EC and EE..EF */
+    { 3, 0x80, 0x9F }, /* ED - no surrogates */
+    { 4, 0x90, 0xBF }, /* F0 - no overlong forms */
+    { 4, 0x80, 0xBF }, /* F1..F3 */
+    { 4, 0x80, 0x8F }, /* F4 - nothing above U+10FFFF */
+};
+
+static inline __attribute__((always_inline)) bool printableAscii(const uint32_t word) {
+    constexpr const uint32_t ONES = 0x01010101;
+    constexpr const uint32_t HIGH = 0x80808080;
+    const uint32_t del = word ^ 0x7F7F7F7F;
+    return !((word | (word - 0x20 * ONES)) & HIGH) && !((del - ONES) & ~del & HIGH);
+}
+
+/* Copies 'in' to 'out' as valid utf8 without control chars and returns the number of bytes written.
+   Bytes that are not part of a valid sequence are taken to be latin-1 and converted.
+   A byte order mark is skipped and a sequence is never split when 'out' is full. */
+size_t utf8Sanitize(const char* in, char* out, const size_t size) {
+    return utf8Sanitize(in, strlen(in), out, size);
+}
+
+/* same for 'length' bytes of 'in' that are not zero terminated */
+size_t utf8Sanitize(const char* in, const size_t length, char* out, const size_t size) {
+    if (!size) return 0;
+    const uint8_t* src = reinterpret_cast<const uint8_t*>(in);
+    const size_t limit = size - 1;
+    size_t pos = 0;
+    size_t used = 0;
+    while (pos < length) {
+        while (pos + 4 <= length && used + 4 <= limit) {
+            uint32_t word;
+            memcpy(&word, src + pos, 4);
+            if (!printableAscii(word)) break;
+            memcpy(out + used, &word, 4);
+            pos += 4;
+            used += 4;
+        }
+        if (pos == length) break;
+
+        const uint8_t byte = src[pos];
+        const utf8Sequence& sequence = UTF8_SEQUENCE[UTF8_CLASS[byte]];
+        size_t valid = sequence.length;
+        if (valid > 1) {
+            if (pos + valid > length || src[pos + 1] < sequence.low || src[pos + 1] > sequence.high)
+                valid = 0;
+            for (size_t i = 2; i < valid; i++)
+                if (UTF8_CLASS[src[pos + i]] != 2) valid = 0;
+        }
+
+        if (valid == 3 && byte == 0xEF && src[pos + 1] == 0xBB && src[pos + 2] == 0xBF) {
+            pos += 3;
+            continue;
+        }
+
+        if (valid) {
+            if (used + valid > limit) break;
+            memcpy(out + used, src + pos, valid);
+            used += valid;
+            pos += valid;
+        } else if (UTF8_CLASS[byte] == 1) {
+            if (used + 1 > limit) break;
+            out[used++] = ' ';
+            pos++;
+        } else {
+            if (used + 2 > limit) break;
+            out[used++] = 0xC0 | (byte >> 6);
+            out[used++] = 0x80 | (byte & 0x3F);
+            pos++;
+        }
+    }
+    out[used] = 0;
+    return used;
+}
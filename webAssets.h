@@ -0,0 +1,1370 @@
+/* generated by tools/generate_assets.py - do not edit
+   gzip: gzip -9
+   brotli: brotlicffi 1.0.9.2 -q11 -w22 */
+
+#ifndef __WEBASSETS_H
+#define __WEBASSETS_H
+
+#include "assetHandler.h"
+
+/* index.htm - 43626 bytes, gzip 10933 bytes */
+static const uint8_t index_htm_gz[] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xed, 0x7d, 0x7b, 0x7f, 0xd3, 0x46,
+    0x97, 0xf0, 0xff, 0xfe, 0x14, 0x83, 0x78, 0x5a, 0xdb, 0xc4, 0x92, 0x2d, 0xdf, 0xe2, 0x24, 0x24,
+    0x6c, 0x1a, 0xd2, 0x86, 0xdf, 0x02, 0xe1, 0x4d, 0x68, 0xd8, 0xfd, 0x01, 0xcb, 0x2b, 0x5b, 0x93,
+    0x58, 0x45, 0x96, 0xbc, 0x92, 0x9c, 0x0b, 0x6c, 0xde, 0xcf, 0xfe, 0x9e, 0x73, 0xe6, 0xa2, 0x91,
+    0x2c, 0x3b, 0xa1, 0x85, 0xe7, 0xe9, 0xb6, 0x94, 0x82, 0xa5, 0xb9, 0xcf, 0x99, 0x73, 0x9f, 0x33,
+    0xa3, 0xc7, 0x0f, 0xfc, 0x78, 0x92, 0xdd, 0xcc, 0x39, 0x9b, 0x66, 0xb3, 0x70, 0xaf, 0xf6, 0x18,
+    0x7f, 0x58, 0xe8, 0x45, 0x17, 0xbb, 0x16, 0x8f, 0x2c, 0x4c, 0xe0, 0x9e, 0x0f, 0x3f, 0xe9, 0x24,
+    0x09, 0xe6, 0xd9, 0x5e, 0x6d, 0x12, 0x47, 0x69, 0xc6, 0x7c, 0x3e, 0x5e, 0x5c, 0x04, 0x73, 0xb6,
+    0xcb, 0x2c, 0x77, 0xab, 0xeb, 0xb8, 0xc3, 0x91, 0xd3, 0x71, 0xdc, 0x8e, 0x6b, 0xed, 0x30, 0xd6,
+    0x6e, 0x4f, 0xa6, 0x50, 0x9f, 0xb3, 0x6c, 0x1a, 0xa4, 0x2c, 0x8b, 0xe1, 0x97, 0x33, 0x9e, 0xce,
+    0x7b, 0x5d, 0x06, 0x35, 0xce, 0xe3, 0x84, 0x25, 0x7c, 0x16, 0x67, 0x9c, 0x25, 0x8b, 0x28, 0x0a,
+    0xa2, 0x0b, 0x16, 0x9f, 0x8b, 0xa2, 0x73, 0xef, 0x82, 0xd7, 0x1e, 0xb7, 0x55, 0x4f, 0x8f, 0x67,
+    0x3c, 0xf3, 0x18, 0xb4, 0x95, 0xa4, 0x3c, 0xdb, 0xb5, 0x16, 0xd9, 0xb9, 0x3d, 0xb2, 0x54, 0x72,
+    0xe4, 0xcd, 0xf8, 0xae, 0x75, 0x19, 0xf0, 0xab, 0x79, 0x9c, 0x64, 0x16, 0x83, 0x61, 0x65, 0x3c,
+    0x82, 0x62, 0xb3, 0x20, 0x0a, 0x66, 0x5e, 0x68, 0x2f, 0x82, 0xd6, 0x55, 0xe0, 0x67, 0xd3, 0x5d,
+    0x9f, 0x5f, 0x06, 0x13, 0x6e, 0xd3, 0x4b, 0x0b, 0x32, 0xb3, 0x00, 0x72, 0xd3, 0x89, 0x17, 0xf2,
+    0x5d, 0x17, 0x9b, 0x0b, 0x83, 0xe8, 0x23, 0x8c, 0x28, 0xdc, 0xb5, 0x02, 0x68, 0xc4, 0x62, 0xd3,
+    0x84, 0x9f, 0xef, 0x5a, 0xbe, 0x97, 0x79, 0xdb, 0x3b, 0x63, 0x2f, 0xe5, 0xc3, 0x7e, 0x2b, 0x38,
+    0xfb, 0xe9, 0xf8, 0xe4, 0xaa, 0xf3, 0xef, 0xbf, 0x5c, 0xc4, 0xbb, 0xba, 0x8a, 0x28, 0x37, 0xcd,
+    0xb2, 0x79, 0xba, 0xdd, 0x6e, 0x9f, 0x43, 0xff, 0xa9, 0x73, 0x11, 0xc7, 0x17, 0x21, 0xf7, 0xe6,
+    0x41, 0xea, 0x4c, 0xe2, 0x59, 0x7b, 0x92, 0xa6, 0x4f, 0xce, 0xbd, 0x59, 0x10, 0xde, 0xec, 0x9e,
+    0xc4, 0xe3, 0x38, 0x8b, 0x2d, 0xd1, 0x51, 0x9a, 0xdd, 0x84, 0x3c, 0x9d, 0x72, 0x9e, 0x59, 0x1a,
+    0xb2, 0x2c, 0x4d, 0x26, 0x79, 0x73, 0x93, 0xd8, 0xe7, 0xce, 0x6f, 0xff, 0xbd, 0xe0, 0xc9, 0x0d,
+    0xb5, 0x24, 0x1e, 0xed, 0x9e, 0xd3, 0x77, 0x5c, 0xe7, 0xb7, 0xd4, 0xda, 0x33, 0xc0, 0x94, 0x05,
+    0x59, 0xc8, 0xf7, 0xf8, 0x69, 0x96, 0x70, 0x6f, 0xf6, 0x2a, 0xf4, 0x6e, 0x78, 0xd2, 0xeb, 0x3e,
+    0x6e, 0x8b, 0xe4, 0x02, 0xb8, 0x7c, 0x2e, 0x2a, 0x05, 0x38, 0x4f, 0x0d, 0xb1, 0x52, 0x4d, 0x16,
+    0x40, 0x7a, 0x72, 0xee, 0x4d, 0x78, 0x09, 0xd8, 0xde, 0x22, 0x9b, 0xc6, 0x89, 0x51, 0xf1, 0x80,
+    0x87, 0x61, 0xc0, 0xf3, 0x29, 0xec, 0x3d, 0x38, 0x5f, 0x44, 0x13, 0x6c, 0x9d, 0x35, 0xbc, 0x16,
+    0x1b, 0x37, 0xd9, 0x67, 0x66, 0xa9, 0x24, 0x8b, 0xed, 0xee, 0x32, 0x44, 0x34, 0x58, 0x6d, 0x9f,
+    0x9f, 0x07, 0x11, 0x67, 0x3f, 0xfe, 0x28, 0x9f, 0x1c, 0x6f, 0xe6, 0xb3, 0x27, 0xf2, 0xa5, 0xf1,
+    0xf6, 0x3d, 0xd5, 0xdd, 0x66, 0xd6, 0x22, 0x12, 0x49, 0xbe, 0xc5, 0x1e, 0xe8, 0xca, 0xb3, 0xd8,
+    0x5f, 0x84, 0x54, 0x59, 0x3c, 0x39, 0xfc, 0x1a, 0x51, 0x20, 0x85, 0x06, 0x4a, 0x09, 0xbb, 0x6c,
+    0xdc, 0xc0, 0x76, 0x3c, 0xe7, 0x84, 0xc3, 0xa0, 0x23, 0x0e, 0x03, 0x89, 0x2e, 0xde, 0xf0, 0xf1,
+    0x69, 0x3c, 0xf9, 0xc8, 0x33, 0x99, 0x7f, 0xdb, 0x40, 0xe4, 0x6b, 0xb1, 0x7c, 0xec, 0x38, 0x6e,
+    0xfd, 0xe6, 0x35, 0xc6, 0x2d, 0x36, 0x69, 0x31, 0xbf, 0x90, 0x1a, 0xea, 0x09, 0x5e, 0x7a, 0x09,
+    0x9b, 0x40, 0x53, 0x40, 0x46, 0x8b, 0x19, 0x80, 0xc5, 0x99, 0x00, 0x30, 0x33, 0x7e, 0x78, 0x09,
+    0xcf, 0x0d, 0xeb, 0x60, 0x91, 0x66, 0xf1, 0x8c, 0x5e, 0xac, 0xe6, 0x0e, 0xac, 0x7e, 0xb6, 0x48,
+    0x22, 0x36, 0x71, 0x10, 0x0f, 0x8d, 0x3c, 0x6c, 0xed, 0x81, 0x2b, 0xfe, 0x8e, 0x9b, 0xd0, 0x1f,
+    0xbb, 0xa5, 0x86, 0x39, 0x34, 0xfc, 0x59, 0x10, 0xdb, 0x36, 0x65, 0xc2, 0x1a, 0xc4, 0x33, 0x2f,
+    0x0b, 0x26, 0xc7, 0x73, 0x1e, 0x41, 0x52, 0xa7, 0x05, 0x6d, 0xca, 0xb9, 0x3d, 0xc3, 0x75, 0xbb,
+    0xf4, 0xc2, 0x6d, 0xe6, 0xf2, 0x5e, 0x8b, 0xcd, 0xbc, 0xeb, 0x93, 0xe5, 0xac, 0x1e, 0xef, 0x1b,
+    0x55, 0x9e, 0xf2, 0x89, 0x77, 0x03, 0xe5, 0x9d, 0x41, 0x8b, 0x65, 0xc1, 0x8c, 0xc7, 0x0b, 0xa3,
+    0x68, 0x97, 0xf7, 0xd8, 0xed, 0x0e, 0xf3, 0xd9, 0xff, 0xfc, 0x0f, 0x6b, 0xf8, 0x38, 0x92, 0x5b,
+    0x98, 0x02, 0xd2, 0x6f, 0x03, 0xc7, 0x76, 0x0e, 0x88, 0xc2, 0x78, 0x93, 0x48, 0xf7, 0xed, 0xf9,
+    0x7b, 0x64, 0x05, 0x95, 0xeb, 0xe5, 0x63, 0xe6, 0x13, 0xf1, 0xb3, 0xcd, 0x38, 0xfc, 0xec, 0x50,
+    0x1d, 0x67, 0x91, 0x84, 0xb8, 0x04, 0x2d, 0xf1, 0xa6, 0xc7, 0xb4, 0x9f, 0x65, 0x7c, 0x36, 0xa7,
+    0xe5, 0xeb, 0xe8, 0x3c, 0xcf, 0xbf, 0x39, 0xcd, 0x00, 0xac, 0x90, 0xa8, 0xd7, 0xcf, 0x39, 0x38,
+    0x7e, 0xf9, 0xf2, 0xf0, 0xe0, 0xf5, 0xb3, 0x97, 0xbf, 0xc8, 0x72, 0xf3, 0x04, 0x68, 0x6c, 0x12,
+    0x63, 0xb3, 0xd1, 0x22, 0x0c, 0x77, 0x08, 0x86, 0xd3, 0x16, 0xbb, 0x80, 0x04, 0xb1, 0xc8, 0x01,
+    0x3c, 0x21, 0x1c, 0x7f, 0x93, 0xbf, 0x1f, 0x2b, 0x56, 0x2e, 0xe4, 0x33, 0x5a, 0x3b, 0x3f, 0xb8,
+    0xc4, 0x35, 0xfb, 0xe8, 0x78, 0xbe, 0x4f, 0xab, 0xf4, 0x3c, 0x48, 0x01, 0xf1, 0x79, 0xd2, 0xb0,
+    0x62, 0x80, 0xbe, 0x65, 0xa2, 0x8c, 0x87, 0xa8, 0x70, 0xe1, 0xc4, 0x11, 0xe6, 0xe0, 0xdb, 0x2d,
+    0xac, 0x62, 0x55, 0xcd, 0x49, 0x18, 0xa7, 0xbc, 0xba, 0x2a, 0x65, 0xad, 0xad, 0xab, 0x71, 0x78,
+    0x45, 0x03, 0x3a, 0x7f, 0x5d, 0x2b, 0x33, 0x9e, 0xa6, 0xc0, 0x68, 0xab, 0x9b, 0x90, 0x99, 0xeb,
+    0xea, 0xf3, 0x24, 0x01, 0x2e, 0x50, 0x59, 0x9b, 0xb2, 0x54, 0x5d, 0x5a, 0x91, 0x72, 0x75, 0x00,
+    0xf7, 0x72, 0x9b, 0xce, 0x38, 0x88, 0xfc, 0xc6, 0xc7, 0xa6, 0x5e, 0xed, 0x59, 0x7c, 0xc9, 0x97,
+    0xab, 0x55, 0xa4, 0x97, 0x6a, 0xfa, 0x41, 0x3a, 0xf7, 0xb2, 0xc9, 0x94, 0xca, 0x50, 0x9d, 0x42,
+    0x4a, 0xa9, 0x34, 0x2e, 0x15, 0x14, 0xca, 0xe7, 0x41, 0xf4, 0x3c, 0x45, 0xe4, 0xe1, 0x57, 0x39,
+    0x9a, 0x35, 0x2e, 0x10, 0x53, 0x91, 0x26, 0x81, 0x0e, 0xde, 0xbe, 0x87, 0xda, 0x63, 0x7c, 0x2a,
+    0xb5, 0xdd, 0x08, 0x0b, 0xeb, 0xd3, 0x84, 0x62, 0x50, 0x91, 0x28, 0x17, 0x4b, 0x7b, 0xe2, 0x71,
+    0x3f, 0x0c, 0x9b, 0xc8, 0xb9, 0x50, 0x88, 0xc6, 0xc0, 0xa9, 0x28, 0xb1, 0x61, 0x55, 0xb2, 0x27,
+    0x00, 0xb1, 0xe5, 0x09, 0x5a, 0xb0, 0x65, 0x36, 0x24, 0xd1, 0x60, 0x9a, 0x02, 0xb3, 0x91, 0x26,
+    0x01, 0xbb, 0x91, 0x28, 0x40, 0x42, 0xbe, 0x16, 0xf4, 0xdb, 0x28, 0xf2, 0xb1, 0xaf, 0x30, 0x08,
+    0x95, 0x1c, 0x47, 0xb6, 0xe4, 0x11, 0x7a, 0x1c, 0x92, 0x90, 0x80, 0x4e, 0x7d, 0x47, 0xa0, 0xaf,
+    0x4a, 0x72, 0xd9, 0x2d, 0x16, 0x2a, 0x31, 0x15, 0x18, 0xf8, 0x54, 0x12, 0x49, 0x01, 0xf2, 0x38,
+    0xd2, 0x09, 0x08, 0xce, 0x44, 0x4d, 0x82, 0x7f, 0x1d, 0xf8, 0x89, 0xae, 0x8c, 0xe1, 0x5e, 0x98,
+    0x3c, 0x62, 0xaa, 0x5f, 0x30, 0x63, 0x05, 0x93, 0x39, 0x7e, 0x75, 0xf8, 0x52, 0x64, 0x57, 0xf0,
+    0xa7, 0x7c, 0x1d, 0x42, 0xc9, 0x14, 0x60, 0x86, 0xbe, 0x13, 0xa4, 0x7a, 0x44, 0x82, 0xc3, 0x8d,
+    0x15, 0xbb, 0x29, 0x21, 0x0d, 0x08, 0x15, 0x00, 0xd3, 0x54, 0x11, 0x7f, 0x01, 0x26, 0x13, 0x04,
+    0x4a, 0x70, 0x0e, 0x0f, 0x65, 0xc0, 0x4c, 0x25, 0x7f, 0x03, 0x76, 0xd6, 0x5c, 0x3d, 0xf0, 0x83,
+    0xe7, 0xc7, 0xa7, 0x87, 0x4f, 0x5b, 0x95, 0x88, 0x4a, 0x4c, 0xa8, 0x09, 0x63, 0xe5, 0x21, 0xf4,
+    0xfa, 0x79, 0x4d, 0x23, 0x9a, 0xc5, 0x16, 0xa6, 0x6a, 0x62, 0x3a, 0x4e, 0x18, 0xd5, 0x15, 0xc8,
+    0x99, 0xd0, 0x03, 0x22, 0x03, 0x34, 0x97, 0xc6, 0x11, 0x25, 0x89, 0x47, 0x4c, 0xbc, 0xf2, 0xd2,
+    0x03, 0x98, 0x8b, 0x48, 0x56, 0x2f, 0x55, 0x40, 0x91, 0x24, 0xf6, 0x1b, 0x49, 0x9e, 0xaf, 0x82,
+    0x06, 0x8a, 0xed, 0x2a, 0x3c, 0x58, 0x03, 0x14, 0x49, 0x5c, 0x38, 0x1f, 0x63, 0xd5, 0x15, 0x06,
+    0xb3, 0x47, 0xec, 0x85, 0x97, 0x01, 0xe6, 0xc4, 0x57, 0x0d, 0x23, 0x9b, 0x04, 0x69, 0x25, 0x9a,
+    0x40, 0x73, 0x2b, 0x89, 0xb3, 0xa2, 0xf8, 0xc6, 0x06, 0xb6, 0x42, 0x52, 0xe4, 0x41, 0x87, 0xb0,
+    0x83, 0xb3, 0x3d, 0x48, 0xa9, 0x92, 0xe6, 0x20, 0x55, 0x57, 0x64, 0x6c, 0xa3, 0x60, 0xbe, 0x55,
+    0xb8, 0x25, 0x99, 0xfa, 0x32, 0xaf, 0xfb, 0x2a, 0xa0, 0xcd, 0xe5, 0x89, 0x64, 0x94, 0x63, 0x07,
+    0x95, 0x67, 0x09, 0xc6, 0x89, 0x40, 0x18, 0x55, 0x08, 0x52, 0x27, 0x94, 0x8d, 0x74, 0x41, 0x0f,
+    0xcb, 0x6b, 0x31, 0xd1, 0x44, 0x41, 0xf2, 0xe4, 0x1b, 0x0d, 0x5b, 0x89, 0x31, 0x35, 0xe8, 0x6a,
+    0xa4, 0x10, 0xa5, 0x9a, 0x12, 0x98, 0x2e, 0xe9, 0xb0, 0x24, 0xd7, 0x4c, 0x3d, 0x0c, 0x3b, 0xd6,
+    0x12, 0xa5, 0xf1, 0xc0, 0x55, 0x02, 0x26, 0xe5, 0x91, 0xbf, 0x3c, 0x7a, 0x24, 0xe9, 0x69, 0x53,
+    0xa9, 0x82, 0x5f, 0x61, 0x2e, 0xd8, 0x4d, 0x71, 0x22, 0x53, 0xea, 0x1a, 0xba, 0x43, 0x4d, 0x2b,
+    0x89, 0xaf, 0x98, 0xf5, 0xec, 0xe5, 0xd9, 0xfe, 0xf3, 0x67, 0x4f, 0x3f, 0x9c, 0xbe, 0xde, 0x7f,
+    0x7d, 0xf8, 0xe1, 0xf0, 0xe4, 0x04, 0x50, 0xe4, 0x95, 0xb7, 0x48, 0xd1, 0xfc, 0x02, 0x0b, 0x4d,
+    0xa3, 0x21, 0xbb, 0xe2, 0xe3, 0x54, 0xb4, 0x8c, 0x13, 0xa6, 0x69, 0x2c, 0xb3, 0x26, 0xad, 0xdc,
+    0x1b, 0x0a, 0x5f, 0xae, 0xdd, 0x7b, 0x38, 0xf8, 0x06, 0xae, 0x30, 0xe8, 0xa1, 0x4d, 0xa9, 0x73,
+    0x75, 0x90, 0x6d, 0x41, 0xfa, 0x54, 0xca, 0x09, 0xd1, 0xc4, 0xad, 0x16, 0xf9, 0xe7, 0x09, 0x18,
+    0x44, 0x4b, 0x32, 0xa1, 0x50, 0x85, 0x16, 0x41, 0xc1, 0xcd, 0x13, 0xbc, 0x1b, 0xbb, 0x5c, 0x25,
+    0x50, 0xa0, 0xf1, 0x62, 0xa9, 0xe5, 0x89, 0x54, 0x17, 0xd3, 0x60, 0xbe, 0xbb, 0x6c, 0x15, 0x69,
+    0x55, 0x16, 0x5c, 0x46, 0x65, 0x5d, 0x4c, 0x2d, 0xba, 0x94, 0x11, 0x9e, 0xc1, 0x74, 0x57, 0xaa,
+    0xbb, 0x1e, 0xc9, 0xa5, 0x0a, 0x41, 0xe5, 0x11, 0xdf, 0x5f, 0xaa, 0x2a, 0xd2, 0x54, 0xf6, 0xe1,
+    0xd3, 0x4a, 0x49, 0xe1, 0x81, 0xde, 0xb6, 0x63, 0x18, 0x96, 0x64, 0xa6, 0xee, 0xd5, 0x1e, 0xb1,
+    0xcf, 0xb5, 0x71, 0x7c, 0x6d, 0xa7, 0xc1, 0x27, 0x80, 0xc9, 0x36, 0x1b, 0xc7, 0x89, 0xcf, 0x13,
+    0x1b, 0x92, 0x76, 0x6a, 0xb7, 0x35, 0xf4, 0x17, 0xb4, 0x20, 0xdf, 0xbf, 0x81, 0x62, 0xf3, 0x38,
+    0x0d, 0x70, 0x76, 0x60, 0x73, 0x01, 0x1a, 0x85, 0x8b, 0x8c, 0xef, 0xd4, 0xb2, 0x78, 0xbe, 0x0d,
+    0x92, 0x12, 0x8a, 0x64, 0x40, 0x33, 0xf4, 0x18, 0xf2, 0xf3, 0x8c, 0x1e, 0x92, 0xe0, 0x62, 0x2a,
+    0x9e, 0x66, 0x5e, 0x72, 0x11, 0x44, 0xf4, 0x38, 0x07, 0xfd, 0x90, 0x3a, 0xc2, 0x4a, 0xde, 0xe4,
+    0xe3, 0x45, 0x12, 0x03, 0x9e, 0x6d, 0xb3, 0x87, 0xe7, 0x2e, 0xfe, 0x81, 0x16, 0xf9, 0x75, 0x66,
+    0x7b, 0x61, 0x70, 0x01, 0xe5, 0x27, 0x1c, 0x79, 0xde, 0x4e, 0x0d, 0xed, 0x6f, 0x5b, 0xd8, 0xda,
+    0xdb, 0xac, 0x2e, 0xac, 0xed, 0x7a, 0x8b, 0xa5, 0x5e, 0x94, 0xda, 0x29, 0x4f, 0x82, 0xf3, 0x9d,
+    0x1a, 0x28, 0x8f, 0xc9, 0x79, 0x18, 0x5f, 0x6d, 0xb3, 0x69, 0xe0, 0xfb, 0x3c, 0xc2, 0xd1, 0x3b,
+    0x11, 0xa0, 0x44, 0x88, 0x88, 0xff, 0xb9, 0x66, 0x03, 0xee, 0x7f, 0x0c, 0x32, 0x3b, 0x8b, 0x17,
+    0x93, 0xa9, 0x3d, 0xf1, 0xc2, 0x10, 0x38, 0xf6, 0x36, 0x8b, 0x60, 0xf1, 0x76, 0x6a, 0xed, 0x47,
+    0x2c, 0x38, 0x3e, 0x65, 0xa7, 0xde, 0xb9, 0x97, 0x04, 0xec, 0x51, 0x5b, 0x97, 0x5e, 0x40, 0xeb,
+    0xb6, 0x68, 0xc3, 0x28, 0x6b, 0x94, 0xfb, 0x88, 0x10, 0x5a, 0x51, 0xec, 0xdf, 0xe3, 0x08, 0x0d,
+    0x7b, 0xc0, 0x8c, 0xa3, 0xd7, 0x2f, 0x9e, 0x53, 0xf1, 0x59, 0xfc, 0x69, 0x45, 0xe1, 0x9f, 0x03,
+    0x20, 0x93, 0xf8, 0x5a, 0x94, 0x4a, 0x57, 0x14, 0x22, 0x11, 0x10, 0x81, 0x71, 0x7b, 0x78, 0x3d,
+    0x0f, 0xe3, 0x84, 0x27, 0xed, 0x43, 0x1f, 0xf0, 0x13, 0xea, 0x54, 0x97, 0x7f, 0x09, 0x5a, 0xdd,
+    0x1c, 0xda, 0x0d, 0xae, 0xb9, 0xcf, 0x00, 0x40, 0x29, 0xac, 0x5e, 0x6b, 0xb2, 0x48, 0x12, 0x80,
+    0x6b, 0x78, 0xc3, 0xd2, 0xc5, 0x1c, 0x6d, 0x69, 0xc8, 0x1b, 0xdf, 0xb0, 0x03, 0xe0, 0x25, 0x33,
+    0xce, 0x3c, 0xe0, 0x6a, 0xc0, 0xf6, 0x12, 0x0f, 0x5b, 0xbd, 0xad, 0x79, 0x00, 0x3a, 0x50, 0xa1,
+    0xe2, 0x04, 0x30, 0x23, 0x84, 0xe5, 0x92, 0xeb, 0xe3, 0x03, 0x4b, 0x49, 0x3c, 0x81, 0x0c, 0xa2,
+    0xb7, 0xdb, 0xda, 0xc3, 0x30, 0x9e, 0x50, 0xd2, 0x18, 0x24, 0xc3, 0x67, 0x73, 0xcd, 0xaf, 0xa6,
+    0x41, 0xc6, 0x6d, 0x60, 0xbe, 0x13, 0x8e, 0xc5, 0xaf, 0x12, 0x6f, 0x6e, 0x22, 0x02, 0x1b, 0xcd,
+    0x09, 0xd9, 0x1e, 0x06, 0xd1, 0x79, 0xbc, 0x54, 0x79, 0x79, 0x61, 0x2b, 0x9b, 0x83, 0xd5, 0xce,
+    0xbc, 0x31, 0x3a, 0x79, 0xa0, 0xfa, 0x94, 0x0b, 0xd4, 0xeb, 0x76, 0x44, 0xcb, 0xce, 0x78, 0x01,
+    0xe8, 0x49, 0x03, 0x13, 0x4f, 0x88, 0xf4, 0x1a, 0xf9, 0x6c, 0x39, 0xc1, 0x10, 0x2b, 0x5d, 0x24,
+    0xfc, 0x66, 0xa7, 0x86, 0xa2, 0x22, 0x44, 0xe3, 0xf9, 0x3c, 0xe4, 0xd0, 0x02, 0xa1, 0xa3, 0x0d,
+    0xbd, 0xce, 0x52, 0x10, 0xbe, 0x91, 0x0f, 0x18, 0x19, 0xc6, 0x1e, 0x74, 0x80, 0xb8, 0x8e, 0xc8,
+    0x8f, 0x34, 0xa3, 0x20, 0x01, 0x78, 0x15, 0x02, 0xd7, 0x54, 0xaf, 0x00, 0xee, 0x14, 0x5b, 0x9f,
+    0xc7, 0x81, 0x40, 0x66, 0x3d, 0x37, 0x36, 0xc0, 0xd1, 0x69, 0x38, 0x0c, 0xe7, 0xd7, 0xac, 0xd7,
+    0xc3, 0xa4, 0x2c, 0x01, 0xc4, 0x96, 0xa4, 0xd6, 0x71, 0x7a, 0xa9, 0xea, 0x01, 0x90, 0x77, 0x6e,
+    0x63, 0x97, 0x76, 0xe2, 0xf9, 0xc1, 0x02, 0xc6, 0x42, 0x2d, 0x18, 0x99, 0x44, 0x72, 0x95, 0xb9,
+    0x82, 0x40, 0x8b, 0xb5, 0x3b, 0xe5, 0xdc, 0x62, 0xf5, 0x4e, 0x25, 0xe8, 0xb6, 0xa7, 0xb8, 0x22,
+    0x95, 0x00, 0x7c, 0xe8, 0xfb, 0xbe, 0x5a, 0x09, 0xe9, 0x47, 0x82, 0x72, 0xe4, 0x9b, 0x83, 0xc1,
+    0x74, 0x7e, 0xc8, 0x17, 0xd3, 0x06, 0xd0, 0x02, 0x27, 0x8a, 0xc1, 0x8c, 0x2f, 0x10, 0xbc, 0x80,
+    0xe7, 0x4a, 0x46, 0x33, 0xe8, 0x88, 0x19, 0x09, 0x5e, 0xb3, 0xd5, 0xcf, 0xe7, 0xa7, 0xa0, 0x6d,
+    0xb2, 0x14, 0xdf, 0x4b, 0x3e, 0x8a, 0xe5, 0x04, 0xdc, 0x7a, 0xf5, 0x7c, 0xff, 0x3f, 0x9f, 0x3f,
+    0x3b, 0x7d, 0x0d, 0x03, 0xca, 0xf9, 0x92, 0x60, 0x55, 0x34, 0xb2, 0x5b, 0xa4, 0x17, 0x41, 0x28,
+    0x28, 0x53, 0xe7, 0x01, 0x28, 0x0a, 0xe4, 0x0e, 0x41, 0xff, 0xe6, 0x15, 0x98, 0x96, 0xf1, 0x15,
+    0x64, 0x21, 0x52, 0x84, 0x60, 0x9e, 0x32, 0x1b, 0xfa, 0x03, 0x19, 0x1e, 0x86, 0xde, 0x9c, 0xc4,
+    0xac, 0x58, 0xd4, 0x14, 0x89, 0x26, 0xef, 0xca, 0x99, 0x87, 0x88, 0x33, 0x26, 0x3e, 0xc3, 0x9f,
+    0x2e, 0xac, 0x73, 0x47, 0x4e, 0x3b, 0x47, 0x6e, 0xf4, 0xb6, 0x41, 0x53, 0x29, 0x0d, 0x76, 0x31,
+    0x47, 0x27, 0x64, 0xab, 0xe6, 0x9c, 0xc7, 0x21, 0x4c, 0x4e, 0xbd, 0x04, 0x21, 0x97, 0x8f, 0x29,
+    0x39, 0xf5, 0xe4, 0x8b, 0xe8, 0x05, 0x0b, 0x78, 0x97, 0x71, 0x02, 0xcf, 0x32, 0x9d, 0xa4, 0x92,
+    0x94, 0x61, 0xd4, 0x16, 0x40, 0x85, 0x9c, 0x9b, 0x9f, 0x0b, 0x60, 0x12, 0x20, 0x2a, 0x12, 0xb9,
+    0x1a, 0xaf, 0x1c, 0x2b, 0xf1, 0x5f, 0x90, 0x10, 0x5c, 0x91, 0x94, 0x46, 0x5a, 0x2c, 0xe0, 0x52,
+    0x52, 0x81, 0x46, 0x14, 0xe3, 0xbe, 0x27, 0xf1, 0x6a, 0x72, 0x43, 0xd8, 0x52, 0x1b, 0x84, 0x46,
+    0xe6, 0x04, 0x4a, 0x83, 0x9e, 0x78, 0x3e, 0xcf, 0xc6, 0xe1, 0x42, 0x70, 0x9e, 0x14, 0x6c, 0xa8,
+    0xc9, 0x54, 0xb0, 0x8e, 0x12, 0xe9, 0x56, 0xe1, 0x52, 0x85, 0x84, 0x52, 0x38, 0x35, 0x20, 0x9a,
+    0x51, 0xfc, 0xa3, 0x4f, 0x33, 0x5b, 0x21, 0xbd, 0x74, 0xbf, 0x73, 0x34, 0xe4, 0x13, 0x93, 0xef,
+    0xb8, 0x1d, 0x44, 0x29, 0x89, 0xf8, 0x4a, 0x96, 0xc0, 0xf2, 0x85, 0xb6, 0x77, 0xe9, 0x05, 0xa1,
+    0x37, 0x0e, 0xf9, 0x1a, 0x41, 0x67, 0x02, 0xfa, 0x93, 0x0d, 0xa8, 0xc7, 0xaf, 0xb7, 0x59, 0x0f,
+    0x3b, 0xfc, 0x37, 0x12, 0x20, 0xca, 0xa5, 0xc5, 0x40, 0x25, 0x94, 0xec, 0x1d, 0xf5, 0x8d, 0xe5,
+    0xe1, 0xa8, 0x01, 0x60, 0x25, 0xa3, 0xe3, 0xdb, 0x22, 0xc8, 0x82, 0x68, 0xbe, 0x40, 0x3a, 0x85,
+    0xa5, 0x02, 0x95, 0xd7, 0x0b, 0xd5, 0x98, 0x66, 0xb0, 0x62, 0x58, 0xdc, 0x98, 0xfe, 0xad, 0xc2,
+    0x48, 0xe4, 0xb3, 0x80, 0x52, 0x92, 0xdd, 0xca, 0x7e, 0x7a, 0x1d, 0x13, 0x76, 0xe2, 0xed, 0xae,
+    0x46, 0x11, 0x7f, 0x4c, 0x36, 0x55, 0x60, 0x5d, 0x85, 0xee, 0x04, 0xdf, 0xd1, 0xe8, 0xae, 0x5e,
+    0x25, 0xad, 0xe8, 0xdc, 0x9c, 0x62, 0xf2, 0x24, 0x49, 0x37, 0x3a, 0x21, 0xa7, 0x9e, 0xbc, 0x8c,
+    0x41, 0x3a, 0x46, 0x5b, 0x92, 0x62, 0x34, 0xcf, 0x5b, 0x62, 0xe6, 0x26, 0x4e, 0x1a, 0xf2, 0x03,
+    0x01, 0x3c, 0x8d, 0xaf, 0xd2, 0x8c, 0x04, 0x22, 0x8c, 0x52, 0x74, 0x49, 0x5e, 0x7b, 0xfd, 0x86,
+    0xe2, 0x0e, 0xda, 0xac, 0xc2, 0x03, 0x05, 0x1e, 0x97, 0xe0, 0xb0, 0x4c, 0x45, 0x26, 0x9e, 0x28,
+    0x50, 0x61, 0x3b, 0x06, 0xab, 0x71, 0xd7, 0xc2, 0x1f, 0x07, 0x98, 0x79, 0x49, 0x26, 0xd0, 0x60,
+    0x09, 0x75, 0x0d, 0xe1, 0x2c, 0xf0, 0x70, 0x09, 0x31, 0x57, 0x08, 0xe1, 0x42, 0xab, 0x0a, 0x3f,
+    0x72, 0xee, 0xa7, 0x06, 0xfb, 0x10, 0xc5, 0x03, 0xb0, 0xff, 0xb9, 0x17, 0xf1, 0x70, 0x85, 0x6a,
+    0xb9, 0x5e, 0xa5, 0x34, 0x01, 0x1f, 0x44, 0x53, 0xc0, 0x91, 0x8c, 0x1a, 0x9e, 0xd3, 0x46, 0x07,
+    0x02, 0x7e, 0x91, 0xfe, 0x5e, 0x45, 0x42, 0xb4, 0x21, 0x87, 0x68, 0xb2, 0x94, 0x20, 0x42, 0xc9,
+    0x6e, 0x5f, 0x24, 0x81, 0x5f, 0xa2, 0x8b, 0x87, 0x97, 0x30, 0x6a, 0x60, 0x55, 0x61, 0xe0, 0x13,
+    0xa2, 0xac, 0x82, 0x7b, 0x91, 0x3a, 0x4a, 0xf5, 0x34, 0x4e, 0x03, 0xf4, 0x15, 0x42, 0xea, 0x34,
+    0x03, 0xb0, 0x48, 0x04, 0xc0, 0x12, 0x85, 0x3c, 0x6e, 0x95, 0xc7, 0xeb, 0xe4, 0xd4, 0x52, 0x85,
+    0xb1, 0x30, 0x3f, 0x6c, 0x9e, 0xc8, 0xc4, 0xa0, 0x08, 0x0f, 0xc7, 0x6b, 0x4a, 0x77, 0x29, 0x56,
+    0x61, 0x35, 0x02, 0x9f, 0xb9, 0x40, 0xa6, 0x52, 0x34, 0x40, 0x7d, 0x1f, 0xf4, 0xcc, 0x8c, 0x97,
+    0xd5, 0x81, 0x55, 0x15, 0xcc, 0x95, 0x4a, 0x38, 0x29, 0x08, 0x0f, 0xc1, 0x2c, 0xcc, 0xe2, 0xe4,
+    0xc6, 0x44, 0x57, 0xc0, 0x0c, 0xda, 0x00, 0x41, 0xc0, 0x5e, 0xdb, 0x92, 0xa5, 0xf4, 0x3b, 0x28,
+    0x0a, 0x0c, 0xe4, 0x93, 0x04, 0x01, 0x4b, 0x16, 0x64, 0x37, 0xa8, 0x1d, 0x8d, 0x0a, 0xed, 0xcd,
+    0x8d, 0x16, 0x7b, 0xd5, 0xa4, 0x53, 0xb9, 0xe8, 0xeb, 0x84, 0x31, 0x26, 0x03, 0x80, 0x4d, 0x3c,
+    0x10, 0xba, 0xc6, 0xef, 0xb7, 0x87, 0x56, 0x48, 0x32, 0x29, 0x83, 0x35, 0x3a, 0x1b, 0xd3, 0xdc,
+    0x22, 0xfe, 0xff, 0x50, 0x0a, 0xc3, 0x7c, 0x48, 0x2b, 0xc7, 0x40, 0xb3, 0x17, 0x5d, 0xbb, 0x83,
+    0x1f, 0x74, 0xe7, 0xf4, 0x5c, 0x92, 0xfe, 0x08, 0x95, 0xd5, 0xab, 0x57, 0xc1, 0x97, 0x35, 0x77,
+    0x10, 0x3c, 0xa6, 0x04, 0x96, 0xdb, 0x1a, 0x98, 0xc6, 0xd0, 0x6c, 0x9a, 0x96, 0x64, 0xf6, 0xc3,
+    0xf3, 0x73, 0x0e, 0xff, 0x95, 0x55, 0xb6, 0xbc, 0xfc, 0xdb, 0x4b, 0x0f, 0xe0, 0xf0, 0x1e, 0xad,
+    0x35, 0x12, 0x59, 0xf3, 0x39, 0xa0, 0xbb, 0x17, 0x4d, 0xb4, 0x2e, 0xad, 0x44, 0xe9, 0x72, 0xce,
+    0x72, 0x4a, 0xde, 0xec, 0xf6, 0xb6, 0xaa, 0xa7, 0x52, 0x6c, 0xa1, 0x2a, 0x54, 0x0e, 0x6e, 0x6d,
+    0x3d, 0x1a, 0x60, 0xcb, 0x2c, 0x81, 0x03, 0x5d, 0xd3, 0xac, 0x04, 0x2f, 0x32, 0x26, 0x59, 0xa8,
+    0x5b, 0xe4, 0x4a, 0xa6, 0x46, 0x21, 0x91, 0x7e, 0x0b, 0x39, 0x70, 0xd9, 0x84, 0xd1, 0xf5, 0x95,
+    0xb8, 0x36, 0x67, 0xac, 0x31, 0xa6, 0x58, 0x4b, 0x75, 0x83, 0x64, 0x45, 0x7d, 0x69, 0x64, 0x49,
+    0x78, 0x08, 0x92, 0xe9, 0x52, 0x21, 0x8b, 0xdd, 0x75, 0x89, 0xa7, 0xcb, 0xfe, 0xdd, 0x1f, 0x4c,
+    0xdc, 0xc3, 0xde, 0x1f, 0xb7, 0xa5, 0xbb, 0xe0, 0x71, 0x5b, 0x46, 0x0c, 0x90, 0x4f, 0x60, 0x12,
+    0x7a, 0x69, 0xba, 0x6b, 0x29, 0x33, 0x1b, 0x37, 0x8b, 0xe7, 0x2c, 0xf0, 0x77, 0x2d, 0xc3, 0x14,
+    0xb4, 0xf6, 0x7e, 0x8c, 0xc6, 0xe9, 0x7c, 0xe7, 0x71, 0x7b, 0x0e, 0xd9, 0x7e, 0x70, 0xa9, 0x6a,
+    0x69, 0xc3, 0x02, 0xab, 0x49, 0xb3, 0x4c, 0x66, 0x81, 0xfd, 0x80, 0x62, 0x37, 0xb5, 0x44, 0x63,
+    0xc1, 0x38, 0xf1, 0x92, 0x1b, 0x51, 0xc4, 0x62, 0x24, 0x44, 0x77, 0xad, 0xe7, 0xd0, 0x45, 0xc8,
+    0x64, 0x1e, 0x36, 0x11, 0xcc, 0x2e, 0xc4, 0x36, 0x3b, 0xed, 0xee, 0x07, 0x33, 0xa0, 0x93, 0x76,
+    0x7a, 0x79, 0xb1, 0x71, 0x3d, 0x0b, 0x5b, 0x3f, 0xf4, 0x0e, 0xe0, 0x91, 0xc1, 0x63, 0x94, 0xee,
+    0xfe, 0xd0, 0xed, 0xe2, 0x4e, 0xfc, 0x76, 0xbb, 0x7d, 0x75, 0x75, 0xe5, 0x5c, 0xf5, 0x9c, 0x38,
+    0xb9, 0x68, 0x77, 0x3b, 0x9d, 0x0e, 0x16, 0x87, 0x4c, 0x26, 0xa0, 0x88, 0xe5, 0xba, 0x7d, 0x7c,
+    0xc7, 0x40, 0x84, 0x9f, 0xe2, 0x6b, 0x4c, 0x20, 0x05, 0xbe, 0xcf, 0x44, 0xba, 0x08, 0x41, 0x50,
+    0xc5, 0x7e, 0xe8, 0x1d, 0x42, 0x37, 0xa0, 0x7d, 0x4d, 0x99, 0x8f, 0x89, 0x2f, 0xa0, 0xec, 0xb4,
+    0xdb, 0xbf, 0xec, 0xf6, 0x8f, 0x3a, 0x67, 0x9d, 0x4f, 0x58, 0x01, 0x55, 0x40, 0xcc, 0x42, 0x0c,
+    0x85, 0x9f, 0xf6, 0x52, 0x15, 0x68, 0xbf, 0x7b, 0x34, 0x9a, 0xd8, 0xae, 0xe3, 0xb2, 0x8e, 0xdd,
+    0x65, 0xce, 0x16, 0xfc, 0xd3, 0xbd, 0x74, 0xbb, 0x93, 0x0e, 0x83, 0x34, 0x67, 0x8b, 0x75, 0xf1,
+    0xcf, 0x14, 0x12, 0xa8, 0x08, 0xeb, 0xda, 0x98, 0x66, 0x77, 0xcf, 0xfa, 0x93, 0x0e, 0xd6, 0xb2,
+    0xb1, 0x06, 0xfe, 0xf9, 0x34, 0x83, 0x1a, 0xfd, 0xa3, 0xd1, 0x59, 0x1f, 0x0a, 0x43, 0x03, 0x9f,
+    0x66, 0xf6, 0xa6, 0x33, 0xb0, 0x5d, 0xa8, 0xd7, 0x1b, 0x61, 0x45, 0x7c, 0x71, 0xdc, 0x2e, 0x3d,
+    0xc0, 0xdf, 0xb3, 0xcd, 0x69, 0xef, 0x6c, 0x30, 0xb5, 0xfb, 0x97, 0x03, 0x67, 0xe0, 0x4e, 0x6c,
+    0xa7, 0x0f, 0x4d, 0xf7, 0xb0, 0xf9, 0x9e, 0x0d, 0x09, 0x50, 0x76, 0x20, 0x7f, 0xb1, 0x3a, 0xd6,
+    0xc0, 0x01, 0x75, 0xe9, 0x01, 0xfe, 0xa6, 0xaa, 0x2d, 0xf5, 0xf7, 0xd3, 0x8b, 0x3e, 0x1b, 0x1e,
+    0x41, 0xcf, 0xfd, 0xf2, 0xd0, 0xfb, 0x97, 0x76, 0xf7, 0xa8, 0x7f, 0x36, 0xfc, 0x94, 0x43, 0x80,
+    0x00, 0xdf, 0x3b, 0xb4, 0x8c, 0xf5, 0xa7, 0x70, 0x0d, 0xc4, 0x37, 0xb1, 0xec, 0x77, 0xa0, 0x08,
+    0xb2, 0xa7, 0xb8, 0x84, 0x20, 0xaf, 0x80, 0x5a, 0x78, 0xc6, 0x28, 0xeb, 0xcf, 0x8e, 0x1f, 0xf7,
+    0xc3, 0x8e, 0x9e, 0x03, 0x4d, 0x0f, 0x1d, 0x77, 0x70, 0x00, 0x00, 0x76, 0xe1, 0xa9, 0xdf, 0x03,
+    0x90, 0x6e, 0x3a, 0xee, 0x26, 0xfc, 0x8c, 0x72, 0x2c, 0x19, 0x69, 0x58, 0x0f, 0x11, 0x4d, 0x0a,
+    0x78, 0x32, 0x12, 0x78, 0x02, 0x88, 0x32, 0x92, 0x98, 0x72, 0x34, 0x72, 0x7a, 0xe1, 0xc8, 0xe9,
+    0x0e, 0xed, 0x9e, 0xd3, 0xeb, 0x3f, 0x77, 0x07, 0xce, 0x68, 0xc4, 0x5c, 0xa6, 0x3b, 0xfb, 0xf4,
+    0x02, 0x9a, 0xef, 0x20, 0x4e, 0x0e, 0x87, 0xb0, 0xf2, 0x3d, 0x44, 0x81, 0x3e, 0xfc, 0xf4, 0x52,
+    0xf1, 0xc0, 0x7a, 0xf8, 0x97, 0xe1, 0x0b, 0xc3, 0x17, 0xf1, 0x80, 0x69, 0x9f, 0x66, 0x6e, 0xcf,
+    0x1e, 0x4d, 0xed, 0x2e, 0xac, 0x38, 0xfe, 0x8b, 0xcb, 0x3e, 0x82, 0x41, 0x5d, 0xf6, 0xbf, 0xe6,
+    0xda, 0x2b, 0x4d, 0x29, 0x2d, 0xad, 0xff, 0xa9, 0x77, 0x09, 0x16, 0xbb, 0xce, 0xfd, 0xab, 0xb0,
+    0x08, 0x77, 0x08, 0x04, 0xd6, 0xc3, 0xe5, 0xd8, 0xec, 0xe3, 0x72, 0x38, 0x7d, 0x58, 0x70, 0xd7,
+    0xee, 0x13, 0xd9, 0x75, 0xb6, 0x0e, 0x5c, 0x50, 0x16, 0x70, 0xf5, 0x46, 0x2e, 0xdb, 0xc2, 0x25,
+    0xec, 0x01, 0x82, 0x40, 0x05, 0xd6, 0x07, 0x8a, 0x66, 0x88, 0x2f, 0x03, 0x7c, 0x00, 0x7c, 0x71,
+    0x06, 0x80, 0x2e, 0x3d, 0x67, 0x73, 0x04, 0xff, 0xe0, 0x4a, 0x8f, 0x86, 0x98, 0x06, 0x64, 0x0d,
+    0xa4, 0x0e, 0x68, 0x00, 0x65, 0x60, 0x25, 0x07, 0xa1, 0xeb, 0xf4, 0x91, 0x53, 0xf4, 0xba, 0x07,
+    0xee, 0xc8, 0x19, 0x82, 0x02, 0xe1, 0xf4, 0x86, 0x0c, 0x06, 0xea, 0x76, 0x9d, 0xee, 0x08, 0x1f,
+    0x46, 0xd8, 0xb3, 0x6c, 0xd6, 0xdd, 0x72, 0x06, 0x23, 0x44, 0x06, 0x1a, 0x24, 0xf0, 0x1c, 0xe8,
+    0x15, 0xab, 0x0c, 0x06, 0xa1, 0xed, 0x10, 0x7b, 0xc2, 0xff, 0x0f, 0x00, 0x65, 0x21, 0xb9, 0x8f,
+    0xc3, 0xeb, 0x63, 0x7f, 0xbd, 0x2d, 0xf8, 0xc5, 0x76, 0x70, 0x1c, 0x03, 0x68, 0x0a, 0xfe, 0xd2,
+    0xb0, 0x07, 0x13, 0x1c, 0x0c, 0xc3, 0x71, 0x76, 0xfa, 0xce, 0xd6, 0x16, 0xfc, 0x0e, 0x00, 0x1b,
+    0x61, 0x08, 0x53, 0x98, 0xf5, 0xe6, 0x81, 0x0b, 0x43, 0x1f, 0x42, 0x79, 0xc8, 0x81, 0xe6, 0xb6,
+    0xe0, 0x51, 0x74, 0x3d, 0x98, 0x74, 0xa9, 0x12, 0x32, 0xa9, 0x01, 0xfd, 0xe2, 0x5f, 0xe4, 0x7a,
+    0x80, 0xf5, 0x3d, 0xec, 0x7d, 0x00, 0xe0, 0x03, 0x8e, 0x08, 0xf5, 0x3a, 0x4e, 0x67, 0xf0, 0x35,
+    0xf1, 0x51, 0x5a, 0xd6, 0x45, 0x64, 0x3c, 0x41, 0x2e, 0x64, 0x8f, 0x13, 0xb0, 0x09, 0x39, 0x86,
+    0xc8, 0xa5, 0x8b, 0x30, 0xfb, 0x86, 0x28, 0x39, 0xbf, 0xbe, 0x27, 0x52, 0x8a, 0x82, 0x0a, 0xe9,
+    0x7e, 0xe8, 0xf6, 0x3a, 0xf4, 0xdf, 0x57, 0x61, 0x57, 0xb8, 0xee, 0xb0, 0x2c, 0x53, 0xdb, 0xd9,
+    0xdc, 0x82, 0xe5, 0xef, 0x8e, 0xe0, 0x2f, 0x2c, 0x19, 0x20, 0x8a, 0x8b, 0xd8, 0x33, 0x00, 0xd8,
+    0x0f, 0x71, 0xf5, 0x81, 0x41, 0xc1, 0xc3, 0x16, 0x16, 0xa6, 0xb5, 0x84, 0x57, 0x58, 0x6e, 0x58,
+    0x6b, 0x4a, 0xeb, 0x9d, 0xf6, 0x44, 0xa2, 0x78, 0x15, 0xf9, 0xaa, 0x38, 0xa0, 0xc7, 0xd0, 0x15,
+    0xe8, 0xb1, 0x65, 0x63, 0x8b, 0x80, 0x53, 0xc8, 0x81, 0x06, 0x9b, 0x21, 0xf4, 0x05, 0x5d, 0x5e,
+    0x62, 0xdf, 0x80, 0x57, 0x80, 0x21, 0xcf, 0xbb, 0x1d, 0xa7, 0x0f, 0x7d, 0xc2, 0x58, 0xf0, 0xd5,
+    0x1e, 0x00, 0x7a, 0x02, 0x43, 0x03, 0x64, 0xec, 0x40, 0x8b, 0x7d, 0x46, 0x98, 0x0f, 0x88, 0x34,
+    0xc0, 0xb6, 0x4f, 0x29, 0x75, 0x20, 0xba, 0xc4, 0x5c, 0x55, 0x8a, 0xfa, 0x75, 0x05, 0xc2, 0x89,
+    0x97, 0x2f, 0x66, 0x66, 0x6d, 0x50, 0x82, 0xa4, 0x2a, 0x84, 0xf8, 0xa2, 0xdc, 0x85, 0x66, 0x25,
+    0xe9, 0x3d, 0x15, 0x0a, 0x95, 0x4c, 0x36, 0xbd, 0x61, 0xd6, 0xde, 0x63, 0xb0, 0x60, 0x72, 0x04,
+    0x04, 0xf3, 0x05, 0x92, 0xbe, 0x1e, 0x2e, 0x15, 0xd9, 0xd6, 0x7d, 0xb9, 0x9d, 0x81, 0x01, 0x2b,
+    0xe0, 0x21, 0x80, 0xf1, 0xc6, 0x0b, 0x68, 0x03, 0x0e, 0xdd, 0xab, 0xca, 0xa3, 0xea, 0x38, 0x0e,
+    0x28, 0x99, 0x30, 0xa7, 0x3d, 0xa1, 0x28, 0x96, 0x80, 0xf4, 0xfc, 0xd9, 0x4f, 0x27, 0xfb, 0x27,
+    0xff, 0xf9, 0x65, 0x30, 0xaa, 0x3d, 0xc6, 0x29, 0x9b, 0x5d, 0xcb, 0xf9, 0x5b, 0xab, 0x67, 0x6f,
+    0xa9, 0xc9, 0x5a, 0xdd, 0xbe, 0xa5, 0x27, 0x6a, 0xe9, 0x69, 0x5a, 0x12, 0x36, 0x98, 0x8d, 0x3d,
+    0x0b, 0x74, 0xb7, 0x0a, 0xd4, 0x61, 0x09, 0xda, 0xb0, 0x90, 0x32, 0x2c, 0xd6, 0x96, 0xc5, 0x6a,
+    0x58, 0xcc, 0xdd, 0x62, 0x23, 0xc0, 0x3f, 0xd6, 0x9f, 0xf6, 0x88, 0xfb, 0xf6, 0x5c, 0xd0, 0xa0,
+    0x86, 0x5b, 0x6c, 0x08, 0xa8, 0x38, 0x04, 0xc4, 0xed, 0xa0, 0xde, 0x07, 0xe8, 0xb5, 0x09, 0xb4,
+    0x82, 0x7a, 0x19, 0xd0, 0xcc, 0x66, 0x08, 0x09, 0xc0, 0xe5, 0xf0, 0x9f, 0x83, 0x11, 0x64, 0x11,
+    0x97, 0xed, 0x23, 0xe3, 0x42, 0xf9, 0x0f, 0x22, 0xbf, 0x8b, 0xf2, 0x99, 0xf8, 0x7b, 0x87, 0x8d,
+    0x80, 0xbd, 0x01, 0x0b, 0x1e, 0x81, 0xdc, 0xed, 0x41, 0x47, 0x76, 0xff, 0xd3, 0x0b, 0xa8, 0x0a,
+    0x9a, 0x01, 0x4a, 0x77, 0x97, 0x61, 0x67, 0xd4, 0x15, 0xb6, 0x87, 0x9d, 0x31, 0xec, 0x0c, 0xfa,
+    0x42, 0xd6, 0x08, 0x5d, 0x61, 0x27, 0xd4, 0x1d, 0xd2, 0x69, 0x87, 0xa4, 0xc6, 0x10, 0xc9, 0x11,
+    0xb8, 0x6e, 0x1f, 0x3b, 0xea, 0x4f, 0x6c, 0xd1, 0x91, 0x8d, 0x62, 0x63, 0x00, 0xdd, 0xb0, 0xd1,
+    0x91, 0x1b, 0x22, 0x1f, 0x87, 0xbe, 0x8e, 0x86, 0x9f, 0xc4, 0x7c, 0x11, 0x92, 0x08, 0xfe, 0x25,
+    0x1c, 0x35, 0x97, 0x5e, 0xea, 0xee, 0xf9, 0xca, 0xd7, 0x2a, 0x97, 0xfe, 0xcd, 0x21, 0x2c, 0xfd,
+    0xd3, 0x67, 0xc7, 0x95, 0x6b, 0x5f, 0x2e, 0xfc, 0xf3, 0xfe, 0xd9, 0xf1, 0xc9, 0xb3, 0xd7, 0x87,
+    0xa7, 0x5f, 0x48, 0x4d, 0xff, 0x5b, 0x48, 0xe7, 0x0e, 0x90, 0x6a, 0x6d, 0xe7, 0x2e, 0xa0, 0x9e,
+    0x1e, 0xee, 0x9f, 0x1c, 0x1c, 0xfd, 0xcb, 0x80, 0xf4, 0x5d, 0x56, 0xfd, 0xf9, 0x64, 0x95, 0x12,
+    0x54, 0xcb, 0x18, 0xf6, 0x6b, 0xca, 0x69, 0x1b, 0x4c, 0xba, 0x75, 0xb3, 0x18, 0xe0, 0x19, 0xf9,
+    0x6c, 0xb6, 0x48, 0x83, 0x09, 0x03, 0x35, 0x28, 0x31, 0x95, 0x1b, 0x07, 0xdd, 0xda, 0x6b, 0x71,
+    0x4f, 0x7a, 0xaf, 0xe8, 0xf8, 0x41, 0x4f, 0xa8, 0x4c, 0xb9, 0xaf, 0x1c, 0x49, 0x7a, 0xda, 0xd3,
+    0x8e, 0x04, 0xc3, 0x6f, 0x6e, 0x49, 0xc9, 0x30, 0xdf, 0x7b, 0xac, 0x1d, 0x4c, 0x58, 0x44, 0x3b,
+    0x56, 0xa8, 0x80, 0x7c, 0x01, 0x64, 0x25, 0x3f, 0x89, 0x59, 0x80, 0x52, 0x2c, 0x0a, 0x64, 0x41,
+    0x8b, 0x31, 0x02, 0x9c, 0x66, 0xb3, 0x20, 0x02, 0xe6, 0xae, 0x9a, 0x56, 0x23, 0x94, 0xee, 0xc4,
+    0x9c, 0xbd, 0xc8, 0x9f, 0xb9, 0xa9, 0xe0, 0xa1, 0xe3, 0x42, 0xf6, 0x22, 0x9a, 0x24, 0x60, 0x19,
+    0x25, 0xe4, 0x46, 0x8c, 0x85, 0x32, 0x6e, 0xc2, 0xa7, 0xe4, 0x71, 0x05, 0xca, 0x13, 0x40, 0xa4,
+    0x93, 0x12, 0x08, 0x37, 0x26, 0x27, 0x9e, 0x1a, 0x6e, 0x10, 0x31, 0x73, 0xed, 0xef, 0x55, 0x63,
+    0x56, 0x3a, 0x25, 0x06, 0xbb, 0x04, 0x93, 0x8f, 0xbb, 0x96, 0xdc, 0xca, 0x7f, 0x25, 0x82, 0x54,
+    0x3a, 0x3b, 0x17, 0x3c, 0x3b, 0x95, 0xad, 0x35, 0x0a, 0x63, 0x70, 0x84, 0xe3, 0x8a, 0x19, 0x15,
+    0x9a, 0x3b, 0xdf, 0xd5, 0xcf, 0xbf, 0x07, 0x49, 0x9b, 0xaa, 0xa7, 0x89, 0xe5, 0xe6, 0x1e, 0x4c,
+    0xee, 0xba, 0x33, 0x37, 0x50, 0xac, 0xe5, 0x83, 0x27, 0x73, 0x53, 0x3e, 0x14, 0x36, 0x1e, 0x4c,
+    0xc7, 0xcb, 0x65, 0x10, 0x2f, 0x80, 0x3a, 0x33, 0x3e, 0x43, 0x91, 0x55, 0x56, 0xc2, 0x04, 0x51,
+    0x8a, 0x42, 0x12, 0xa7, 0x6b, 0xf7, 0x50, 0xcc, 0x72, 0xc5, 0xeb, 0x2e, 0x1d, 0xcd, 0x54, 0xcc,
+    0x40, 0xd9, 0x99, 0xa2, 0x03, 0x0c, 0x74, 0x93, 0x19, 0x1a, 0x81, 0xc3, 0x10, 0x0d, 0xcd, 0xe1,
+    0x99, 0x52, 0x55, 0xee, 0xa9, 0xc1, 0x49, 0x8d, 0x66, 0xed, 0xfc, 0x15, 0xf8, 0xe6, 0xde, 0x22,
+    0xe5, 0x39, 0x38, 0x20, 0xa5, 0x2d, 0x92, 0x56, 0xc1, 0x02, 0x33, 0xff, 0x09, 0x80, 0x70, 0xb7,
+    0xa6, 0xfd, 0xb3, 0xc1, 0xd1, 0xf0, 0x12, 0x90, 0x66, 0x36, 0xb2, 0xdd, 0x3e, 0x3c, 0x60, 0xca,
+    0x14, 0xb4, 0xc4, 0xaf, 0x0e, 0x0c, 0x39, 0xfb, 0x97, 0xb8, 0x2b, 0xb9, 0x0e, 0x11, 0x22, 0x28,
+    0xa0, 0x18, 0xdb, 0xdd, 0x73, 0xaf, 0xfd, 0xee, 0xb9, 0x8f, 0x70, 0xdd, 0xed, 0xe1, 0x73, 0xc0,
+    0x07, 0x74, 0x87, 0xbe, 0x70, 0xc5, 0xc3, 0xb4, 0x7b, 0x36, 0x9c, 0xda, 0xdd, 0x6f, 0x36, 0xff,
+    0x53, 0x10, 0x6d, 0xed, 0x69, 0xe0, 0x83, 0xf4, 0x24, 0x4a, 0x62, 0x28, 0x1e, 0x57, 0xc1, 0x82,
+    0x02, 0xa0, 0xee, 0x8f, 0x07, 0x7f, 0xd8, 0x52, 0x39, 0x5b, 0x6f, 0xab, 0xb8, 0x6c, 0x13, 0x48,
+    0x07, 0x5d, 0x77, 0xe8, 0x4d, 0xee, 0xc3, 0x33, 0x81, 0x6a, 0xe6, 0xda, 0x5b, 0x07, 0x43, 0xa7,
+    0x3f, 0x22, 0x2f, 0xa3, 0x7c, 0x70, 0xbb, 0x69, 0x1f, 0x9f, 0xdc, 0x8e, 0xfe, 0xdf, 0x96, 0x09,
+    0xb6, 0xdb, 0x39, 0x75, 0x37, 0x9d, 0x41, 0x97, 0x8a, 0x31, 0xe1, 0x9a, 0x1e, 0x91, 0x21, 0x81,
+    0xd6, 0x0e, 0x59, 0x2c, 0x5b, 0xf0, 0x33, 0x4a, 0xc5, 0x03, 0x23, 0xab, 0x02, 0xcd, 0x0b, 0x30,
+    0x96, 0x84, 0x41, 0xb3, 0x25, 0xd2, 0x3e, 0x7d, 0x31, 0xf8, 0xcf, 0x68, 0x7b, 0x95, 0xa9, 0x64,
+    0x94, 0x78, 0x86, 0xc4, 0x36, 0x95, 0x80, 0x61, 0xc7, 0xc2, 0x53, 0x55, 0xbb, 0x96, 0xdb, 0xe9,
+    0x88, 0xd5, 0x30, 0xb7, 0x66, 0x01, 0xc0, 0x28, 0x41, 0x49, 0x57, 0xb8, 0x5f, 0xcf, 0x07, 0x32,
+    0xe6, 0x16, 0x15, 0x27, 0xc4, 0x71, 0x65, 0xee, 0x20, 0xbc, 0x31, 0xa2, 0x28, 0x9b, 0xc6, 0x30,
+    0x8e, 0xff, 0x5e, 0xf0, 0x05, 0xc7, 0x48, 0xfb, 0x15, 0x18, 0xe1, 0x07, 0x09, 0x34, 0x32, 0xf5,
+    0x22, 0x1f, 0xb5, 0xa6, 0x6f, 0xce, 0x23, 0xee, 0x6b, 0xc5, 0x02, 0x03, 0x3d, 0xea, 0x5d, 0xe2,
+    0x3e, 0x04, 0xf0, 0x51, 0xc4, 0x0d, 0xf9, 0x76, 0x09, 0xe8, 0xf1, 0x02, 0xdd, 0x7f, 0xd3, 0x11,
+    0x7a, 0xf9, 0x21, 0x11, 0x08, 0x6d, 0x13, 0x08, 0x6d, 0xe4, 0xe0, 0x8a, 0xa3, 0xb9, 0x4b, 0xbe,
+    0xe7, 0xe1, 0x00, 0x7e, 0x81, 0x03, 0x89, 0x7f, 0xa5, 0x63, 0x99, 0x29, 0x7f, 0x72, 0xaa, 0x7c,
+    0xc9, 0x05, 0x7f, 0xf2, 0x19, 0x58, 0xb4, 0x48, 0xab, 0x83, 0x2f, 0xc7, 0x02, 0x3c, 0x8b, 0x90,
+    0xbb, 0x1a, 0x56, 0xc1, 0x9a, 0x8e, 0x62, 0x7c, 0x4b, 0x10, 0x2b, 0xd8, 0x01, 0x78, 0xfa, 0x48,
+    0x56, 0xc0, 0x85, 0x01, 0xfd, 0xa7, 0x9b, 0xf8, 0xbc, 0x29, 0x48, 0x6c, 0x88, 0xcf, 0x43, 0x82,
+    0xe1, 0xa8, 0xb4, 0x71, 0x32, 0x2c, 0x6f, 0xf9, 0x8c, 0x00, 0xbe, 0x6e, 0x07, 0x00, 0x0c, 0xca,
+    0xc3, 0xd4, 0x06, 0x6b, 0xdf, 0xb5, 0xdd, 0xa3, 0xe1, 0x73, 0xd0, 0x18, 0x8e, 0xba, 0xb4, 0x1a,
+    0x26, 0x53, 0x33, 0xd7, 0x72, 0x79, 0xa5, 0xcb, 0xf0, 0x2c, 0x69, 0xec, 0xc5, 0x6d, 0xe7, 0x5c,
+    0x2d, 0x2e, 0x1e, 0x1b, 0x46, 0x58, 0x7d, 0x98, 0xc6, 0x29, 0x1e, 0x8b, 0x51, 0x80, 0xb3, 0xd8,
+    0x06, 0x6b, 0x88, 0xf0, 0x39, 0x47, 0x6d, 0x0a, 0x3a, 0x58, 0x06, 0x4f, 0x9d, 0xb2, 0x27, 0x6c,
+    0x65, 0xd6, 0xb6, 0x3a, 0x85, 0xdc, 0xdc, 0x91, 0xcd, 0x5f, 0xa5, 0xba, 0xf1, 0xab, 0xf4, 0xeb,
+    0x34, 0x0d, 0x2d, 0x58, 0xed, 0xab, 0xd4, 0x52, 0x5d, 0x90, 0xbd, 0x4b, 0x41, 0x2b, 0xbb, 0xac,
+    0xfe, 0xad, 0x9d, 0x47, 0xf7, 0xe2, 0xc8, 0x6d, 0xa3, 0x18, 0x2a, 0xaa, 0x83, 0x9c, 0x21, 0x03,
+    0xe6, 0x28, 0x86, 0x4c, 0xfa, 0x24, 0xb2, 0xe4, 0xcd, 0x65, 0x96, 0xbc, 0x89, 0xcc, 0x78, 0x8b,
+    0x34, 0xc6, 0xce, 0x81, 0x64, 0xc3, 0xf4, 0xbf, 0x7e, 0x76, 0xbb, 0x39, 0x7b, 0x26, 0xd5, 0x12,
+    0x89, 0x96, 0x7c, 0x4a, 0xda, 0xd7, 0x63, 0x0b, 0x5f, 0x8f, 0x60, 0xd1, 0x23, 0x93, 0x45, 0x8f,
+    0x14, 0x8b, 0x1e, 0x29, 0x16, 0xdd, 0xde, 0x13, 0xa8, 0x54, 0x57, 0x50, 0x15, 0x47, 0xfb, 0xa4,
+    0x69, 0x83, 0x80, 0xfd, 0x13, 0x39, 0x5b, 0x84, 0xa9, 0x80, 0xaa, 0x51, 0x89, 0xda, 0x46, 0x65,
+    0x6a, 0xdb, 0x3c, 0x12, 0x7a, 0xc3, 0x88, 0x6d, 0x01, 0x73, 0x73, 0x3b, 0x47, 0xa3, 0xb3, 0xad,
+    0x4f, 0x33, 0xdc, 0x53, 0x1d, 0x10, 0xe5, 0x4d, 0xe9, 0x97, 0xb9, 0x47, 0x03, 0xa4, 0xbd, 0xfe,
+    0x99, 0xa9, 0x97, 0xe7, 0x14, 0x98, 0x1b, 0x2c, 0xab, 0x76, 0x80, 0xd6, 0xa8, 0xf2, 0xcc, 0x0c,
+    0xbc, 0x01, 0x38, 0x6b, 0x08, 0x1b, 0x0a, 0xa4, 0xc6, 0xdc, 0xaf, 0xcb, 0xc0, 0xee, 0xad, 0x46,
+    0xb6, 0xf7, 0xee, 0x21, 0x4d, 0x96, 0x50, 0x04, 0x59, 0xf3, 0x97, 0x8f, 0xff, 0x8f, 0x12, 0xdb,
+    0x6a, 0x52, 0x1b, 0xb1, 0x01, 0x4c, 0x2a, 0x04, 0x51, 0xb5, 0x59, 0x40, 0x68, 0x3c, 0xf4, 0x24,
+    0xe5, 0xf8, 0xaf, 0x27, 0xcf, 0x91, 0x15, 0x59, 0x22, 0x51, 0x1a, 0xd6, 0xd4, 0x00, 0xcc, 0xa0,
+    0x5d, 0x2f, 0x24, 0x3f, 0xc3, 0x28, 0xe0, 0x5d, 0x66, 0xbb, 0x22, 0x55, 0x44, 0x3e, 0xbf, 0x8a,
+    0xf1, 0x94, 0xe1, 0xdb, 0xf7, 0x3b, 0xac, 0xdd, 0xf6, 0x92, 0xc4, 0xbb, 0x41, 0xc7, 0xca, 0x47,
+    0xce, 0xe7, 0x2c, 0x4b, 0xbc, 0xc9, 0x47, 0xbc, 0x38, 0x21, 0xe2, 0x29, 0x46, 0xe7, 0x8b, 0x60,
+    0xad, 0x94, 0xea, 0x2a, 0x21, 0x76, 0xca, 0x41, 0x75, 0x88, 0x26, 0xdc, 0x6c, 0xf6, 0x26, 0x9a,
+    0xbc, 0xe2, 0x91, 0x2f, 0xcf, 0xb6, 0x78, 0x61, 0xca, 0xa1, 0xed, 0x47, 0xcc, 0xd3, 0x95, 0xb0,
+    0x04, 0xbb, 0xf2, 0x52, 0x96, 0x62, 0xf8, 0xa8, 0x8d, 0xf8, 0x94, 0xc1, 0x9b, 0x97, 0x70, 0xe6,
+    0x27, 0xf1, 0x7c, 0x0e, 0x7d, 0x2d, 0xa2, 0x2c, 0x08, 0x49, 0x69, 0xd1, 0xb1, 0xce, 0x30, 0xb8,
+    0xe0, 0x92, 0x53, 0x6c, 0x33, 0x1d, 0x0d, 0x57, 0x3e, 0xc6, 0x33, 0x71, 0xa0, 0xc0, 0x1c, 0x41,
+    0xe4, 0xcd, 0xd3, 0x69, 0x9c, 0x1d, 0xce, 0xe3, 0xc9, 0x94, 0x3c, 0x12, 0x94, 0x2c, 0x94, 0x98,
+    0x23, 0xa9, 0xc4, 0xe0, 0x71, 0xed, 0x64, 0x21, 0x0e, 0x28, 0xbc, 0x26, 0xaf, 0x52, 0x82, 0xa9,
+    0x78, 0xa8, 0x29, 0x2d, 0x76, 0x8c, 0x21, 0x5f, 0x74, 0x20, 0x01, 0x53, 0x29, 0xb2, 0x18, 0x4f,
+    0xa5, 0x0b, 0xbe, 0x9e, 0x22, 0x7c, 0xd4, 0xd6, 0xc9, 0x87, 0x37, 0xcf, 0x5e, 0x3e, 0x3d, 0x7e,
+    0xe3, 0xd4, 0x8e, 0xa3, 0xf0, 0x86, 0x4a, 0xa3, 0x2f, 0x0a, 0x0b, 0x23, 0x5a, 0xd0, 0xfc, 0xe0,
+    0x99, 0xda, 0xc6, 0x58, 0x68, 0x46, 0xd1, 0x5f, 0x09, 0x4c, 0x7c, 0x0c, 0x03, 0xa2, 0x1e, 0xc6,
+    0x3c, 0x8c, 0xaf, 0x24, 0xf4, 0x71, 0x4c, 0xb4, 0x42, 0x18, 0xce, 0x43, 0x71, 0x53, 0x4e, 0x6d,
+    0x9f, 0xa2, 0xc2, 0xaf, 0xa6, 0x78, 0xc6, 0x48, 0x0c, 0x00, 0x66, 0xe5, 0xb3, 0x28, 0x56, 0xe0,
+    0x61, 0x37, 0x1c, 0x06, 0x8c, 0x7e, 0x2c, 0x56, 0x77, 0x1c, 0xa7, 0x4e, 0xad, 0x06, 0x59, 0xaa,
+    0x4a, 0x07, 0x29, 0xf0, 0x41, 0x58, 0x32, 0x5c, 0x50, 0x07, 0x41, 0x29, 0x10, 0xbf, 0x34, 0x03,
+    0x3c, 0x56, 0xd5, 0x91, 0x50, 0xd3, 0x2b, 0x8d, 0x50, 0xd0, 0xb0, 0x54, 0xa9, 0xcf, 0x08, 0x1c,
+    0x12, 0x7f, 0x1e, 0xb1, 0xb7, 0x28, 0xd9, 0x5a, 0xa4, 0xd6, 0xbe, 0x87, 0x85, 0x85, 0x09, 0x26,
+    0x29, 0x57, 0x2b, 0xa6, 0x3b, 0x7e, 0x23, 0x41, 0x87, 0xa7, 0xfd, 0x4b, 0x9d, 0xa8, 0x4b, 0x13,
+    0xe8, 0x68, 0xbd, 0xa8, 0x15, 0x5f, 0x1d, 0x11, 0x81, 0x41, 0x6a, 0x4f, 0xf6, 0x0e, 0xc8, 0x0c,
+    0x98, 0xf8, 0x7f, 0x50, 0x69, 0xf5, 0x35, 0x8e, 0xd5, 0xf4, 0xb1, 0x27, 0x73, 0x70, 0x0d, 0x0a,
+    0x5c, 0x6e, 0xd1, 0xba, 0x61, 0x74, 0x32, 0x56, 0xc7, 0xe1, 0x49, 0xf1, 0x8a, 0x84, 0x93, 0x5e,
+    0x51, 0x94, 0x7d, 0x83, 0x82, 0xe4, 0x9f, 0x50, 0xc9, 0xb7, 0x2e, 0xde, 0x23, 0x60, 0x59, 0x58,
+    0x63, 0xe2, 0xc1, 0x14, 0xac, 0x9f, 0x9f, 0x3d, 0x3f, 0xb4, 0xb6, 0x6b, 0x46, 0xd5, 0xfa, 0xf7,
+    0x50, 0x9f, 0xbf, 0x4e, 0xa8, 0x8f, 0x70, 0x51, 0x01, 0xbb, 0x1c, 0x83, 0x75, 0xfc, 0x71, 0x47,
+    0x2d, 0xfa, 0xf1, 0xaf, 0x2f, 0x9f, 0xfe, 0x73, 0x56, 0xfd, 0xbb, 0xaf, 0xf2, 0xcf, 0xe4, 0xab,
+    0x5c, 0x42, 0x84, 0xfd, 0xb3, 0xe3, 0xbf, 0x22, 0xf5, 0x7f, 0x8f, 0xe2, 0xf9, 0xe7, 0x46, 0xf1,
+    0x54, 0x63, 0xd7, 0xab, 0x93, 0xc3, 0xd3, 0xc3, 0xd7, 0xff, 0x9b, 0xf0, 0xeb, 0x7b, 0xa0, 0xe0,
+    0xca, 0x25, 0xf5, 0xf9, 0xb9, 0xb7, 0x08, 0xb3, 0x6d, 0xf5, 0x7e, 0xab, 0xdc, 0x12, 0xb0, 0x06,
+    0xa1, 0xd4, 0x63, 0x48, 0x27, 0xc1, 0xd3, 0xec, 0xa6, 0x62, 0xfe, 0x84, 0xd5, 0x19, 0x85, 0x37,
+    0xef, 0x5a, 0xcb, 0x67, 0x1a, 0x75, 0x78, 0xbe, 0x55, 0x07, 0xc5, 0xa4, 0x0e, 0xdd, 0xc9, 0x33,
+    0xea, 0x75, 0xd3, 0xe9, 0x44, 0x0e, 0x6e, 0x86, 0xf8, 0x22, 0xce, 0x6b, 0xed, 0x42, 0xe9, 0x0d,
+    0xd9, 0xdb, 0x06, 0xab, 0xd3, 0x5b, 0x3e, 0x0e, 0x48, 0xd9, 0xc3, 0x94, 0x82, 0x61, 0xbc, 0x91,
+    0x6b, 0x47, 0x1b, 0x68, 0x02, 0x2d, 0xed, 0xc2, 0x62, 0x8d, 0x82, 0xaa, 0xd4, 0x41, 0x55, 0x89,
+    0x94, 0xcd, 0x26, 0x55, 0xc9, 0xc3, 0x67, 0xea, 0x38, 0x7b, 0xad, 0x95, 0xa1, 0x56, 0x7a, 0x38,
+    0x9b, 0x67, 0x37, 0xaf, 0xa4, 0x7a, 0x46, 0xa7, 0xc5, 0xfe, 0xd1, 0xa8, 0xeb, 0x93, 0x8a, 0xf5,
+    0xa6, 0x83, 0xe7, 0x98, 0x1b, 0xf5, 0x55, 0x5b, 0xff, 0xd8, 0x77, 0xee, 0x1c, 0xa9, 0x1e, 0xdf,
+    0xcb, 0x38, 0xd7, 0xd1, 0x95, 0x22, 0x68, 0x8e, 0xa9, 0x59, 0x1c, 0x54, 0x16, 0x27, 0xfc, 0x95,
+    0xa9, 0xcc, 0x36, 0xce, 0x83, 0x24, 0xcd, 0x5a, 0x6c, 0x12, 0xcf, 0x66, 0xa0, 0x3c, 0xb7, 0x18,
+    0xed, 0x80, 0xe2, 0x50, 0xf5, 0xad, 0x54, 0x78, 0xd9, 0x00, 0xa5, 0xee, 0xc0, 0xe3, 0x63, 0x55,
+    0xd2, 0x09, 0x79, 0x74, 0x01, 0xb8, 0x6f, 0x33, 0x17, 0xd3, 0x37, 0x76, 0x59, 0xb7, 0x59, 0x2b,
+    0xe8, 0xc9, 0x6f, 0xa9, 0x69, 0x82, 0x1f, 0x2a, 0xc7, 0xa2, 0xdd, 0x36, 0xeb, 0xe2, 0xbd, 0x56,
+    0x6f, 0x65, 0x2b, 0x6f, 0x83, 0xf7, 0xba, 0xef, 0xb7, 0xd0, 0x0a, 0x73, 0xdf, 0xbf, 0x2f, 0x8c,
+    0x58, 0x6a, 0xd1, 0x6a, 0xcc, 0x42, 0x97, 0x16, 0x5a, 0x2e, 0x69, 0xab, 0x84, 0x6c, 0xa2, 0x23,
+    0x85, 0x68, 0xb6, 0xfc, 0xfd, 0xa1, 0xac, 0xe7, 0xef, 0xd4, 0xf0, 0xa2, 0x88, 0xb2, 0x5e, 0x2e,
+    0x86, 0xf9, 0x1e, 0x6f, 0x8b, 0x78, 0x50, 0x54, 0xcc, 0xd5, 0x8d, 0x12, 0x88, 0x7d, 0xd5, 0x75,
+    0x94, 0x51, 0x55, 0xac, 0x27, 0xae, 0x8a, 0xb0, 0x54, 0xa2, 0xb0, 0x45, 0xde, 0x45, 0xe8, 0x3a,
+    0x53, 0x20, 0xb1, 0xc4, 0x6b, 0xd9, 0x10, 0x11, 0x19, 0xcd, 0x12, 0x04, 0x50, 0xfb, 0x2f, 0x60,
+    0x11, 0x4e, 0x03, 0x30, 0xc9, 0xc1, 0x9d, 0x7f, 0x40, 0x0f, 0x40, 0x24, 0xb1, 0x18, 0xf9, 0x80,
+    0xb1, 0xc4, 0x03, 0xd3, 0x96, 0xd1, 0xb7, 0x63, 0x54, 0xe0, 0xa5, 0xf2, 0x07, 0x90, 0xf9, 0x67,
+    0x5c, 0xde, 0x75, 0xc1, 0x33, 0x79, 0x73, 0xd7, 0x4f, 0x37, 0xcf, 0xfc, 0x46, 0x3d, 0x47, 0x5c,
+    0x55, 0x43, 0x58, 0x6c, 0xaf, 0x63, 0xbc, 0xb5, 0x90, 0xe2, 0xc9, 0x74, 0xc2, 0x4e, 0x69, 0x69,
+    0xe8, 0x86, 0x97, 0x99, 0x77, 0xdd, 0xe8, 0xb4, 0xc4, 0xf3, 0x79, 0x18, 0xc7, 0x49, 0x23, 0x6f,
+    0xa0, 0x9d, 0x9b, 0x3e, 0x4d, 0x44, 0xaa, 0x4e, 0x3e, 0x2c, 0xcf, 0x68, 0x21, 0x88, 0x1a, 0xe6,
+    0xb4, 0x5a, 0x1a, 0xa2, 0x94, 0x3d, 0xe1, 0x41, 0xd8, 0xa0, 0x81, 0x4c, 0xc2, 0x00, 0xc6, 0x2d,
+    0x4d, 0xa9, 0x42, 0xdb, 0x1b, 0xc0, 0x2e, 0x9b, 0xda, 0xd8, 0x42, 0xb3, 0x0c, 0xf9, 0x4b, 0x01,
+    0xdb, 0xa9, 0x4d, 0x81, 0xed, 0xd8, 0x39, 0x3c, 0x6d, 0x6c, 0x28, 0xb8, 0x3f, 0x28, 0xe2, 0x78,
+    0xf0, 0xbe, 0xb9, 0x0a, 0x47, 0xa1, 0x13, 0xea, 0x00, 0x48, 0xa3, 0x68, 0xa2, 0xb5, 0xd8, 0x52,
+    0x1b, 0xb8, 0xe2, 0x34, 0xee, 0x20, 0x8a, 0x78, 0x42, 0x37, 0x17, 0xa0, 0x50, 0x44, 0x57, 0xb0,
+    0x64, 0x92, 0xf2, 0x90, 0x49, 0x5d, 0x23, 0xd1, 0x23, 0xc3, 0x56, 0x04, 0xde, 0x30, 0xbf, 0x56,
+    0x1e, 0x62, 0x62, 0x72, 0xd4, 0x71, 0x6d, 0x55, 0x0b, 0x05, 0x18, 0x02, 0xb4, 0x71, 0x96, 0xcd,
+    0x35, 0x2d, 0xee, 0xd4, 0x8a, 0xab, 0x8b, 0x1c, 0xa1, 0xbc, 0xd2, 0x88, 0x58, 0x28, 0xca, 0x4d,
+    0x16, 0xa7, 0x0e, 0x63, 0x23, 0xc6, 0x20, 0xf0, 0xa8, 0x8c, 0xe2, 0x1c, 0x7b, 0x20, 0xc6, 0x7e,
+    0xfc, 0x51, 0xd4, 0x03, 0x0b, 0xd4, 0x89, 0xcf, 0xcf, 0xf1, 0x5a, 0x1f, 0x68, 0xdd, 0x96, 0x89,
+    0x1d, 0x33, 0xf1, 0xc1, 0xae, 0xb9, 0x8a, 0x9f, 0x6b, 0xa6, 0xa5, 0x7c, 0xcf, 0x36, 0x90, 0x90,
+    0x8b, 0xc4, 0x24, 0xce, 0xe5, 0xe6, 0x37, 0x13, 0xce, 0xe7, 0xa1, 0x26, 0x8c, 0xa7, 0xe8, 0xa7,
+    0x69, 0x48, 0xe6, 0x84, 0x3d, 0x82, 0xc5, 0x3f, 0x8d, 0x43, 0x9e, 0xb2, 0xc5, 0x5c, 0xdd, 0xc1,
+    0x49, 0xce, 0x92, 0x34, 0x66, 0x1e, 0x18, 0xff, 0x61, 0x30, 0xe1, 0x78, 0xcd, 0xa7, 0x9f, 0x32,
+    0x4f, 0xec, 0x40, 0x91, 0x1b, 0x43, 0x72, 0xa3, 0x47, 0x6d, 0x82, 0x40, 0x61, 0xe5, 0x15, 0x24,
+    0x1e, 0xb3, 0x22, 0xa9, 0x56, 0x16, 0xda, 0x2d, 0x14, 0xca, 0xed, 0x78, 0xc5, 0x3d, 0xbb, 0xef,
+    0x73, 0xf3, 0x3d, 0x88, 0x80, 0x33, 0x64, 0xa0, 0x62, 0x11, 0x46, 0x0b, 0xf1, 0xcb, 0xc8, 0x3b,
+    0xf1, 0x0c, 0x6f, 0x03, 0x92, 0x35, 0x7a, 0xef, 0x25, 0x1d, 0x4c, 0x40, 0xf6, 0x66, 0x55, 0x25,
+    0xfa, 0xaa, 0x44, 0x20, 0x1d, 0x1f, 0x78, 0x8d, 0xdb, 0x3e, 0xba, 0xcd, 0x1a, 0x54, 0xa7, 0x59,
+    0x22, 0x9c, 0xc1, 0xdd, 0x22, 0x82, 0x5a, 0x7a, 0x4b, 0x22, 0x61, 0x70, 0x4f, 0x71, 0x50, 0xf6,
+    0xbe, 0x14, 0xc1, 0x93, 0x22, 0xdc, 0x91, 0xad, 0x08, 0xa1, 0xe0, 0x00, 0x36, 0x4e, 0xbc, 0x8c,
+    0x64, 0x76, 0xda, 0xaa, 0x2c, 0x2b, 0x0a, 0x36, 0x0d, 0xb6, 0x8d, 0xab, 0x08, 0xc3, 0xa3, 0x39,
+    0x95, 0xb4, 0x55, 0xa1, 0x2e, 0x00, 0x28, 0x4b, 0x2d, 0xd1, 0x72, 0x37, 0xaa, 0x60, 0xda, 0x62,
+    0x6e, 0xa9, 0x6d, 0xdb, 0x2e, 0x35, 0x2a, 0x9b, 0x54, 0x90, 0x5d, 0x9e, 0xd3, 0xfa, 0xd6, 0x01,
+    0xa9, 0x77, 0xee, 0x39, 0x9e, 0x3e, 0xd6, 0xe8, 0x48, 0x87, 0x50, 0x69, 0x14, 0xb4, 0xf5, 0x56,
+    0x9e, 0x99, 0xf0, 0x6e, 0xd5, 0x96, 0xfd, 0x60, 0x2b, 0x15, 0x3e, 0x20, 0x0b, 0xe5, 0x1d, 0x04,
+    0x25, 0xe4, 0x5c, 0x68, 0x5b, 0xe8, 0xda, 0x13, 0x17, 0x21, 0x91, 0x03, 0x50, 0x05, 0xa7, 0xa4,
+    0xca, 0x81, 0x0a, 0xe4, 0xb0, 0xc2, 0x41, 0x56, 0x45, 0xa2, 0x9a, 0x40, 0x17, 0x73, 0x50, 0xf7,
+    0xf8, 0x73, 0xb9, 0xbb, 0xf4, 0x93, 0x97, 0x68, 0xad, 0xca, 0x38, 0xfc, 0xa6, 0x14, 0x2b, 0xeb,
+    0xb9, 0xdc, 0xfc, 0x45, 0x25, 0x7d, 0x9b, 0xa1, 0xc0, 0x35, 0x3c, 0xc6, 0x95, 0x0d, 0x8b, 0x0a,
+    0x3f, 0x93, 0xeb, 0xb7, 0x21, 0x3c, 0xc0, 0x2d, 0x06, 0x3f, 0xea, 0x31, 0xe1, 0xa4, 0x42, 0x09,
+    0xe6, 0x47, 0x5d, 0xa3, 0x94, 0x6c, 0xe4, 0x9b, 0x70, 0xb8, 0xb7, 0x25, 0x7d, 0xd5, 0x4f, 0xce,
+    0x65, 0xf0, 0x19, 0xaa, 0x71, 0x11, 0x5e, 0xe3, 0xf6, 0xeb, 0xc9, 0xb3, 0x83, 0x78, 0x36, 0x07,
+    0x03, 0x02, 0x56, 0x48, 0xe4, 0x36, 0x9b, 0x35, 0xc7, 0x87, 0x04, 0xe3, 0x1a, 0x33, 0xba, 0xea,
+    0x4b, 0xce, 0x4a, 0x46, 0x60, 0xab, 0x19, 0x51, 0x56, 0xce, 0x86, 0x1b, 0x9d, 0xa6, 0xd2, 0x69,
+    0x0a, 0xc3, 0x2a, 0xd6, 0xcc, 0x8b, 0x6b, 0x17, 0xb8, 0x33, 0x87, 0x37, 0xa4, 0x80, 0x62, 0xc9,
+    0x49, 0x9a, 0x36, 0x3e, 0x33, 0x4b, 0x9e, 0x42, 0xb4, 0xb6, 0x81, 0x41, 0xdf, 0x42, 0xa1, 0x0a,
+    0xa0, 0x03, 0xec, 0x9a, 0x78, 0x7e, 0x1f, 0xc4, 0x6d, 0xe1, 0xfa, 0xa5, 0xaa, 0x41, 0xdf, 0x5f,
+    0xbf, 0x3d, 0x3c, 0x39, 0x39, 0x3e, 0xd9, 0x66, 0x07, 0xf1, 0x22, 0x14, 0x5e, 0x5e, 0xba, 0x84,
+    0x8a, 0xf4, 0x78, 0x01, 0x2d, 0x52, 0xeb, 0x95, 0x5e, 0x5b, 0xf4, 0xfe, 0xeb, 0x45, 0xba, 0xe7,
+    0xa4, 0x6e, 0x8b, 0xeb, 0x0f, 0xab, 0x28, 0x8e, 0xae, 0xa5, 0x8d, 0x55, 0xcb, 0xaa, 0x43, 0x06,
+    0x57, 0x2f, 0x19, 0xb9, 0xe3, 0x65, 0x31, 0xd4, 0xa4, 0x20, 0x99, 0x28, 0x33, 0x6b, 0xd4, 0xdf,
+    0x45, 0x75, 0x09, 0x6f, 0x15, 0x5a, 0xad, 0xe1, 0x83, 0x19, 0xaa, 0x96, 0x03, 0xfc, 0xf4, 0xd0,
+    0x9b, 0x4c, 0x8d, 0xc6, 0x95, 0x2f, 0x17, 0x17, 0x5a, 0x3c, 0x97, 0x5a, 0xc1, 0x43, 0xa9, 0xa0,
+    0x70, 0x1a, 0x70, 0xce, 0xef, 0x5a, 0xf8, 0x66, 0x01, 0xc4, 0xdf, 0x2d, 0xeb, 0x6f, 0x62, 0x59,
+    0xff, 0x05, 0x56, 0xcb, 0xdc, 0xc6, 0xbb, 0x63, 0x6b, 0x55, 0xdf, 0x80, 0x50, 0x19, 0x63, 0x4f,
+    0xd6, 0x3c, 0x8a, 0xc7, 0x92, 0x9d, 0x2d, 0xb8, 0xcf, 0x1a, 0x06, 0xb4, 0x44, 0x61, 0x7f, 0xc4,
+    0xc2, 0xae, 0x66, 0x4a, 0x92, 0x5e, 0x59, 0x95, 0xbd, 0x4d, 0x9c, 0x05, 0x59, 0x81, 0x0c, 0xdd,
+    0xc0, 0x1b, 0x5b, 0x13, 0x63, 0xc3, 0x06, 0xb8, 0xcc, 0xb1, 0xc8, 0xc1, 0x3b, 0x2c, 0x8f, 0x17,
+    0xc2, 0xa8, 0x2b, 0xdc, 0x49, 0x6a, 0xd6, 0x6c, 0x8a, 0x0b, 0x15, 0xd4, 0xeb, 0xba, 0xab, 0x69,
+    0x71, 0xf2, 0xb2, 0xac, 0xe4, 0x7c, 0x75, 0x79, 0x4f, 0x40, 0xbd, 0xc5, 0xea, 0x63, 0x90, 0x91,
+    0x1f, 0x61, 0x84, 0x78, 0x47, 0x1e, 0xf9, 0xd1, 0xf3, 0x81, 0x46, 0x28, 0x97, 0x70, 0x9b, 0xbb,
+    0x7c, 0x9f, 0x1e, 0xc1, 0xb3, 0x18, 0x89, 0x52, 0xd1, 0x32, 0xe2, 0x42, 0x81, 0x9d, 0xdd, 0xee,
+    0x14, 0x3d, 0x21, 0x2f, 0xe4, 0x25, 0xc8, 0xb2, 0xa5, 0xdc, 0x74, 0x57, 0x97, 0xf8, 0xc9, 0x0c,
+    0x71, 0x27, 0x46, 0xfa, 0x26, 0xc8, 0xa6, 0x0d, 0x29, 0x0e, 0xea, 0x4d, 0xf6, 0x84, 0xcc, 0x6c,
+    0xb6, 0xad, 0xb6, 0xbe, 0x56, 0x8f, 0x29, 0x77, 0x25, 0xc1, 0xb0, 0x44, 0xdb, 0x4f, 0x58, 0x7d,
+    0x92, 0x04, 0xb3, 0x34, 0x8e, 0xc8, 0x97, 0x44, 0x77, 0x03, 0x28, 0x56, 0xbc, 0xd4, 0x08, 0xcd,
+    0x40, 0x0d, 0x72, 0x15, 0x00, 0x61, 0x90, 0x28, 0x3e, 0x45, 0xb6, 0x94, 0x2b, 0x98, 0xed, 0xd6,
+    0x01, 0x25, 0x3d, 0xbc, 0x2b, 0x3f, 0xe3, 0x8d, 0x5a, 0x41, 0xe6, 0x58, 0x1d, 0xbc, 0xfc, 0xb1,
+    0xf6, 0xb9, 0x46, 0xa1, 0x67, 0x72, 0x22, 0xad, 0x9a, 0xbf, 0x50, 0xf7, 0xb9, 0xa9, 0xb1, 0xba,
+    0xb8, 0x2e, 0x0c, 0xaf, 0xc7, 0xea, 0x74, 0x5a, 0x00, 0x23, 0xb1, 0x2a, 0xdb, 0xc6, 0x0a, 0xc1,
+    0x92, 0x35, 0x0b, 0xf0, 0x95, 0x37, 0x3d, 0xee, 0x83, 0x8c, 0xf7, 0xc6, 0x6b, 0xc4, 0x17, 0x85,
+    0x0d, 0x2d, 0x92, 0x70, 0x8d, 0xfc, 0x2a, 0xec, 0xb2, 0x1b, 0xd2, 0x8b, 0xbc, 0x12, 0x68, 0x4a,
+    0x65, 0x00, 0x49, 0x94, 0xfe, 0x86, 0x26, 0xb1, 0x48, 0xa7, 0x8d, 0x55, 0x0a, 0x47, 0x33, 0xd7,
+    0x1e, 0x0a, 0x9a, 0x95, 0x21, 0xba, 0x01, 0x6e, 0x00, 0x3b, 0x5c, 0xdf, 0x6a, 0xa5, 0x42, 0x0d,
+    0x4d, 0x5d, 0xdd, 0x19, 0xc6, 0x17, 0x78, 0x59, 0xae, 0x22, 0xc6, 0x0b, 0x4e, 0x5e, 0x08, 0xbc,
+    0xed, 0x1f, 0x2f, 0x3f, 0xb7, 0x15, 0x22, 0x09, 0x75, 0x4f, 0xdc, 0x9a, 0x4a, 0xcd, 0x7a, 0xe1,
+    0x95, 0x77, 0x93, 0x96, 0x98, 0x45, 0x05, 0x25, 0xee, 0xd4, 0x4c, 0x55, 0x40, 0x70, 0x9a, 0x02,
+    0xe9, 0xfe, 0x0a, 0xa6, 0xd5, 0xfe, 0x05, 0x6a, 0x70, 0x42, 0xeb, 0x6d, 0xb1, 0x85, 0x4a, 0x51,
+    0x52, 0x3a, 0xf2, 0x2e, 0x83, 0x0b, 0x0f, 0x34, 0x32, 0xe7, 0xc3, 0x07, 0x71, 0x9b, 0xe7, 0x2f,
+    0x1c, 0x4f, 0x04, 0x7c, 0xf8, 0x80, 0x25, 0x56, 0xe7, 0x36, 0xea, 0xba, 0xa9, 0x7a, 0xe9, 0xf6,
+    0x7c, 0xe5, 0x00, 0xd5, 0x05, 0x24, 0x9f, 0x11, 0xd7, 0x0d, 0x63, 0xa7, 0xc7, 0xe3, 0xdf, 0xf8,
+    0x24, 0x73, 0x44, 0x8b, 0xaf, 0x12, 0xe0, 0x52, 0x49, 0x76, 0x83, 0x35, 0x2b, 0x33, 0xf2, 0x31,
+    0xc2, 0x02, 0x98, 0xbd, 0x7e, 0xc6, 0xf9, 0x6f, 0xdf, 0xdd, 0xb9, 0x64, 0x73, 0xd8, 0xb3, 0x8c,
+    0xf9, 0xca, 0xe7, 0xa5, 0xcb, 0x81, 0xd1, 0xbe, 0x5b, 0x04, 0x0f, 0x72, 0x1b, 0x9d, 0x80, 0x83,
+    0x41, 0xad, 0xff, 0xde, 0x5d, 0xe2, 0x2d, 0x7d, 0x37, 0x2b, 0xa7, 0x54, 0x1e, 0x47, 0x69, 0x66,
+    0x85, 0x6e, 0x09, 0x76, 0x13, 0x8f, 0x2c, 0x68, 0x62, 0x47, 0xe5, 0xca, 0x30, 0x2e, 0xd9, 0x8b,
+    0xb8, 0xc3, 0xde, 0x04, 0xd8, 0xe7, 0x9a, 0x6e, 0x6b, 0xbb, 0xd8, 0xac, 0x84, 0xca, 0xad, 0x30,
+    0x8b, 0x52, 0xce, 0x99, 0xfa, 0xfc, 0x84, 0xcf, 0x5d, 0x50, 0xd4, 0x02, 0x67, 0xf9, 0xd8, 0x4e,
+    0x9b, 0x8e, 0xa5, 0x40, 0x1e, 0x45, 0x29, 0xa3, 0x65, 0xd4, 0x7e, 0x54, 0x7b, 0x2d, 0x43, 0x32,
+    0x80, 0xdf, 0xfb, 0x31, 0x4f, 0xcd, 0x93, 0x40, 0xb1, 0x08, 0xaa, 0x38, 0xf7, 0xc0, 0x76, 0x4a,
+    0xb3, 0xe2, 0x39, 0x20, 0x36, 0x0b, 0x88, 0x91, 0x60, 0x1c, 0xc4, 0x04, 0xd4, 0x48, 0x59, 0x53,
+    0x1e, 0x7d, 0x76, 0x6a, 0x87, 0x80, 0xed, 0x37, 0xf2, 0x95, 0xe1, 0xb5, 0x4a, 0x2c, 0x48, 0x61,
+    0x0a, 0x8b, 0xc0, 0x67, 0x8f, 0x33, 0x6f, 0xbc, 0x47, 0x44, 0x24, 0x9e, 0x28, 0x6a, 0x4f, 0x3c,
+    0xa2, 0xed, 0x32, 0x91, 0xcf, 0xe3, 0x20, 0x4b, 0xf0, 0x4a, 0x6b, 0xf1, 0x86, 0x5f, 0x35, 0x59,
+    0xe0, 0x37, 0x46, 0x70, 0xbc, 0x58, 0x37, 0x48, 0x99, 0x17, 0xd2, 0xcd, 0xd7, 0x18, 0x7a, 0x1d,
+    0x50, 0x74, 0x0b, 0x0e, 0xc6, 0xc7, 0x1b, 0xc3, 0x00, 0xde, 0xbc, 0x10, 0xf8, 0xe2, 0xb0, 0x7d,
+    0xe1, 0xde, 0xa3, 0xa1, 0xd4, 0x67, 0x60, 0xc3, 0xd4, 0x81, 0x82, 0xbd, 0x88, 0x86, 0x8d, 0x01,
+    0x24, 0x50, 0x5c, 0x04, 0xf2, 0x62, 0x0c, 0x89, 0x53, 0xd3, 0x21, 0x1c, 0x64, 0xde, 0xbf, 0x02,
+    0x3b, 0x51, 0x9c, 0xc2, 0x51, 0xa1, 0x12, 0xf8, 0x75, 0x11, 0xf1, 0x11, 0x84, 0x7a, 0x31, 0x18,
+    0x48, 0x9f, 0xd6, 0x11, 0x3a, 0x3a, 0x41, 0x92, 0x3e, 0x00, 0xa2, 0xfc, 0x7f, 0xda, 0x05, 0xe4,
+    0xfb, 0xf2, 0x34, 0x4f, 0x03, 0x07, 0x95, 0x4b, 0x2a, 0x69, 0xa8, 0x63, 0xa2, 0xd6, 0xe9, 0x33,
+    0xe5, 0xd8, 0xc2, 0xcc, 0xdc, 0x9b, 0x33, 0xcc, 0x1d, 0xb1, 0xa2, 0x2e, 0x45, 0xc4, 0x62, 0x4f,
+    0x07, 0xc7, 0x4f, 0x0f, 0x0f, 0x40, 0x0a, 0x49, 0xcd, 0x06, 0x0c, 0x7a, 0xb6, 0x51, 0xa3, 0xda,
+    0x60, 0xa9, 0x03, 0xfb, 0x47, 0x3b, 0xe1, 0xa7, 0x67, 0xaf, 0x4f, 0xf6, 0x5f, 0x1f, 0x1a, 0xa5,
+    0x20, 0x0b, 0x74, 0x93, 0x8f, 0xe3, 0x79, 0x5a, 0x6f, 0xd2, 0x7e, 0x48, 0x53, 0xd7, 0x1a, 0xa8,
+    0x5a, 0xcf, 0xf7, 0x5f, 0xfe, 0xf2, 0xeb, 0xfe, 0x2f, 0x66, 0xb5, 0xc1, 0x7b, 0x59, 0x3a, 0x77,
+    0xf0, 0x46, 0x1f, 0x85, 0x87, 0x2e, 0x57, 0x88, 0xf4, 0x75, 0x6b, 0xdf, 0x8f, 0x1a, 0xfe, 0x3d,
+    0xce, 0x25, 0xfd, 0x6d, 0x0d, 0x0c, 0x52, 0xcf, 0x41, 0x11, 0xc8, 0xb2, 0xa4, 0xf1, 0x99, 0xd5,
+    0x69, 0xdf, 0x10, 0x99, 0x5c, 0x7d, 0x5b, 0x90, 0x4b, 0xf7, 0x7d, 0x4b, 0xa6, 0x02, 0x07, 0x51,
+    0x89, 0xae, 0x4e, 0x94, 0x1a, 0xbf, 0x8d, 0xcc, 0x52, 0xe5, 0x76, 0x30, 0x97, 0x88, 0x1b, 0x52,
+    0x04, 0x91, 0xdf, 0x1a, 0x1c, 0x01, 0x3d, 0xd2, 0xa6, 0x42, 0x4b, 0xb2, 0xa0, 0xde, 0x6c, 0xd6,
+    0x90, 0xde, 0x72, 0xb3, 0xfd, 0xaf, 0x4c, 0x76, 0x18, 0xf1, 0x5c, 0x0a, 0xa5, 0x4a, 0x75, 0x0c,
+    0x95, 0x0e, 0xc0, 0x62, 0x2a, 0x7a, 0xe9, 0xd3, 0x6c, 0x68, 0x6f, 0x4d, 0x6d, 0xf7, 0x6c, 0x38,
+    0xc1, 0x18, 0xa8, 0xcd, 0x21, 0xfc, 0xd3, 0xed, 0xdb, 0x03, 0xfc, 0x73, 0xba, 0x29, 0x6c, 0xf3,
+    0x4d, 0x86, 0x11, 0x0c, 0x5b, 0x64, 0xcf, 0x6f, 0xba, 0x68, 0x7f, 0x53, 0x5c, 0x02, 0x64, 0xba,
+    0xf4, 0x4b, 0xa9, 0x48, 0x86, 0x22, 0x8f, 0xc9, 0x3c, 0xb0, 0xc2, 0x87, 0xcb, 0x81, 0x5f, 0x9d,
+    0x3b, 0x03, 0xbf, 0xb0, 0xc8, 0x72, 0xe4, 0x17, 0x34, 0x06, 0x39, 0x14, 0xfa, 0x75, 0x67, 0x00,
+    0x71, 0x14, 0xa7, 0xe8, 0x78, 0x36, 0x2e, 0x26, 0x39, 0xc0, 0x93, 0xa4, 0x8c, 0x24, 0x5c, 0x16,
+    0x0b, 0x24, 0x15, 0xdf, 0xeb, 0x22, 0x11, 0x0a, 0x5a, 0x4f, 0x94, 0x72, 0x10, 0x5c, 0x9c, 0x35,
+    0xce, 0x69, 0x67, 0x66, 0x86, 0xdf, 0xae, 0x7a, 0x17, 0x35, 0xae, 0xa6, 0x01, 0x28, 0x00, 0x33,
+    0xf2, 0xb0, 0xa2, 0x9e, 0xdc, 0xb4, 0xc8, 0xe2, 0x34, 0xd1, 0x09, 0x99, 0x7b, 0xc5, 0x2d, 0x15,
+    0xc2, 0x44, 0x05, 0xe5, 0x1c, 0xdf, 0x1b, 0x12, 0xdf, 0x85, 0x07, 0x50, 0x9c, 0x4a, 0xd7, 0x6e,
+    0x24, 0x6c, 0xac, 0xb9, 0xa3, 0x14, 0x18, 0x18, 0x35, 0xee, 0x67, 0x5c, 0xc4, 0x52, 0xe0, 0xd3,
+    0x77, 0xcd, 0xc4, 0xa3, 0x32, 0x81, 0x65, 0x06, 0x61, 0xbf, 0x8d, 0x3b, 0x04, 0x5c, 0xef, 0xfb,
+    0x81, 0xb8, 0x36, 0x3d, 0x6c, 0x47, 0xe2, 0x84, 0xef, 0x0a, 0x13, 0xa5, 0xde, 0x96, 0x27, 0x80,
+    0xeb, 0xab, 0x0d, 0x14, 0x2d, 0xc7, 0x78, 0x95, 0x7f, 0x0d, 0x2f, 0x1d, 0x05, 0x45, 0x9a, 0x04,
+    0x37, 0xdb, 0xdd, 0x13, 0xb2, 0x3a, 0x88, 0x26, 0xe1, 0xc2, 0xe7, 0xa9, 0x10, 0xd7, 0xd2, 0xf0,
+    0xd3, 0x3d, 0x19, 0x36, 0x2b, 0xb5, 0x2a, 0xb7, 0x08, 0xdc, 0x66, 0x85, 0x23, 0xee, 0x77, 0xeb,
+    0x03, 0xfd, 0xb2, 0x3e, 0x30, 0x0b, 0xa2, 0x45, 0x46, 0x53, 0xa0, 0x6d, 0x4b, 0x32, 0x58, 0x73,
+    0xdf, 0xbd, 0x64, 0x2d, 0xb8, 0x3b, 0x32, 0xec, 0x2c, 0x0d, 0xd8, 0x58, 0xe7, 0xb9, 0x64, 0x6a,
+    0xc6, 0xa2, 0xf6, 0x48, 0x55, 0x80, 0x75, 0xd0, 0x5a, 0x00, 0x2c, 0xb3, 0xe0, 0x79, 0x92, 0x51,
+    0xb5, 0x74, 0xef, 0x58, 0x50, 0x3d, 0xc3, 0x0a, 0x13, 0x70, 0xaa, 0x5d, 0xa3, 0xfa, 0x7c, 0x33,
+    0xa9, 0x4c, 0x2d, 0x52, 0xc6, 0xf4, 0x86, 0x28, 0xa5, 0xe5, 0x33, 0x2c, 0xea, 0x56, 0xf4, 0xbb,
+    0x53, 0x13, 0x38, 0x56, 0xda, 0xdd, 0xfc, 0x7e, 0xe3, 0xc1, 0xdf, 0x58, 0x0d, 0x59, 0xe6, 0x51,
+    0xe2, 0x8c, 0x7e, 0x10, 0x5d, 0x14, 0x6f, 0xa5, 0xa9, 0x2b, 0x94, 0x52, 0xa7, 0xea, 0xfd, 0x20,
+    0xc5, 0x2b, 0x95, 0x7d, 0x1d, 0x7d, 0x51, 0xcc, 0x36, 0xce, 0xfd, 0x23, 0x96, 0xe5, 0xad, 0xb2,
+    0x57, 0x21, 0xc7, 0x7d, 0xaf, 0x2b, 0x2f, 0xc0, 0x8b, 0x6f, 0xa0, 0xdd, 0x2a, 0x1e, 0x24, 0x1a,
+    0x7b, 0x42, 0xdf, 0xe7, 0xab, 0x57, 0xef, 0xdc, 0x48, 0x84, 0x87, 0xd2, 0x3f, 0x22, 0x21, 0x50,
+    0x31, 0xa2, 0x88, 0x4a, 0xb6, 0x45, 0x21, 0x35, 0xd9, 0x22, 0x6d, 0xb1, 0xeb, 0x69, 0xd2, 0xa4,
+    0x9b, 0x2a, 0x95, 0x8d, 0x02, 0x09, 0x38, 0x82, 0x13, 0x9e, 0x42, 0xcb, 0x29, 0x3f, 0x02, 0xb3,
+    0x09, 0xb8, 0x57, 0xfd, 0x3f, 0x6c, 0x71, 0x71, 0xd5, 0x4f, 0xc2, 0xa6, 0xb3, 0x5f, 0x04, 0x22,
+    0xca, 0x03, 0x43, 0x54, 0x64, 0xe5, 0x9d, 0xaf, 0xc2, 0x09, 0xab, 0xa8, 0xb2, 0x2e, 0x18, 0x98,
+    0x60, 0x86, 0x2a, 0xac, 0x44, 0x50, 0xba, 0x79, 0x8f, 0xc1, 0x72, 0xdd, 0x8d, 0x95, 0x24, 0xcd,
+    0xf2, 0x7b, 0x73, 0x8b, 0xc7, 0xd0, 0xe7, 0xdf, 0xe9, 0xfd, 0x6f, 0x4c, 0xef, 0xfa, 0xc6, 0x82,
+    0x77, 0x75, 0xa4, 0x20, 0x53, 0x6e, 0x00, 0x69, 0xbd, 0xab, 0x2b, 0xaf, 0x45, 0x91, 0x17, 0x08,
+    0xc4, 0x54, 0xc2, 0x39, 0xb7, 0xd6, 0xa5, 0xe0, 0x25, 0x42, 0xc0, 0x43, 0x2d, 0x42, 0xe3, 0x46,
+    0x8f, 0x02, 0xd2, 0x43, 0x73, 0x59, 0xcf, 0xf9, 0x47, 0xe3, 0xbe, 0xe8, 0x8a, 0xfe, 0x87, 0xef,
+    0xa8, 0xfa, 0x77, 0x46, 0xd5, 0xc2, 0x0e, 0x4f, 0xcd, 0x01, 0x79, 0x12, 0xfa, 0xc0, 0x0a, 0x1b,
+    0x75, 0xd2, 0xbc, 0x94, 0x02, 0x56, 0x7f, 0x01, 0xd8, 0x76, 0x17, 0x36, 0x43, 0x61, 0xc4, 0xbe,
+    0xa6, 0x76, 0xde, 0x1a, 0x98, 0x49, 0xba, 0xe8, 0x3f, 0xfe, 0xd8, 0x76, 0xd5, 0x3d, 0x87, 0x6a,
+    0x5c, 0x88, 0x23, 0x06, 0x6c, 0x0e, 0x75, 0xea, 0xa5, 0xf8, 0xa5, 0x8d, 0x8a, 0x11, 0x2f, 0xfb,
+    0xe7, 0xa5, 0x50, 0xfb, 0x57, 0x4c, 0x02, 0xc5, 0xa7, 0xbc, 0x73, 0x7e, 0x77, 0x97, 0x0d, 0x3a,
+    0x5d, 0x0c, 0x27, 0xc3, 0xc4, 0x44, 0x0a, 0xd4, 0xd7, 0xe8, 0x38, 0x7c, 0xb2, 0x9c, 0xb4, 0xcd,
+    0xf4, 0xfc, 0x61, 0x32, 0xdc, 0x2f, 0xcd, 0x70, 0xc5, 0x56, 0xc1, 0x9d, 0x4a, 0x46, 0xc5, 0xf5,
+    0x42, 0xeb, 0x94, 0x17, 0xb9, 0x99, 0x85, 0xda, 0xb6, 0x79, 0x7b, 0xa5, 0x43, 0xd7, 0x0c, 0x35,
+    0xf2, 0x5d, 0xbf, 0x3c, 0xa1, 0xe2, 0x76, 0x21, 0x29, 0xb2, 0x6f, 0x61, 0x01, 0x54, 0xdc, 0x66,
+    0x53, 0x7c, 0x79, 0xb0, 0x34, 0x7e, 0xa1, 0x2f, 0xe0, 0xbd, 0xd7, 0x2b, 0x4f, 0x5a, 0x23, 0xaf,
+    0x33, 0x2e, 0xc1, 0xb7, 0xfe, 0xb5, 0xa7, 0x41, 0xf1, 0x98, 0x43, 0x47, 0x9e, 0xa9, 0xbf, 0x14,
+    0x67, 0xaf, 0xfb, 0xf2, 0x15, 0xaf, 0x3f, 0xe8, 0xb3, 0xd1, 0xa5, 0xdd, 0xc7, 0xdd, 0xf5, 0x3e,
+    0x1e, 0xaa, 0xea, 0x4e, 0xfb, 0x97, 0x78, 0x57, 0x06, 0x24, 0xf5, 0x69, 0xd7, 0xbd, 0xff, 0xe9,
+    0x45, 0x57, 0x5f, 0x89, 0x00, 0xd5, 0x96, 0x4e, 0x94, 0x5e, 0xa9, 0x78, 0xb6, 0xca, 0xaf, 0xc0,
+    0x35, 0xe4, 0xc1, 0xf7, 0x96, 0xfc, 0x2c, 0xa4, 0xfe, 0x64, 0xb0, 0xd8, 0xb9, 0xab, 0xfa, 0x44,
+    0x70, 0x6f, 0xd0, 0xe9, 0x90, 0xfb, 0x67, 0xe9, 0x78, 0xdf, 0x55, 0xba, 0x53, 0xbb, 0x4a, 0x57,
+    0x7c, 0xdb, 0x2c, 0x37, 0xa4, 0xb8, 0x23, 0xd4, 0xb8, 0xdc, 0x63, 0x64, 0xa9, 0xb3, 0x9d, 0xb8,
+    0xff, 0xa6, 0x43, 0x78, 0xf1, 0x62, 0x8a, 0x90, 0xab, 0x2d, 0x55, 0x2e, 0xbf, 0x0d, 0x58, 0xa3,
+    0x43, 0xa7, 0xaa, 0x82, 0xf0, 0x9c, 0x4f, 0x49, 0xa3, 0xc4, 0xe0, 0x99, 0x90, 0xbe, 0xa4, 0x33,
+    0xbe, 0x61, 0x71, 0xe2, 0x07, 0x11, 0x06, 0x45, 0xc9, 0xb1, 0x60, 0x4c, 0x16, 0x58, 0x9e, 0x9e,
+    0xfc, 0x20, 0x15, 0xce, 0x2b, 0xf1, 0x55, 0x5a, 0x9c, 0xe8, 0x03, 0xa8, 0xa9, 0xf8, 0x5e, 0x29,
+    0x02, 0x4d, 0x8d, 0x53, 0x6e, 0x0d, 0x5e, 0xbb, 0xf8, 0x11, 0xc2, 0x5a, 0xf9, 0x18, 0xaa, 0x36,
+    0x67, 0x55, 0x4d, 0xdc, 0x3f, 0x34, 0xb7, 0x13, 0xdd, 0xf7, 0xe5, 0xf0, 0x41, 0x57, 0x84, 0x0f,
+    0xaa, 0x0a, 0x52, 0xfd, 0x94, 0xe1, 0xb7, 0xc5, 0x59, 0xeb, 0x46, 0x29, 0x78, 0xb6, 0x18, 0x0c,
+    0x2d, 0x42, 0xf6, 0x90, 0x60, 0x2a, 0x62, 0xc9, 0x0c, 0x57, 0x7f, 0xb1, 0x45, 0x33, 0x86, 0x47,
+    0x46, 0xcf, 0x55, 0x6c, 0x82, 0x2e, 0xc7, 0x5d, 0x76, 0x8c, 0xb8, 0x4b, 0xa5, 0x21, 0x3f, 0xa7,
+    0xa3, 0x09, 0xdb, 0x64, 0xb9, 0xeb, 0x9b, 0xd2, 0x5a, 0xac, 0x78, 0x9d, 0x3c, 0x3a, 0x1f, 0x02,
+    0x9f, 0xc6, 0x59, 0x3c, 0xb1, 0xbc, 0x14, 0xc4, 0x47, 0x90, 0x42, 0x14, 0xb1, 0xdd, 0xd2, 0x31,
+    0x0a, 0x11, 0x0b, 0x64, 0xde, 0x1e, 0x05, 0xbd, 0x18, 0x17, 0xbb, 0xe9, 0x50, 0xb8, 0x97, 0x71,
+    0x86, 0x46, 0x10, 0xed, 0x29, 0x89, 0x6f, 0x8c, 0x56, 0x00, 0xa7, 0x10, 0x1d, 0xa8, 0x2f, 0xee,
+    0xd8, 0xae, 0x55, 0x9d, 0x71, 0xae, 0x55, 0x9c, 0x89, 0xae, 0x1e, 0x78, 0x29, 0x94, 0x70, 0xa9,
+    0x50, 0xd7, 0x2c, 0x64, 0xc6, 0x20, 0xae, 0x08, 0x10, 0xac, 0x38, 0xc4, 0xd0, 0x31, 0x0e, 0x30,
+    0xf4, 0xee, 0x33, 0x35, 0xb1, 0xdb, 0x27, 0x43, 0x30, 0xc5, 0xcb, 0x9d, 0xf3, 0x10, 0xf7, 0x00,
+    0x2c, 0x9d, 0xeb, 0x7d, 0x5b, 0x35, 0xa1, 0xf7, 0x3b, 0xc6, 0xce, 0xa8, 0x6e, 0xf9, 0xf1, 0xd2,
+    0x41, 0x72, 0x19, 0x56, 0x3c, 0x03, 0x32, 0x65, 0x63, 0x7e, 0x8e, 0xfa, 0x83, 0x27, 0x0e, 0x88,
+    0x0b, 0x7f, 0x20, 0xaa, 0x9d, 0x7a, 0x43, 0x0d, 0xa3, 0x93, 0x03, 0x20, 0x53, 0x5b, 0x9e, 0x09,
+    0x60, 0x5e, 0xfa, 0x31, 0x2d, 0x7d, 0x2e, 0xcb, 0x38, 0x7f, 0x7d, 0xe1, 0xc1, 0x23, 0xc5, 0x59,
+    0xae, 0x00, 0xc6, 0x6d, 0xd5, 0x18, 0xf7, 0x56, 0x8d, 0x31, 0x1f, 0xcf, 0x2c, 0x48, 0x53, 0xdc,
+    0xd6, 0x93, 0x03, 0xb5, 0x69, 0x13, 0x9e, 0x86, 0x80, 0xe1, 0xd1, 0xf9, 0x49, 0x72, 0x19, 0xf2,
+    0xfc, 0xc0, 0x40, 0x9f, 0x26, 0xf0, 0xc2, 0xd2, 0xf1, 0x08, 0xcc, 0x95, 0x94, 0x55, 0x40, 0x33,
+    0x61, 0xdb, 0xeb, 0xa1, 0x56, 0xac, 0x7a, 0x15, 0xe0, 0xbf, 0x14, 0x11, 0x68, 0x0a, 0x80, 0x07,
+    0x14, 0x9b, 0x5d, 0xb1, 0xec, 0x18, 0x76, 0xbe, 0x84, 0xe9, 0x1b, 0xcc, 0xd5, 0x4c, 0xfb, 0x8f,
+    0x4c, 0x4e, 0xb9, 0xcc, 0x6e, 0xef, 0x4f, 0x4c, 0x6b, 0x22, 0xd4, 0xcb, 0x31, 0xc6, 0x52, 0xe1,
+    0x02, 0xf2, 0x35, 0x02, 0x70, 0x0a, 0x8d, 0x15, 0xca, 0x8b, 0x8b, 0x97, 0x24, 0x28, 0x4c, 0x08,
+    0x20, 0x87, 0x31, 0x6f, 0x65, 0x02, 0x9e, 0x02, 0xf2, 0x6e, 0x4d, 0x4b, 0xc5, 0xeb, 0x93, 0xa0,
+    0xc5, 0xa5, 0xab, 0x08, 0xf2, 0xba, 0xc8, 0xcf, 0x2c, 0xd7, 0x12, 0x4e, 0xce, 0xaa, 0x7b, 0x97,
+    0x64, 0x64, 0x8f, 0x8e, 0xa5, 0x69, 0x95, 0x2f, 0x36, 0x78, 0xc2, 0x5c, 0x46, 0x5f, 0xec, 0x2b,
+    0x0f, 0xc3, 0xbc, 0xdf, 0x52, 0xb2, 0xe2, 0x3b, 0xf9, 0xe4, 0x12, 0xc7, 0xcd, 0x51, 0x8b, 0x46,
+    0x2a, 0x8e, 0x48, 0xa3, 0x23, 0xa6, 0x9c, 0x81, 0x47, 0x66, 0x05, 0xac, 0x8a, 0xcd, 0xce, 0x13,
+    0x2e, 0xb7, 0x79, 0x48, 0xcd, 0x2d, 0x6c, 0x00, 0xa0, 0xef, 0xdf, 0xbb, 0xe4, 0xb9, 0xeb, 0x1f,
+    0x2f, 0xf9, 0xcc, 0xaf, 0xce, 0x47, 0x4d, 0x59, 0x29, 0x6c, 0x79, 0x08, 0x5c, 0x7d, 0x69, 0x9e,
+    0xc6, 0x6d, 0x9d, 0x62, 0x9e, 0x46, 0xca, 0x9d, 0x13, 0xc3, 0x15, 0x36, 0xe2, 0xc9, 0x72, 0x2f,
+    0x7d, 0x0b, 0x63, 0x90, 0x9a, 0x74, 0xcf, 0x01, 0xd2, 0xb6, 0xfa, 0xd8, 0x0f, 0x8e, 0x94, 0x22,
+    0x7a, 0x7c, 0x79, 0xbc, 0xc1, 0x3b, 0x07, 0x05, 0x88, 0x8a, 0x8c, 0x93, 0xd8, 0xf3, 0x27, 0x9e,
+    0xa0, 0xfc, 0x22, 0x9d, 0x49, 0xb9, 0x77, 0x0f, 0x91, 0x88, 0xd0, 0x6b, 0x48, 0xa7, 0xb7, 0x2e,
+    0x57, 0x97, 0x2e, 0x6c, 0x8b, 0x74, 0x5e, 0xab, 0xc5, 0x0a, 0xd3, 0xa9, 0x2e, 0x3a, 0xf3, 0xae,
+    0x8d, 0x82, 0xdd, 0x72, 0x41, 0xd5, 0xdf, 0xca, 0xc2, 0x25, 0x18, 0xd3, 0xcd, 0x8c, 0x65, 0xe2,
+    0xa0, 0xa5, 0xa7, 0x7b, 0x60, 0x7c, 0x2b, 0x17, 0xc5, 0x94, 0x90, 0xc7, 0x1e, 0xa2, 0xcf, 0x60,
+    0xf9, 0xf6, 0x41, 0x7d, 0xf7, 0x8a, 0xf5, 0x97, 0xde, 0x8d, 0x7d, 0xdc, 0x86, 0xe9, 0xef, 0xd5,
+    0x97, 0x90, 0x4e, 0x40, 0x4e, 0x29, 0x23, 0x5f, 0x06, 0x3a, 0xe3, 0xe2, 0xc6, 0x3f, 0xdf, 0x8d,
+    0x46, 0xab, 0x6f, 0xe9, 0xa9, 0x84, 0xde, 0xfd, 0xc0, 0xad, 0xa0, 0xb9, 0x97, 0x83, 0x53, 0xa2,
+    0x67, 0xfb, 0x91, 0xc4, 0x50, 0x19, 0x97, 0x43, 0x28, 0x6a, 0x12, 0x37, 0x42, 0x56, 0xe6, 0x69,
+    0x65, 0xf0, 0x27, 0xf1, 0xbe, 0xcd, 0xac, 0x8d, 0xbc, 0xe4, 0x86, 0x85, 0x01, 0x26, 0x56, 0x35,
+    0x77, 0xa1, 0xfb, 0x13, 0x4d, 0xe6, 0x82, 0x09, 0x95, 0xbc, 0x45, 0x56, 0xc6, 0x40, 0x1d, 0xaa,
+    0x9f, 0xf3, 0xb3, 0xed, 0x5a, 0xc5, 0x25, 0x36, 0xd5, 0x52, 0x4e, 0xe8, 0xe0, 0xe2, 0x5b, 0xa6,
+    0x42, 0x17, 0x24, 0x3b, 0x01, 0x6d, 0x84, 0xee, 0x9a, 0x23, 0x46, 0x60, 0x26, 0xd4, 0x64, 0x35,
+    0x11, 0x97, 0x68, 0xc6, 0xb9, 0x18, 0xdf, 0x1a, 0xb4, 0xaa, 0x0e, 0x02, 0xd7, 0xbf, 0x87, 0x5e,
+    0x17, 0x43, 0xaf, 0xf3, 0x33, 0x59, 0x15, 0x01, 0xd8, 0x0a, 0xcc, 0x69, 0x9c, 0x64, 0x8a, 0x5d,
+    0xeb, 0x6b, 0xe0, 0x73, 0xc4, 0xa0, 0x42, 0x0a, 0x2b, 0xf4, 0xd9, 0x21, 0xa6, 0xb5, 0xba, 0x5b,
+    0x61, 0x17, 0x57, 0x7d, 0x6c, 0xbc, 0x10, 0xf1, 0x59, 0x7f, 0xa3, 0x3e, 0xa2, 0xce, 0xa4, 0xdd,
+    0x8d, 0x5e, 0x9b, 0x9d, 0x55, 0xd2, 0x4e, 0x1c, 0xa9, 0x58, 0x71, 0x33, 0x13, 0x85, 0xd2, 0x29,
+    0x33, 0xb9, 0xe2, 0x02, 0xa4, 0xab, 0x29, 0x0c, 0x26, 0x80, 0x8e, 0xa6, 0x78, 0x51, 0xa5, 0x8f,
+    0xc2, 0x4c, 0xeb, 0x75, 0x53, 0x0e, 0x96, 0xb4, 0x38, 0xbb, 0x5b, 0xb4, 0x77, 0xf5, 0x91, 0xde,
+    0x0a, 0x65, 0x51, 0xe6, 0x2c, 0x61, 0xbf, 0x71, 0xda, 0x97, 0xa0, 0x50, 0xf9, 0x31, 0xf5, 0x95,
+    0x60, 0xc0, 0xc2, 0xbe, 0x62, 0xac, 0xf5, 0xcb, 0x20, 0x0d, 0xc6, 0x00, 0x00, 0xe0, 0xab, 0xc6,
+    0x09, 0x5e, 0x4a, 0x0d, 0xc0, 0x78, 0xbd, 0x41, 0x2f, 0xb9, 0xd2, 0xe4, 0xf5, 0x85, 0x4b, 0xc6,
+    0x87, 0x75, 0x0b, 0x40, 0x11, 0x22, 0x3d, 0x31, 0xfc, 0x22, 0x2c, 0xc6, 0x3b, 0x9e, 0x30, 0x2a,
+    0x16, 0xc1, 0x15, 0x54, 0x02, 0x69, 0x95, 0x11, 0x5e, 0x3a, 0xf3, 0xae, 0x9d, 0x79, 0xb9, 0xf9,
+    0x5b, 0x2a, 0x91, 0xab, 0x4c, 0xd5, 0xfe, 0x79, 0xd9, 0xc9, 0xbd, 0x0f, 0xc8, 0xbf, 0x39, 0x55,
+    0x48, 0x83, 0x37, 0x12, 0x16, 0xfc, 0x3d, 0xa5, 0xad, 0xc6, 0xa6, 0xf0, 0xd3, 0xcc, 0x71, 0x74,
+    0x06, 0x7a, 0x56, 0x7e, 0x69, 0x1e, 0xb3, 0x64, 0xe8, 0xb5, 0x28, 0x8c, 0xf3, 0x57, 0x1f, 0xa5,
+    0x81, 0x59, 0xc4, 0x51, 0xa3, 0x4e, 0x9e, 0xbb, 0xa5, 0x50, 0xde, 0x52, 0x41, 0x52, 0x6f, 0xcb,
+    0x77, 0x20, 0x80, 0x36, 0x62, 0x59, 0x04, 0x1a, 0x54, 0x0e, 0xd7, 0x14, 0x52, 0xdf, 0x5b, 0xb6,
+    0x9a, 0xda, 0x33, 0xa1, 0xea, 0x88, 0x5d, 0xff, 0x00, 0x90, 0x44, 0x7b, 0x28, 0xea, 0x85, 0xcf,
+    0xba, 0xd5, 0xb7, 0x0b, 0xc7, 0x25, 0x40, 0x1b, 0xd3, 0x24, 0x0c, 0xcf, 0xc2, 0xa1, 0x5b, 0x2f,
+    0x2e, 0x93, 0x11, 0xe5, 0x2d, 0x15, 0x35, 0x53, 0x5a, 0xd4, 0x8d, 0x4f, 0x82, 0xc9, 0xc6, 0x65,
+    0x85, 0xfb, 0xb4, 0x6d, 0x1c, 0xdb, 0xa8, 0x6c, 0xbc, 0xf4, 0xcd, 0xa9, 0xa5, 0x0e, 0x8c, 0x79,
+    0x54, 0xb6, 0x6f, 0xf2, 0xa7, 0xca, 0x0e, 0x4c, 0x37, 0xec, 0xba, 0xd6, 0x0b, 0x8c, 0xce, 0xe8,
+    0x40, 0xf7, 0x5a, 0x6a, 0x5d, 0x9f, 0x99, 0x14, 0x51, 0xd3, 0x50, 0x14, 0x3f, 0xe4, 0x57, 0xc2,
+    0x91, 0xba, 0xfc, 0xa8, 0x6e, 0x15, 0xba, 0xac, 0x3b, 0xce, 0xd6, 0x71, 0x06, 0xe4, 0x75, 0x14,
+    0x0e, 0xde, 0x38, 0xf4, 0xe5, 0x81, 0x38, 0x23, 0xc6, 0x7e, 0xc7, 0xdc, 0xbe, 0xc5, 0x04, 0x63,
+    0x2b, 0xb8, 0x8d, 0xd8, 0x51, 0x3c, 0x4a, 0x67, 0x16, 0x94, 0x7b, 0xca, 0x6d, 0x9c, 0x94, 0x3a,
+    0x68, 0x6b, 0xbb, 0x4d, 0xe7, 0xb7, 0x38, 0x88, 0x28, 0x59, 0xde, 0x35, 0x60, 0x1e, 0xac, 0xac,
+    0xba, 0x97, 0xef, 0xce, 0x53, 0x00, 0x72, 0xe0, 0xc6, 0x51, 0x80, 0x95, 0x80, 0x32, 0x3e, 0x37,
+    0xfc, 0xcd, 0x80, 0x05, 0x83, 0x46, 0xd3, 0x7f, 0xe5, 0xb4, 0x36, 0xe4, 0xbc, 0x4a, 0x69, 0x8a,
+    0xf4, 0x68, 0x7f, 0xe2, 0x2b, 0x9f, 0x93, 0x90, 0xa3, 0xbd, 0x0b, 0x36, 0xf2, 0xbb, 0xcb, 0x05,
+    0xc8, 0x70, 0xc9, 0xaf, 0x84, 0x10, 0xc3, 0x22, 0x59, 0xac, 0x98, 0xbf, 0x10, 0x4e, 0xf9, 0xc9,
+    0x0f, 0x27, 0x5d, 0x8c, 0x31, 0x74, 0x3b, 0xba, 0xc0, 0xb5, 0x36, 0xd2, 0x31, 0x50, 0xfb, 0x19,
+    0x1e, 0x9d, 0x3e, 0x3e, 0x97, 0x68, 0xb3, 0x51, 0x04, 0x09, 0x42, 0x04, 0xfe, 0x2d, 0xc2, 0x00,
+    0x86, 0xca, 0xe9, 0xc0, 0x0c, 0x86, 0xc7, 0x7b, 0x17, 0x22, 0xb2, 0xfa, 0x9e, 0x73, 0x60, 0xf9,
+    0x27, 0x72, 0xd7, 0x4c, 0xe7, 0xc3, 0xd7, 0x99, 0x4f, 0xeb, 0xce, 0x09, 0x81, 0xae, 0x8a, 0xe1,
+    0x1f, 0x7f, 0x64, 0x66, 0xf9, 0xc1, 0xcc, 0x7b, 0xce, 0x6d, 0x2e, 0x4e, 0xa2, 0x08, 0x77, 0x82,
+    0x98, 0xda, 0xd2, 0x70, 0xe8, 0x3c, 0xfb, 0xef, 0x84, 0xb4, 0xa1, 0x15, 0xaf, 0xc3, 0x18, 0x59,
+    0xac, 0x0c, 0xe5, 0xaf, 0xb0, 0xd4, 0xc6, 0x00, 0xee, 0xbb, 0xdc, 0x77, 0x0c, 0xe6, 0x2b, 0x2c,
+    0x53, 0x71, 0x54, 0xe6, 0x05, 0xb0, 0xcb, 0x03, 0xab, 0x6c, 0x5c, 0xf0, 0xc4, 0x38, 0x3a, 0x0f,
+    0x92, 0x59, 0xc3, 0xda, 0x4f, 0x38, 0xbb, 0x89, 0x17, 0x2c, 0x5d, 0x88, 0x80, 0x4f, 0xe9, 0x49,
+    0x26, 0xb7, 0x8f, 0xea, 0xea, 0x49, 0xbe, 0xc1, 0xb3, 0x93, 0x4f, 0x56, 0x94, 0x54, 0x65, 0xc4,
+    0x3c, 0x1b, 0xab, 0x26, 0x7a, 0xc7, 0xa4, 0xf4, 0x07, 0xa8, 0x5b, 0xcc, 0xe0, 0xa0, 0x6b, 0x81,
+    0x4e, 0x37, 0xaf, 0xca, 0x73, 0xdf, 0x14, 0xeb, 0xf8, 0xc5, 0x44, 0x55, 0xc8, 0x13, 0xd1, 0x44,
+    0xea, 0xf2, 0x15, 0xe1, 0x47, 0x5f, 0x66, 0xc0, 0x74, 0x5a, 0x6d, 0xcd, 0x82, 0x96, 0xcd, 0x43,
+    0x0d, 0x8f, 0xa9, 0x97, 0x1e, 0xa0, 0xea, 0xd7, 0xa8, 0xe7, 0x53, 0x6a, 0xe2, 0xe9, 0xc1, 0x2a,
+    0x16, 0x01, 0xc6, 0xef, 0x52, 0xe2, 0xce, 0x1f, 0x38, 0xce, 0x5f, 0x90, 0x14, 0x6a, 0x06, 0x15,
+    0xe5, 0x56, 0x2e, 0xde, 0x1d, 0x31, 0xaf, 0xd1, 0xf3, 0xd2, 0xed, 0x3c, 0xe2, 0x58, 0x92, 0xbc,
+    0xa0, 0x07, 0x30, 0x25, 0xb8, 0x44, 0x7d, 0x91, 0x8a, 0x39, 0x74, 0xe3, 0x8b, 0x23, 0x4f, 0x2e,
+    0xe2, 0xbd, 0x9f, 0xb4, 0xbb, 0xaa, 0x72, 0x03, 0xdc, 0xd8, 0xb2, 0x82, 0x08, 0xac, 0x03, 0x21,
+    0x67, 0x20, 0x47, 0x37, 0x8b, 0xa8, 0x23, 0x43, 0x64, 0x0e, 0x50, 0x53, 0x6f, 0x50, 0x1d, 0x42,
+    0x2b, 0xf1, 0x64, 0xdc, 0x44, 0x50, 0xb8, 0x50, 0x49, 0xa8, 0x0b, 0xc6, 0xde, 0x65, 0xbb, 0x2d,
+    0x50, 0xda, 0x5c, 0xe6, 0x42, 0x59, 0x8d, 0x42, 0x6e, 0x73, 0x87, 0xb1, 0x76, 0xfb, 0xf5, 0xf1,
+    0xd3, 0xe3, 0x6d, 0xf6, 0xf3, 0xb3, 0xff, 0x78, 0x40, 0x27, 0xa7, 0xe8, 0x9e, 0x58, 0x12, 0xe8,
+    0xc6, 0x50, 0x59, 0x2e, 0xe0, 0x9a, 0x0e, 0x2f, 0xc6, 0xe7, 0x4a, 0x60, 0x11, 0x5a, 0x80, 0x2c,
+    0xd6, 0x88, 0xbb, 0x51, 0x18, 0x44, 0xb5, 0x98, 0x92, 0xc6, 0x98, 0xa0, 0xa0, 0x22, 0x30, 0x84,
+    0x25, 0x53, 0x04, 0x86, 0x22, 0xd0, 0xdc, 0xc2, 0xbd, 0xbd, 0x83, 0xcf, 0x98, 0x06, 0x0e, 0xd2,
+    0xa5, 0x10, 0xfe, 0x4b, 0xfa, 0x8b, 0x00, 0x68, 0x7e, 0xdf, 0xab, 0x79, 0x07, 0x55, 0xe1, 0x16,
+    0x58, 0xb5, 0x83, 0x40, 0x13, 0xdb, 0xa7, 0x43, 0xa7, 0xd0, 0xc8, 0xcf, 0x89, 0x37, 0xe3, 0x8d,
+    0xf2, 0x49, 0xba, 0xaa, 0xeb, 0x63, 0x2b, 0xb6, 0x46, 0xef, 0xe0, 0x1f, 0xf2, 0x2a, 0x9f, 0xd6,
+    0xb2, 0x19, 0x94, 0xef, 0x79, 0x60, 0x89, 0x22, 0x37, 0x16, 0x46, 0x48, 0x7e, 0x49, 0x5b, 0xbd,
+    0x79, 0xaf, 0x6e, 0xee, 0xe2, 0xba, 0x25, 0x0e, 0xb9, 0xdc, 0xaf, 0xa6, 0xaf, 0xca, 0x01, 0x7c,
+    0xa9, 0x44, 0x78, 0x68, 0x38, 0x1d, 0xd7, 0x40, 0x00, 0x0b, 0xa9, 0x61, 0xe4, 0xae, 0xe6, 0x92,
+    0xf7, 0xba, 0x79, 0x57, 0x57, 0xda, 0x35, 0xbc, 0xba, 0xa7, 0x45, 0xa4, 0xfa, 0xba, 0xab, 0xb1,
+    0xc2, 0x17, 0x7f, 0x2a, 0xd1, 0xcd, 0xdc, 0x7c, 0xde, 0x63, 0x9d, 0xa6, 0x31, 0x1f, 0x59, 0xf9,
+    0xee, 0x6e, 0xf2, 0xef, 0xc9, 0xdc, 0xd9, 0x45, 0xf1, 0xb2, 0x23, 0xf4, 0xdc, 0x19, 0x3d, 0x62,
+    0x3b, 0x77, 0xf7, 0x56, 0xb9, 0x4f, 0xb4, 0x12, 0x56, 0xc5, 0xd2, 0x52, 0x86, 0x2e, 0x6d, 0x22,
+    0xe1, 0xa1, 0x6b, 0xf7, 0xae, 0xa5, 0x31, 0x3e, 0x56, 0xb1, 0xba, 0x3f, 0x2a, 0x24, 0x25, 0xca,
+    0xbd, 0xd5, 0xc1, 0x35, 0x48, 0xb5, 0x5a, 0x03, 0xcc, 0x15, 0x3f, 0xc5, 0x64, 0x0a, 0x11, 0x42,
+    0xb2, 0xbb, 0x8f, 0xfc, 0xc6, 0x8f, 0xaf, 0x2a, 0x68, 0x08, 0x57, 0x86, 0x3b, 0xe2, 0x4c, 0xc9,
+    0xee, 0x2e, 0x73, 0x7b, 0x72, 0xff, 0x2a, 0xff, 0x06, 0x1a, 0x9a, 0x50, 0x2a, 0xf8, 0x48, 0x75,
+    0x91, 0x7f, 0x2e, 0x47, 0xb6, 0x3f, 0x03, 0x0c, 0xe1, 0x8b, 0x79, 0xa5, 0x29, 0xb6, 0xf2, 0xca,
+    0x80, 0xc6, 0x9a, 0xdc, 0x26, 0x39, 0xb1, 0xd4, 0x69, 0x7b, 0x3c, 0xc0, 0x4f, 0xf7, 0x0b, 0x60,
+    0xd8, 0x96, 0xba, 0xc2, 0xa0, 0xfa, 0xe4, 0xb6, 0x1a, 0x62, 0xde, 0x6e, 0x71, 0xf9, 0x8c, 0xe0,
+    0xa6, 0x7b, 0xea, 0x71, 0x42, 0xf6, 0x02, 0xdd, 0x06, 0x20, 0x0d, 0xbd, 0x24, 0x3d, 0xe1, 0x17,
+    0x74, 0x97, 0x56, 0xfb, 0xed, 0x7f, 0x79, 0xf6, 0xa7, 0x8e, 0xbd, 0xf5, 0xce, 0x61, 0x0f, 0x1e,
+    0xbe, 0xfb, 0xc7, 0x0f, 0x3f, 0xd6, 0xdf, 0x35, 0xde, 0x35, 0xff, 0xed, 0xdd, 0x7f, 0x7d, 0xf8,
+    0xbf, 0xef, 0x3e, 0xbf, 0xbb, 0xfd, 0x7f, 0xef, 0x36, 0x5a, 0x3b, 0xbb, 0xef, 0xde, 0xbe, 0x7b,
+    0x6f, 0xbf, 0x6f, 0x5f, 0x04, 0x42, 0x65, 0x41, 0xc9, 0x45, 0xa7, 0x6a, 0x77, 0x19, 0xb0, 0x86,
+    0xd9, 0x1c, 0xec, 0xea, 0x43, 0x8c, 0x1e, 0x62, 0x9e, 0xce, 0x82, 0x61, 0x2d, 0x6f, 0x21, 0x0a,
+    0x09, 0x05, 0x72, 0x88, 0xa2, 0xce, 0x1a, 0xa5, 0xd1, 0xe0, 0x01, 0xfa, 0xa6, 0x3c, 0x98, 0xaf,
+    0x34, 0x4f, 0xd5, 0x5c, 0x85, 0x46, 0x29, 0x49, 0x31, 0x8b, 0xb5, 0x37, 0x45, 0xdd, 0x4c, 0x28,
+    0xab, 0x54, 0x62, 0x2c, 0x79, 0xf9, 0x08, 0x86, 0x85, 0x9d, 0xe0, 0xd5, 0x6c, 0x59, 0x14, 0x13,
+    0x4d, 0x23, 0xb2, 0x8a, 0x68, 0xb5, 0x3b, 0xd7, 0xa8, 0x8c, 0x41, 0x52, 0xb1, 0x93, 0x3e, 0x16,
+    0x59, 0x17, 0x15, 0x10, 0x13, 0xf7, 0x88, 0x82, 0xe9, 0x09, 0xf1, 0x9c, 0x49, 0x7c, 0x14, 0xbf,
+    0x57, 0x53, 0xce, 0x43, 0xf1, 0x88, 0x52, 0x9c, 0x89, 0x0f, 0x11, 0x09, 0xe1, 0x8b, 0xfe, 0x4c,
+    0x64, 0x41, 0x24, 0xc4, 0xaf, 0x33, 0x90, 0xf8, 0x0b, 0xd0, 0xce, 0x17, 0x93, 0xa9, 0x3c, 0x90,
+    0x85, 0x8f, 0x1c, 0x2f, 0xc2, 0xc7, 0x07, 0xaa, 0x4d, 0x4f, 0x13, 0x2f, 0x9a, 0xf0, 0x65, 0xc9,
+    0xbd, 0x16, 0x23, 0xcb, 0xbb, 0x8e, 0x7a, 0xce, 0xba, 0x97, 0x2a, 0x84, 0x44, 0xfe, 0x0b, 0x6b,
+    0xf5, 0x54, 0xb8, 0x8f, 0x1a, 0xab, 0xe4, 0x96, 0x06, 0xfa, 0x6f, 0x0b, 0x40, 0xaa, 0x78, 0x1e,
+    0xa7, 0x4b, 0x70, 0xbf, 0xc3, 0x9d, 0x22, 0x8f, 0x00, 0xdf, 0x93, 0x28, 0x72, 0xb3, 0x50, 0x55,
+    0x34, 0xfa, 0x03, 0xfd, 0x79, 0x1f, 0x84, 0x5d, 0x00, 0x2c, 0x82, 0x37, 0xf2, 0xe3, 0x94, 0x74,
+    0x5c, 0xe2, 0x5d, 0x54, 0x5f, 0x53, 0x8c, 0xf0, 0x9f, 0x0e, 0x68, 0x91, 0x12, 0xae, 0x8e, 0x49,
+    0xa0, 0xbe, 0xf6, 0x5b, 0x1a, 0x47, 0x6d, 0x78, 0x69, 0xaf, 0xab, 0x5f, 0x38, 0xa0, 0xd9, 0x34,
+    0xa7, 0x22, 0x35, 0x69, 0x66, 0xba, 0xd2, 0x85, 0x02, 0xcb, 0x6e, 0xef, 0x74, 0x35, 0xc9, 0x29,
+    0xe2, 0xed, 0xfe, 0x91, 0x08, 0x3f, 0xfd, 0x0a, 0x50, 0x12, 0xda, 0x89, 0x54, 0xde, 0xef, 0x0b,
+    0xb3, 0x3b, 0x2b, 0x7d, 0x11, 0x04, 0xef, 0x6c, 0xed, 0x1b, 0xc3, 0x33, 0x98, 0x5d, 0x38, 0x68,
+    0xa2, 0xad, 0xb3, 0x3f, 0xd7, 0x03, 0xf6, 0xc3, 0x77, 0xc8, 0xae, 0x87, 0xac, 0x3e, 0x78, 0xfa,
+    0x45, 0xd2, 0x8e, 0x6a, 0xc9, 0x4b, 0x14, 0xd0, 0x12, 0xae, 0x7f, 0x19, 0x68, 0x0d, 0xbb, 0x6e,
+    0xb0, 0x6e, 0xb5, 0x74, 0x37, 0x7f, 0xb9, 0xa5, 0x78, 0x68, 0x9e, 0x6f, 0x5a, 0x92, 0x13, 0xcb,
+    0x9f, 0x8b, 0x95, 0x87, 0x2a, 0x6d, 0xbb, 0xf0, 0xa1, 0xd8, 0x3b, 0xf5, 0xed, 0x2f, 0x6b, 0x7d,
+    0x63, 0xa3, 0xb2, 0xf5, 0xe5, 0x2b, 0x90, 0x0a, 0x62, 0xb5, 0x52, 0xa9, 0xbb, 0xe7, 0x75, 0x50,
+    0x25, 0x5b, 0x1a, 0x94, 0xaf, 0x43, 0x94, 0x66, 0x68, 0x41, 0xf3, 0x08, 0xcf, 0xb9, 0xe5, 0xbb,
+    0x93, 0x5a, 0xbf, 0xa0, 0xc3, 0x6a, 0x9f, 0xf5, 0x4e, 0xd6, 0xba, 0x8d, 0x4c, 0xb1, 0x65, 0xa3,
+    0xf6, 0x3d, 0xb7, 0xcd, 0x8d, 0xbb, 0xc2, 0xa6, 0x0e, 0x28, 0x0f, 0x3e, 0x8f, 0x44, 0x01, 0xda,
+    0x34, 0x5d, 0xbd, 0x31, 0x53, 0xbe, 0x49, 0x89, 0xd4, 0xcc, 0xe5, 0xfb, 0x7e, 0xac, 0xd2, 0xf7,
+    0x59, 0xc1, 0x86, 0x51, 0xb7, 0xbc, 0x5c, 0x04, 0xd9, 0x74, 0x31, 0x76, 0x26, 0xf1, 0xac, 0x7d,
+    0xc0, 0xc3, 0x30, 0xe0, 0x29, 0x90, 0x18, 0xde, 0x22, 0x93, 0xb6, 0x4b, 0x95, 0x3e, 0x9c, 0x9d,
+    0xba, 0x9d, 0x41, 0xcf, 0x92, 0xcb, 0x60, 0x6e, 0x9c, 0x95, 0x94, 0xee, 0xc7, 0x6d, 0xf5, 0xc5,
+    0xb7, 0xc7, 0x6d, 0x44, 0x06, 0xfc, 0x45, 0x15, 0x68, 0xaf, 0xf6, 0xff, 0x01, 0xc5, 0x24, 0x37,
+    0x48, 0x6a, 0xaa, 0x00, 0x00,
+};
+
+/* index.htm - brotli 9315 bytes */
+static const uint8_t index_htm_br[] = {
+    0x1b, 0x69, 0xaa, 0x51, 0xd4, 0x13, 0x15, 0xda, 0xa9, 0x88, 0x8a, 0x56, 0xbc, 0x00, 0xad, 0x0b,
+    0xb8, 0x21, 0x63, 0x06, 0x78, 0xfb, 0xea, 0x44, 0x29, 0xc2, 0x95, 0x83, 0x3c, 0x96, 0x46, 0x06,
+    0x67, 0x5c, 0xd9, 0xb0, 0xa7, 0x32, 0x57, 0x5d, 0x50, 0x3d, 0x65, 0xb6, 0x0e, 0x4f, 0xc5, 0xf2,
+    0xbf, 0x2f, 0xe5, 0xae, 0xbd, 0x1e, 0x21, 0xc9, 0x6c, 0xfb, 0xff, 0x7e, 0x5a, 0xff, 0xef, 0xcf,
+    0x17, 0x32, 0x05, 0x47, 0x16, 0xe1, 0x82, 0x4e, 0x71, 0xe7, 0xc6, 0xdd, 0xfe, 0x4a, 0x69, 0xa8,
+    0x24, 0x92, 0x7e, 0xe2, 0x78, 0xcc, 0x3e, 0x06, 0xff, 0x5b, 0x6a, 0xde, 0xf7, 0x72, 0x7a, 0xa3,
+    0x14, 0x60, 0x0c, 0x28, 0xa5, 0x4a, 0xdb, 0xda, 0x2d, 0xad, 0xc8, 0x8e, 0x83, 0x0d, 0xd1, 0xe2,
+    0x02, 0x0c, 0x1f, 0xf7, 0x09, 0xd4, 0xe7, 0xf2, 0x13, 0xd1, 0xbe, 0x3b, 0x1b, 0xbe, 0xb1, 0xa4,
+    0x55, 0xa4, 0x5e, 0x07, 0x39, 0xa1, 0x5f, 0x25, 0x40, 0x96, 0x08, 0xac, 0x43, 0x12, 0x10, 0x64,
+    0xba, 0xf9, 0x1a, 0xf5, 0x6e, 0xb9, 0x50, 0x98, 0xff, 0x2e, 0x0b, 0x42, 0x21, 0xdc, 0x94, 0xc5,
+    0xfc, 0x9f, 0x4e, 0xd9, 0x6b, 0x77, 0x3a, 0xf2, 0xae, 0x63, 0x11, 0x89, 0x44, 0xd8, 0x06, 0xd4,
+    0xf7, 0x8c, 0x4d, 0x45, 0xdc, 0xfc, 0x84, 0x56, 0x9a, 0x30, 0xaf, 0xf9, 0x88, 0x02, 0xc9, 0x66,
+    0x2b, 0xa5, 0xbb, 0x30, 0x2f, 0xac, 0x74, 0x75, 0x85, 0x9a, 0x4e, 0xe5, 0xf1, 0xd7, 0xf0, 0x40,
+    0x3b, 0x8c, 0x41, 0x49, 0xfc, 0xfc, 0xff, 0xf7, 0xa7, 0x7d, 0x75, 0xb3, 0xe4, 0x1e, 0xe6, 0x20,
+    0xea, 0x35, 0xd1, 0xac, 0x1c, 0x29, 0x4c, 0xea, 0xed, 0x43, 0xcb, 0xef, 0xe9, 0x49, 0xab, 0x64,
+    0xd9, 0x9e, 0x2f, 0xc9, 0x0d, 0xb6, 0x3f, 0xa1, 0x9b, 0xe0, 0x9e, 0x73, 0xef, 0x93, 0x65, 0xc9,
+    0x55, 0x6d, 0xbb, 0xaa, 0x89, 0xa3, 0x41, 0x8e, 0x80, 0x20, 0xfc, 0xe9, 0x04, 0x19, 0x60, 0x36,
+    0x41, 0x34, 0x59, 0xe8, 0x82, 0x61, 0x08, 0x27, 0x08, 0x3b, 0x48, 0xc2, 0x31, 0x1b, 0x77, 0xb1,
+    0x15, 0x85, 0xd8, 0x7f, 0x3f, 0xcb, 0x50, 0x75, 0x27, 0x4e, 0xdb, 0xa4, 0x67, 0x6b, 0x30, 0x57,
+    0x08, 0x10, 0x02, 0x04, 0x76, 0x1a, 0x31, 0x83, 0x9d, 0x6d, 0x67, 0x5d, 0x18, 0xe0, 0xa0, 0xb2,
+    0x99, 0x55, 0x94, 0x39, 0x35, 0x3d, 0xfd, 0xda, 0x7d, 0x02, 0xa2, 0xb0, 0xf5, 0x0a, 0xf3, 0xaa,
+    0x4a, 0x81, 0x5d, 0x1c, 0x44, 0x4a, 0x4a, 0x03, 0xa2, 0x4b, 0x6c, 0x09, 0xae, 0x47, 0x29, 0xbd,
+    0xec, 0xe1, 0x13, 0x6e, 0x33, 0x19, 0x28, 0x12, 0x09, 0x48, 0x3b, 0xfc, 0x9c, 0x6b, 0x74, 0x2e,
+    0xf0, 0xa3, 0xc7, 0x0e, 0x15, 0x4c, 0x97, 0x04, 0x5d, 0x72, 0xb5, 0x43, 0x35, 0x79, 0x89, 0xe2,
+    0x2e, 0xc4, 0xad, 0x04, 0x33, 0xa3, 0xd5, 0xf8, 0xa4, 0xb3, 0x32, 0x84, 0xab, 0xcc, 0x23, 0x02,
+    0x10, 0x8d, 0x9b, 0x07, 0xc6, 0xbf, 0xd8, 0x9b, 0xb1, 0xf9, 0xbf, 0xbf, 0xf9, 0xf6, 0x87, 0x59,
+    0x9d, 0x3e, 0xae, 0x0e, 0x27, 0xc6, 0x02, 0xc0, 0x03, 0xcd, 0x26, 0xa4, 0xd1, 0x7f, 0xdf, 0x24,
+    0x4f, 0x67, 0x8f, 0x88, 0xe3, 0xa3, 0x39, 0xe9, 0xcf, 0xb6, 0x36, 0x56, 0x82, 0xd7, 0xef, 0x02,
+    0x16, 0xbf, 0x21, 0xa0, 0x51, 0x8a, 0x47, 0xd8, 0xc6, 0x0f, 0xbf, 0x93, 0xca, 0x68, 0xa9, 0x10,
+    0x77, 0x1c, 0xdd, 0x83, 0x20, 0x47, 0x8a, 0x53, 0xe9, 0xee, 0xcb, 0x1e, 0xc5, 0x1c, 0xc8, 0x0a,
+    0x62, 0x3c, 0x32, 0x6d, 0xad, 0x51, 0x11, 0xc0, 0x15, 0x61, 0xed, 0x8a, 0x6e, 0x7d, 0x8d, 0xd7,
+    0x29, 0xfe, 0x39, 0x19, 0x0d, 0xa8, 0x78, 0x43, 0x2b, 0xb5, 0x02, 0x81, 0x50, 0xe5, 0x7b, 0xab,
+    0xc2, 0x8d, 0x3b, 0xe4, 0xa4, 0x83, 0x2c, 0x84, 0x1f, 0xbd, 0x9c, 0xb6, 0x4b, 0x8b, 0xe6, 0x6d,
+    0xc6, 0xff, 0x74, 0xf3, 0xbd, 0x3a, 0x21, 0x3b, 0x46, 0xe9, 0xc6, 0x18, 0xdd, 0x07, 0xff, 0x6d,
+    0x75, 0xed, 0x62, 0x65, 0xa3, 0xb8, 0x8f, 0x5a, 0x6e, 0xd7, 0xfb, 0x58, 0xfd, 0x83, 0xcb, 0x95,
+    0x5f, 0xff, 0x87, 0x6b, 0xbf, 0x1c, 0xba, 0xb9, 0x2b, 0x7a, 0x9a, 0x98, 0x9f, 0xf8, 0xa6, 0x60,
+    0x53, 0xf9, 0x81, 0x2d, 0x6f, 0xa5, 0x4e, 0xea, 0xf7, 0x8c, 0xb6, 0x81, 0x44, 0x7e, 0x71, 0x33,
+    0x1d, 0x08, 0x4c, 0x3a, 0x62, 0xd1, 0x01, 0xcd, 0x8a, 0x49, 0x61, 0x65, 0xd5, 0xfa, 0x3e, 0xee,
+    0x34, 0x2e, 0xa6, 0xfb, 0x61, 0xe3, 0x24, 0x85, 0xff, 0x3f, 0xaa, 0x15, 0xb3, 0x0e, 0xd1, 0xf2,
+    0xbe, 0x1b, 0x84, 0x04, 0xd7, 0x34, 0x1a, 0x2c, 0x0b, 0x45, 0x3f, 0xbe, 0x8a, 0xee, 0xa9, 0xe1,
+    0x29, 0x7c, 0xda, 0x9d, 0xf2, 0xcf, 0xa3, 0x01, 0xc1, 0x34, 0x76, 0x66, 0xfb, 0x79, 0xf7, 0xdb,
+    0x9a, 0x50, 0x1a, 0x7b, 0xf0, 0xda, 0x75, 0x66, 0x77, 0x7c, 0x94, 0x56, 0xc8, 0x0e, 0xce, 0xc6,
+    0x95, 0xf6, 0x9f, 0x41, 0x07, 0x83, 0x18, 0x3d, 0x9e, 0x9f, 0x91, 0xf5, 0xbe, 0x99, 0x45, 0x72,
+    0x6c, 0xaa, 0xf0, 0xdf, 0xd1, 0x25, 0x7c, 0x80, 0x13, 0xc9, 0xf7, 0x9b, 0xd3, 0x2d, 0x47, 0xc0,
+    0x38, 0xab, 0x7b, 0x0d, 0x83, 0xe6, 0xdb, 0x4f, 0xae, 0xb9, 0xc6, 0xcc, 0xed, 0xeb, 0x29, 0x2f,
+    0xa2, 0x61, 0x20, 0x55, 0xcc, 0x5f, 0x22, 0x9d, 0x11, 0x51, 0xd8, 0xaa, 0xfd, 0x09, 0xb9, 0xbc,
+    0x8b, 0xee, 0x4b, 0x7a, 0xa5, 0xdd, 0xa2, 0x57, 0x29, 0x9f, 0x1a, 0xdb, 0xb1, 0x9b, 0x16, 0x8e,
+    0x2f, 0x3b, 0x48, 0x2b, 0xa0, 0x88, 0x9e, 0x79, 0x20, 0x2c, 0xdb, 0xf5, 0xf7, 0xcb, 0x9b, 0xd8,
+    0x8b, 0x5a, 0x0d, 0xa6, 0xd6, 0xaf, 0xe3, 0x6d, 0xf5, 0xa6, 0x87, 0x47, 0x4d, 0xa5, 0x28, 0x3a,
+    0xb4, 0xa9, 0xed, 0xb6, 0xbf, 0xd2, 0x87, 0xb0, 0x17, 0x2a, 0xef, 0x3c, 0x62, 0xd3, 0x94, 0xf5,
+    0x16, 0x6c, 0xb4, 0xbb, 0xfc, 0x6e, 0x78, 0x5c, 0x62, 0x89, 0xe9, 0x29, 0xb6, 0x49, 0xb2, 0xff,
+    0x82, 0x57, 0xd1, 0x50, 0xfc, 0x49, 0xe5, 0x4a, 0xc1, 0x95, 0x76, 0xcb, 0x3b, 0x01, 0x3d, 0xfe,
+    0xba, 0x11, 0xd0, 0x5e, 0x9c, 0x18, 0x95, 0xe1, 0xc6, 0x1c, 0x17, 0x50, 0xf1, 0x9b, 0xec, 0x2b,
+    0xfe, 0x9a, 0xf5, 0x9e, 0x68, 0x2c, 0x7a, 0x21, 0x73, 0x5e, 0x35, 0x32, 0x01, 0x52, 0x78, 0x19,
+    0xc3, 0xb2, 0xd1, 0xb6, 0x43, 0x79, 0x6e, 0xa8, 0x36, 0xe6, 0x2b, 0x6c, 0x45, 0xba, 0xe4, 0x99,
+    0x94, 0xaa, 0x3f, 0xd4, 0xed, 0xa3, 0xc8, 0xfe, 0xf3, 0x7c, 0x1b, 0x47, 0x9b, 0x48, 0xab, 0x64,
+    0x4a, 0xbd, 0xb8, 0x0d, 0xec, 0xc3, 0xd9, 0xc5, 0x76, 0x4b, 0x2a, 0x0a, 0x39, 0xc4, 0x3b, 0x6e,
+    0xcc, 0x69, 0x16, 0x75, 0x6f, 0x65, 0xb4, 0xa6, 0x32, 0x50, 0x5a, 0xa0, 0x4c, 0x1e, 0x1a, 0x08,
+    0xec, 0x9e, 0xf6, 0x40, 0x0c, 0xef, 0xbb, 0xb4, 0xb0, 0xf7, 0x79, 0xd9, 0xb1, 0x7b, 0x24, 0xa1,
+    0x1f, 0x5a, 0x95, 0x4f, 0xd8, 0x97, 0x24, 0xa6, 0x9e, 0x9a, 0xf4, 0x1a, 0x85, 0x55, 0x79, 0x0a,
+    0x88, 0x1a, 0x83, 0x8c, 0x05, 0x9e, 0x6f, 0x87, 0x84, 0xe2, 0xa1, 0x8f, 0x8b, 0x3b, 0xd4, 0xdc,
+    0xbf, 0x05, 0x0e, 0x86, 0xec, 0x5c, 0xea, 0xe5, 0x13, 0xab, 0x7c, 0x62, 0x34, 0x28, 0x54, 0xbd,
+    0x28, 0xa3, 0xc1, 0x82, 0xc9, 0x59, 0x4b, 0x2e, 0x8f, 0x4a, 0xe2, 0xa2, 0xdd, 0x66, 0x0c, 0xaf,
+    0x4c, 0xf4, 0xda, 0x93, 0xaf, 0x38, 0x97, 0x6b, 0xdb, 0x2c, 0x27, 0x44, 0x9c, 0x71, 0x2f, 0x40,
+    0x35, 0x1c, 0x32, 0x00, 0x0f, 0x97, 0xba, 0xdb, 0x40, 0xe7, 0x86, 0xc0, 0x21, 0x34, 0xa5, 0xfa,
+    0xf7, 0x4d, 0x7a, 0xe1, 0x79, 0x3e, 0x2b, 0xd5, 0x19, 0x77, 0x87, 0xdb, 0x8c, 0x68, 0x0a, 0xe1,
+    0x6e, 0x21, 0x01, 0x77, 0xcb, 0x66, 0x7d, 0x70, 0x13, 0x90, 0x73, 0xa0, 0x51, 0x9f, 0x9c, 0xa1,
+    0xee, 0x01, 0x10, 0x82, 0xa9, 0x63, 0x52, 0xe6, 0x87, 0xf8, 0x98, 0xcd, 0x86, 0xda, 0x01, 0xf1,
+    0xa2, 0x0a, 0x59, 0xc0, 0x48, 0x32, 0x6b, 0xd6, 0xa5, 0xcf, 0xf1, 0xa3, 0x02, 0x87, 0x5a, 0xef,
+    0xc5, 0x80, 0xc1, 0x26, 0xc5, 0x2f, 0xdd, 0xa3, 0x52, 0x74, 0x8c, 0xfc, 0x19, 0xd1, 0xb8, 0xf7,
+    0x18, 0x37, 0x5c, 0x8b, 0x15, 0xa6, 0x79, 0x54, 0xb9, 0x39, 0x61, 0x09, 0x34, 0x6b, 0x64, 0x3c,
+    0xe0, 0x36, 0x51, 0x49, 0xb2, 0x95, 0x3e, 0xc3, 0x90, 0x7b, 0x1c, 0x16, 0x6c, 0xb6, 0x44, 0xbf,
+    0x29, 0x34, 0x3b, 0xef, 0xa9, 0xb9, 0x7c, 0xc5, 0x2f, 0xc9, 0xd8, 0x33, 0xf9, 0xdd, 0xf1, 0x83,
+    0x57, 0x5c, 0xd0, 0x8f, 0xa9, 0xd4, 0x2e, 0x2f, 0x46, 0x40, 0x39, 0xe8, 0x90, 0x46, 0x34, 0xe2,
+    0xb3, 0xe9, 0xb4, 0x6c, 0x03, 0xf5, 0x66, 0xe2, 0xa3, 0xed, 0x12, 0x86, 0x94, 0x29, 0x97, 0xd0,
+    0xeb, 0x6c, 0x7f, 0xfa, 0x5e, 0x80, 0x18, 0xac, 0xb3, 0x05, 0xa0, 0x87, 0x00, 0x5c, 0xf9, 0xe1,
+    0x69, 0x31, 0x38, 0x4e, 0x7b, 0x38, 0xea, 0x86, 0xcf, 0x0b, 0x19, 0x54, 0x1a, 0xbf, 0x24, 0x34,
+    0x59, 0xef, 0x0c, 0x82, 0x1c, 0x3c, 0xee, 0xf0, 0xc0, 0xa9, 0xe0, 0xb3, 0x19, 0x9c, 0x9f, 0xf2,
+    0x56, 0x50, 0x5b, 0x47, 0x73, 0xdc, 0x80, 0x7e, 0xfe, 0xcd, 0xf2, 0xf6, 0x9b, 0x7f, 0xd7, 0x82,
+    0xff, 0xda, 0xff, 0xbe, 0xff, 0xe1, 0x07, 0x52, 0xfb, 0xce, 0x8a, 0xac, 0x34, 0x54, 0xd4, 0x49,
+    0xb5, 0xd8, 0xf6, 0xed, 0x8a, 0x41, 0xd1, 0xec, 0x29, 0x47, 0xe0, 0x1b, 0xd1, 0xe7, 0xee, 0xb5,
+    0x0d, 0x40, 0x9d, 0xc5, 0xf2, 0xbd, 0x10, 0x8c, 0xd0, 0x5d, 0x3d, 0x55, 0x0f, 0xfb, 0x06, 0x83,
+    0x95, 0x62, 0xcd, 0x28, 0x16, 0xfb, 0x54, 0x09, 0x8f, 0xcb, 0x05, 0x6f, 0x8c, 0x22, 0x42, 0x61,
+    0x37, 0xb2, 0xab, 0xde, 0x29, 0x29, 0x54, 0xe0, 0x40, 0xa0, 0x93, 0xac, 0xea, 0x7a, 0x37, 0x50,
+    0x77, 0xd4, 0x2f, 0xb8, 0xdd, 0xf1, 0x93, 0xd1, 0x39, 0xff, 0xae, 0x11, 0x2f, 0xe5, 0xc4, 0xb2,
+    0xcd, 0x78, 0xcb, 0x48, 0xde, 0xc6, 0x96, 0x4d, 0xb9, 0xc2, 0xaa, 0xb1, 0x79, 0x7f, 0x64, 0x9c,
+    0xd5, 0xf9, 0x93, 0x8b, 0x86, 0x7c, 0x69, 0xf1, 0x76, 0x16, 0x91, 0xa3, 0x20, 0x47, 0xbd, 0xf0,
+    0x17, 0x92, 0x93, 0x90, 0xb4, 0x71, 0xab, 0x46, 0xbf, 0xf7, 0xa1, 0x6f, 0xac, 0x22, 0xa7, 0xde,
+    0x32, 0xb8, 0x70, 0xa6, 0x08, 0xeb, 0xd8, 0x0b, 0x95, 0x34, 0xd7, 0xce, 0xa6, 0x6b, 0x5d, 0x3f,
+    0xa4, 0x2c, 0x4e, 0x0b, 0x3d, 0x04, 0xf3, 0x81, 0xae, 0xc4, 0x8a, 0xa0, 0x8d, 0xb9, 0x2b, 0xf4,
+    0x47, 0xf8, 0x8e, 0xb4, 0x79, 0x16, 0xca, 0x78, 0xf9, 0xfc, 0xdf, 0x1b, 0x59, 0xed, 0x77, 0x8e,
+    0x9b, 0x39, 0x60, 0x35, 0xee, 0xb7, 0x65, 0x36, 0x6b, 0x92, 0x71, 0x7a, 0x99, 0xef, 0x82, 0x10,
+    0xcc, 0x8b, 0x7d, 0xe4, 0xdd, 0x54, 0x26, 0x1c, 0xab, 0x46, 0x31, 0x7c, 0x6a, 0xc5, 0x6f, 0x39,
+    0x88, 0xab, 0xd2, 0xf4, 0x81, 0xfd, 0xc5, 0x93, 0x39, 0xfc, 0x87, 0x1f, 0xc9, 0x8f, 0x76, 0x69,
+    0xb2, 0x47, 0x2e, 0x4d, 0x80, 0x15, 0xd3, 0x28, 0x7b, 0xd2, 0x77, 0xa7, 0xb7, 0xde, 0x40, 0xa9,
+    0xe4, 0x36, 0xfd, 0xf2, 0xb0, 0xaf, 0xdc, 0x8f, 0x63, 0x6e, 0x2d, 0x82, 0x91, 0x77, 0x65, 0x17,
+    0xf7, 0x57, 0xe1, 0x6e, 0xb1, 0xce, 0x53, 0xd0, 0x25, 0xe6, 0x72, 0xd6, 0xf5, 0x20, 0x39, 0x98,
+    0x2b, 0x30, 0x73, 0xf8, 0xcd, 0x61, 0xaf, 0x9e, 0x06, 0x3b, 0xf9, 0xd1, 0x91, 0x33, 0x5e, 0x93,
+    0x6b, 0x6d, 0x1a, 0xbf, 0x1d, 0x06, 0x1a, 0xd3, 0x40, 0x3e, 0xd8, 0xfc, 0x0a, 0x51, 0x16, 0x21,
+    0x11, 0xb1, 0x41, 0x8c, 0xa5, 0x2b, 0x1e, 0xf2, 0xb9, 0xd8, 0xc5, 0x17, 0x45, 0x5d, 0x30, 0xb0,
+    0xbe, 0xc1, 0xc4, 0x64, 0x84, 0x78, 0x27, 0x86, 0x54, 0xa3, 0x8e, 0x5f, 0x8f, 0x45, 0x6e, 0x38,
+    0x64, 0x40, 0x8f, 0x62, 0x58, 0x02, 0xd6, 0x59, 0x68, 0x41, 0x1c, 0xb9, 0x79, 0x2b, 0x29, 0xc6,
+    0xa7, 0x4f, 0x66, 0xc2, 0xe8, 0xa9, 0xba, 0x72, 0x49, 0x27, 0x9a, 0xb6, 0xf3, 0x09, 0x37, 0xc1,
+    0x0b, 0x1e, 0x91, 0xbe, 0x5c, 0x4b, 0x09, 0x31, 0xcd, 0xc0, 0xd8, 0xbc, 0xb0, 0xad, 0xb3, 0xad,
+    0x2e, 0x59, 0x7e, 0xab, 0x0d, 0x25, 0x1b, 0x75, 0xf0, 0x7e, 0xdf, 0x0e, 0x17, 0x6c, 0x1b, 0x77,
+    0x74, 0x5e, 0xda, 0xd2, 0x8d, 0x42, 0x43, 0xd8, 0x89, 0xaa, 0x14, 0x09, 0xa2, 0xd3, 0x3e, 0xd8,
+    0x49, 0xf8, 0xd0, 0xc7, 0x39, 0x81, 0xc5, 0x53, 0x6e, 0xaf, 0x67, 0x98, 0xe1, 0x2d, 0x39, 0xa4,
+    0xbf, 0x6f, 0x9f, 0x52, 0xf3, 0x78, 0x99, 0x08, 0x10, 0x62, 0xf1, 0x36, 0x4a, 0x22, 0xc8, 0x74,
+    0x45, 0x8d, 0x2d, 0x5e, 0x03, 0x25, 0xbb, 0xfc, 0x9d, 0x13, 0x69, 0x60, 0xc3, 0x2a, 0xf5, 0x27,
+    0xba, 0xaf, 0x57, 0xe0, 0x63, 0xde, 0x75, 0x1e, 0x88, 0xf7, 0x5d, 0xf4, 0xd6, 0xc6, 0x86, 0xf0,
+    0x92, 0xaa, 0x29, 0xad, 0x44, 0x6f, 0x53, 0x31, 0x8b, 0xd0, 0x43, 0xf5, 0xa9, 0xc1, 0xab, 0xf4,
+    0x89, 0x9e, 0x61, 0x5a, 0x98, 0xd9, 0x10, 0xa7, 0xda, 0xde, 0x26, 0x0f, 0xa3, 0x8a, 0x8b, 0x00,
+    0x97, 0xad, 0x80, 0x67, 0x8b, 0x28, 0x25, 0xfc, 0xc2, 0x61, 0x52, 0xe0, 0x74, 0x2b, 0x2d, 0x87,
+    0xbc, 0x09, 0x4e, 0x8a, 0xef, 0xea, 0x98, 0x66, 0x38, 0xb1, 0xa0, 0x5c, 0xfd, 0x0e, 0x8e, 0xbe,
+    0x4c, 0x1f, 0xb0, 0x46, 0x7e, 0x7e, 0x5a, 0xf6, 0x80, 0x18, 0x68, 0xb4, 0x79, 0x4c, 0x90, 0x7d,
+    0xc4, 0xf1, 0x9d, 0x71, 0xc4, 0xd6, 0x94, 0x70, 0x12, 0xe7, 0xa6, 0xc5, 0x71, 0x81, 0x37, 0x0e,
+    0xa7, 0x5f, 0x0f, 0x0a, 0xfa, 0x7a, 0x86, 0x0a, 0x7a, 0x82, 0xe0, 0xe0, 0xb8, 0x1d, 0x24, 0xf2,
+    0xe4, 0xe1, 0xf1, 0x94, 0xce, 0x33, 0xe3, 0xac, 0x62, 0xc9, 0x96, 0x56, 0x85, 0x3d, 0xbf, 0x70,
+    0x57, 0x66, 0x2b, 0xf3, 0x6f, 0x71, 0xa9, 0x02, 0xca, 0x01, 0x96, 0x7d, 0x54, 0x32, 0x49, 0x39,
+    0x06, 0x1d, 0x80, 0x0c, 0x3e, 0xcf, 0x23, 0x80, 0x8a, 0xc1, 0xe4, 0x13, 0xba, 0xf9, 0x59, 0xfc,
+    0x9b, 0x36, 0x63, 0x9c, 0xd7, 0x44, 0xdc, 0xbe, 0xfe, 0x28, 0xa0, 0x4f, 0x27, 0x9a, 0x79, 0x2f,
+    0x26, 0x01, 0x5b, 0x92, 0x03, 0x7c, 0xc9, 0x1e, 0x80, 0xc2, 0x07, 0x22, 0xf2, 0xf8, 0x43, 0x9d,
+    0xb1, 0xae, 0xf0, 0xdd, 0x09, 0x66, 0xcc, 0x30, 0xe7, 0xec, 0xc3, 0x27, 0xdf, 0x2c, 0x3e, 0xe5,
+    0x4b, 0x29, 0xc5, 0xab, 0x8f, 0xae, 0x26, 0xcb, 0x43, 0xfa, 0x65, 0x59, 0x09, 0x66, 0x6e, 0x4b,
+    0x3b, 0x40, 0x9a, 0xf7, 0x50, 0x13, 0x8d, 0x22, 0xbf, 0x96, 0x27, 0x68, 0xe9, 0x18, 0x29, 0xde,
+    0x7c, 0x61, 0x61, 0xe7, 0x81, 0xad, 0x6d, 0x7b, 0xb5, 0x71, 0xb4, 0x79, 0x55, 0x88, 0x68, 0x93,
+    0xe3, 0xde, 0x94, 0x17, 0x59, 0x3c, 0x68, 0x8e, 0xd8, 0x4b, 0xea, 0x09, 0x18, 0x74, 0x8e, 0xaf,
+    0x88, 0x60, 0xa3, 0xb6, 0x84, 0x2a, 0x23, 0x6a, 0x37, 0xe1, 0xb6, 0x0e, 0x0f, 0x82, 0x61, 0xc4,
+    0x4a, 0xe4, 0xb5, 0x55, 0xc1, 0xb7, 0x89, 0x5b, 0xe7, 0x0c, 0xe1, 0xc7, 0x2a, 0xe5, 0x16, 0x33,
+    0x92, 0xf9, 0xac, 0xca, 0x67, 0x5f, 0xde, 0x49, 0xce, 0x7b, 0x0c, 0xe5, 0x55, 0x49, 0xd2, 0x8b,
+    0xfc, 0x56, 0x43, 0x5e, 0x59, 0xd3, 0x8e, 0xbd, 0x5b, 0x0a, 0xb2, 0xbf, 0xf6, 0xe9, 0x3f, 0x2c,
+    0xd5, 0x68, 0xbe, 0x17, 0x67, 0xe8, 0x1e, 0x2f, 0xad, 0x0c, 0xa1, 0xdf, 0x68, 0x87, 0x91, 0xb6,
+    0xaa, 0x4d, 0xc9, 0x90, 0xb3, 0xc4, 0xb9, 0xb7, 0x3f, 0x68, 0x29, 0x5e, 0x1f, 0x70, 0x41, 0x41,
+    0xd4, 0xc0, 0x6b, 0x9c, 0x92, 0x3c, 0xae, 0x28, 0xb8, 0x60, 0x57, 0x9a, 0xdd, 0x9c, 0x16, 0xe2,
+    0x80, 0x3c, 0x49, 0x8d, 0x47, 0x8c, 0x0a, 0x11, 0xfa, 0x3a, 0x5c, 0x67, 0x5c, 0x0c, 0x91, 0x33,
+    0x9f, 0x96, 0x63, 0x9b, 0x15, 0x47, 0x0c, 0x8b, 0xcc, 0xc3, 0xed, 0x45, 0xab, 0x16, 0x35, 0xe6,
+    0xe5, 0xc9, 0xcb, 0x2e, 0x64, 0xa5, 0x07, 0xbe, 0xad, 0xc6, 0x83, 0xae, 0xdc, 0x54, 0xc6, 0x0d,
+    0x60, 0xc7, 0x42, 0x4c, 0xb0, 0x3d, 0xe2, 0x4d, 0x97, 0xad, 0xf8, 0x35, 0xbc, 0xa0, 0x11, 0x34,
+    0x4a, 0x1b, 0x83, 0x8b, 0x26, 0x40, 0x6e, 0x13, 0x2d, 0x4c, 0x50, 0x3e, 0x85, 0xc4, 0x66, 0x0d,
+    0xaf, 0x5f, 0x64, 0xad, 0x45, 0x4a, 0x51, 0xf7, 0xc0, 0xad, 0x76, 0xb4, 0xa8, 0x71, 0x99, 0xbc,
+    0x4a, 0xfa, 0x99, 0x21, 0x5f, 0x84, 0xb5, 0x14, 0x46, 0x38, 0x41, 0x49, 0x45, 0xdf, 0x5f, 0x50,
+    0x78, 0xb3, 0x52, 0xb4, 0x52, 0x6f, 0xac, 0x39, 0x5c, 0xcf, 0xc5, 0x03, 0xd9, 0xc1, 0xad, 0xa5,
+    0xec, 0x85, 0x6e, 0x86, 0x7c, 0x6c, 0xcd, 0x4e, 0xce, 0x86, 0x5c, 0xba, 0x30, 0x9d, 0x0c, 0xd8,
+    0x4e, 0x83, 0xb6, 0x2a, 0xba, 0xdd, 0xf6, 0xab, 0x7b, 0xff, 0x92, 0x61, 0x87, 0x80, 0x92, 0x28,
+    0xb8, 0x69, 0x1a, 0x14, 0xd2, 0xc9, 0x7b, 0x3b, 0x97, 0x8f, 0x2f, 0x44, 0x4e, 0x75, 0x8f, 0xf8,
+    0x0e, 0x05, 0xb2, 0x74, 0xed, 0x32, 0x5c, 0x10, 0x7a, 0xe3, 0xb8, 0xea, 0x44, 0xf9, 0xd2, 0x4c,
+    0xca, 0x61, 0x43, 0x69, 0x1f, 0xd4, 0xad, 0x87, 0x61, 0x93, 0x02, 0xd1, 0xbc, 0x55, 0xe6, 0x0f,
+    0x86, 0x00, 0x3b, 0xbf, 0x07, 0x53, 0xf6, 0xc2, 0x8f, 0x43, 0x0a, 0x00, 0x90, 0x29, 0x8a, 0xc1,
+    0x7c, 0xde, 0x2c, 0x7f, 0x35, 0x9f, 0xf1, 0xa0, 0x81, 0x57, 0xb5, 0xaf, 0xca, 0xaa, 0x50, 0xcd,
+    0xbb, 0xfa, 0xcf, 0xbd, 0xd4, 0xde, 0x8c, 0x99, 0xa6, 0x9b, 0xc4, 0x7e, 0x82, 0x50, 0x59, 0x4a,
+    0x1a, 0xb7, 0xf5, 0x22, 0xc5, 0x69, 0x6e, 0xaf, 0x53, 0x0d, 0xad, 0xde, 0x69, 0x6e, 0xb3, 0xfa,
+    0xa7, 0x56, 0x65, 0x5f, 0xd6, 0x83, 0x9d, 0xfe, 0x92, 0x27, 0x97, 0xa5, 0x2e, 0xf2, 0x6c, 0xa1,
+    0xd5, 0x0c, 0x62, 0x8a, 0x3e, 0xd5, 0xf8, 0x2e, 0xbd, 0x40, 0xa0, 0x2a, 0x04, 0xf1, 0xeb, 0x87,
+    0x5c, 0xd8, 0x55, 0x63, 0xbc, 0x1d, 0x52, 0x64, 0xfb, 0x50, 0x1b, 0xd6, 0x78, 0x93, 0xea, 0x14,
+    0xfa, 0x30, 0x2e, 0x2b, 0xa4, 0xd5, 0xf1, 0x91, 0xcf, 0x9d, 0x0a, 0xdd, 0xdd, 0xd4, 0x0f, 0xfd,
+    0x2e, 0xc1, 0x3f, 0xbc, 0x5a, 0xbf, 0x05, 0xed, 0x63, 0xe1, 0x3b, 0x19, 0x48, 0x55, 0x9b, 0xda,
+    0xbc, 0xeb, 0xe3, 0xb8, 0xcd, 0xb4, 0x3a, 0x18, 0xcc, 0x51, 0x7a, 0x3e, 0x9d, 0xf6, 0xfa, 0xb0,
+    0xca, 0x05, 0x8c, 0xf2, 0x97, 0xee, 0x9e, 0x15, 0x33, 0x99, 0x12, 0x8d, 0x2c, 0x94, 0x5e, 0x10,
+    0xac, 0xcd, 0x3a, 0x3e, 0xd0, 0x40, 0x08, 0xd9, 0x0f, 0x6b, 0xc2, 0xa1, 0xe8, 0xdc, 0xc2, 0x4f,
+    0x1d, 0x27, 0x7e, 0xd8, 0x7a, 0x5c, 0xf7, 0x83, 0xf3, 0x72, 0x21, 0x0f, 0x73, 0x84, 0x7d, 0xbc,
+    0x5c, 0xa0, 0x93, 0xec, 0xf3, 0x31, 0x74, 0x53, 0x43, 0xaf, 0x94, 0xad, 0xd9, 0xf4, 0x35, 0x41,
+    0x77, 0x23, 0x18, 0xa9, 0x04, 0xda, 0x8b, 0xa6, 0xda, 0xc6, 0x21, 0xaa, 0xa1, 0x33, 0xc2, 0xf4,
+    0xcd, 0x7f, 0x7b, 0x27, 0x22, 0x7e, 0x12, 0xd9, 0x47, 0x30, 0x33, 0xad, 0x4f, 0x79, 0xad, 0xf7,
+    0xaf, 0x75, 0x76, 0xe5, 0xaa, 0xed, 0x8e, 0xcd, 0x6f, 0xfa, 0xde, 0xec, 0xad, 0x87, 0xfa, 0x8c,
+    0xd9, 0x86, 0x40, 0x06, 0xe2, 0x06, 0x2c, 0xad, 0xee, 0xd5, 0x6f, 0xb6, 0xa7, 0x93, 0x0e, 0xf6,
+    0xbb, 0x80, 0xc0, 0x18, 0xf9, 0x9e, 0x11, 0x2e, 0x85, 0xcb, 0x81, 0xa0, 0x07, 0x21, 0x9c, 0x0a,
+    0x97, 0xb6, 0x29, 0x34, 0xf5, 0xa7, 0x18, 0x87, 0x2f, 0x37, 0x59, 0x51, 0x7d, 0xfb, 0xe9, 0x8d,
+    0x7b, 0x15, 0x88, 0xfd, 0x86, 0xa7, 0xc2, 0x92, 0xff, 0x4c, 0x62, 0x15, 0xc3, 0x25, 0xa9, 0x32,
+    0xf0, 0x75, 0x26, 0x84, 0x07, 0x55, 0x79, 0x3a, 0xc6, 0xce, 0x1c, 0x99, 0x78, 0x5d, 0xc5, 0x5f,
+    0x7c, 0x0e, 0xf6, 0x29, 0xd8, 0xf7, 0x0e, 0xfb, 0xe2, 0x0d, 0xca, 0x8d, 0xad, 0xe8, 0xdb, 0x06,
+    0x7d, 0xeb, 0x33, 0xfc, 0x6b, 0x9f, 0xfe, 0xff, 0x67, 0xb8, 0xc7, 0xb4, 0x73, 0x29, 0x7a, 0xff,
+    0xfb, 0x8b, 0x0b, 0x76, 0x8f, 0x6e, 0x28, 0x00, 0xf8, 0x15, 0x5a, 0x7e, 0xc6, 0x01, 0xcc, 0x9e,
+    0xbb, 0x54, 0xcf, 0xa8, 0x72, 0x34, 0xa1, 0x1e, 0x32, 0xd1, 0xb5, 0xf9, 0xae, 0x93, 0x24, 0xed,
+    0xbe, 0x9d, 0xdd, 0x16, 0x71, 0xfd, 0x4b, 0x92, 0x18, 0xa9, 0x90, 0x4e, 0x2a, 0x9e, 0xca, 0x07,
+    0x64, 0x85, 0x02, 0x39, 0x4c, 0x19, 0xdd, 0xb6, 0x91, 0xfd, 0xf6, 0x61, 0x57, 0x79, 0x7b, 0xdb,
+    0x6f, 0xb6, 0x9f, 0x74, 0xb7, 0x98, 0x4d, 0x52, 0xfc, 0x8a, 0xa4, 0xab, 0x00, 0x07, 0x9f, 0xb2,
+    0x67, 0xa1, 0xc3, 0xcb, 0x27, 0x35, 0x33, 0x26, 0x70, 0x55, 0xb1, 0x4e, 0xf4, 0xf7, 0xf7, 0x18,
+    0x7d, 0xd6, 0x28, 0x6c, 0x40, 0x7f, 0x48, 0xfd, 0x47, 0xdc, 0x0b, 0x87, 0xdd, 0x84, 0x0b, 0x7e,
+    0x22, 0xea, 0x3f, 0xc4, 0xdc, 0x54, 0x5e, 0x15, 0xff, 0x4a, 0x2d, 0xad, 0x1a, 0x71, 0x80, 0x86,
+    0xbe, 0x99, 0x8e, 0x6e, 0x5f, 0xb7, 0xc3, 0x6c, 0xe2, 0x73, 0x21, 0x2b, 0x68, 0xbc, 0x31, 0x4a,
+    0x5e, 0x4b, 0xf6, 0x3a, 0x6f, 0x4e, 0x7a, 0x7f, 0x78, 0xa7, 0x9d, 0x70, 0x7a, 0x1e, 0xe9, 0x3c,
+    0x4f, 0x8c, 0x88, 0x55, 0x10, 0x96, 0x03, 0x82, 0x44, 0x0e, 0x90, 0x53, 0x2e, 0x47, 0xda, 0x8a,
+    0x64, 0xaa, 0xcb, 0x9c, 0x92, 0x80, 0x57, 0xe2, 0x57, 0x04, 0xe8, 0xa5, 0x74, 0x4b, 0x4e, 0x06,
+    0x29, 0x9c, 0xa8, 0x2a, 0x48, 0x52, 0x86, 0x01, 0x04, 0xb1, 0xc2, 0xc0, 0x29, 0xd0, 0xea, 0xd7,
+    0x41, 0x53, 0x2a, 0xc2, 0xa3, 0x4f, 0xd9, 0x2b, 0x2c, 0x1b, 0x7b, 0x38, 0xe9, 0xe6, 0xcb, 0xa2,
+    0xf0, 0xdf, 0x0b, 0x9d, 0x2b, 0x44, 0xe0, 0xc5, 0xda, 0x6e, 0x1e, 0xa8, 0x61, 0xbb, 0xc6, 0xc6,
+    0x70, 0x9d, 0xff, 0xc9, 0xeb, 0xe3, 0x5c, 0x1e, 0xaa, 0xf1, 0xeb, 0xef, 0x68, 0xa2, 0x5e, 0x43,
+    0x4a, 0x81, 0x52, 0x9e, 0xd2, 0x95, 0x13, 0x87, 0x9c, 0xc9, 0xde, 0x4d, 0x68, 0x2a, 0x08, 0xe7,
+    0x61, 0xb6, 0x89, 0xd7, 0x8a, 0x82, 0x67, 0xe4, 0xff, 0xe9, 0x40, 0xcc, 0xaf, 0xe5, 0x83, 0xff,
+    0xc7, 0x44, 0x1b, 0x6d, 0xf5, 0x80, 0xd3, 0x24, 0x9c, 0x64, 0x3a, 0x3d, 0xfa, 0x24, 0x11, 0x5e,
+    0xad, 0xe8, 0xb0, 0xcf, 0xbd, 0xf5, 0x2e, 0x2b, 0x5a, 0xbe, 0xf9, 0xbf, 0xfe, 0x17, 0xd1, 0x6c,
+    0x88, 0x77, 0xf0, 0x9a, 0x87, 0xfb, 0xe7, 0xf8, 0xb3, 0x2c, 0xc4, 0xfd, 0xd3, 0x0d, 0xe2, 0xe4,
+    0xdb, 0x76, 0xf3, 0xb1, 0xda, 0xc7, 0x72, 0x22, 0xc9, 0x1e, 0x04, 0xa5, 0x81, 0x0c, 0xbc, 0xe0,
+    0x41, 0xe6, 0x29, 0x20, 0x3e, 0x7b, 0xfe, 0xc8, 0xa1, 0x69, 0x48, 0x7d, 0xa6, 0x87, 0x36, 0x56,
+    0xe2, 0x87, 0x62, 0x84, 0xb2, 0xb8, 0x8d, 0xe2, 0x5e, 0x9b, 0xad, 0x3f, 0xb3, 0xc5, 0xc3, 0xa0,
+    0x94, 0xfb, 0xe8, 0x22, 0xd6, 0xe5, 0xfe, 0xf8, 0x82, 0x3f, 0x3f, 0xd2, 0x57, 0x3a, 0xb9, 0x81,
+    0x76, 0xa3, 0xf4, 0x33, 0x5a, 0xf6, 0x8a, 0x32, 0xe7, 0x6a, 0x3c, 0x88, 0xb7, 0xda, 0x23, 0x53,
+    0x1d, 0xfb, 0x9b, 0xc7, 0x9e, 0x41, 0x9c, 0x85, 0x0e, 0xd1, 0x89, 0x77, 0xf9, 0x50, 0x85, 0x85,
+    0x66, 0x68, 0xae, 0x3b, 0x2e, 0x70, 0x46, 0x59, 0x86, 0xce, 0x60, 0xd2, 0x15, 0x37, 0xe9, 0xce,
+    0xe9, 0x38, 0x62, 0x51, 0x07, 0x4f, 0xee, 0x5e, 0x7b, 0x39, 0xf0, 0xc9, 0x63, 0xc9, 0x62, 0x72,
+    0x3c, 0x8f, 0x36, 0x25, 0x53, 0x86, 0x09, 0xbf, 0x8a, 0x64, 0x32, 0xb0, 0x58, 0x95, 0xab, 0x3a,
+    0x2c, 0x96, 0x4d, 0xcb, 0xc4, 0x62, 0x04, 0x28, 0x79, 0x26, 0x2c, 0x16, 0x76, 0xc1, 0x4e, 0x04,
+    0xdb, 0x39, 0x2f, 0x30, 0x38, 0xa5, 0x5d, 0xd3, 0xde, 0xc9, 0xbb, 0xf1, 0x39, 0xb0, 0x23, 0xbb,
+    0x5a, 0x77, 0xe3, 0xb1, 0x8e, 0x8e, 0x08, 0xca, 0x9f, 0xb4, 0x14, 0x32, 0xb0, 0x6b, 0x6d, 0xd7,
+    0x3d, 0x4a, 0x6a, 0xdd, 0x48, 0x7e, 0x34, 0xdf, 0xb8, 0x1b, 0xe3, 0x99, 0x39, 0xf0, 0xef, 0x53,
+    0x79, 0xa3, 0xda, 0xa8, 0x95, 0x1a, 0x34, 0x9e, 0x31, 0xe8, 0x15, 0xfb, 0x98, 0x8c, 0x3a, 0xfb,
+    0xf6, 0x06, 0x72, 0x06, 0x72, 0x3e, 0x4f, 0xaf, 0x80, 0xa6, 0x44, 0xe0, 0xe4, 0x03, 0x3a, 0x10,
+    0xa0, 0xbb, 0x4a, 0x0e, 0x0c, 0x67, 0x52, 0x2a, 0x67, 0x37, 0xf3, 0xc6, 0xe6, 0x3d, 0x05, 0xe1,
+    0x72, 0x93, 0xe4, 0xa1, 0xda, 0xac, 0x4e, 0xf2, 0x75, 0x83, 0xca, 0xfa, 0x54, 0x86, 0xcb, 0x86,
+    0x21, 0xad, 0x1e, 0xcc, 0x81, 0x5d, 0xa7, 0x9c, 0xb7, 0xb6, 0x63, 0x9f, 0xe6, 0x8b, 0x4f, 0xb1,
+    0x63, 0xd3, 0xda, 0x93, 0x3b, 0xee, 0xc2, 0xf8, 0xbc, 0x77, 0x87, 0x19, 0xd0, 0xac, 0xc2, 0x18,
+    0x4f, 0x7d, 0xf4, 0x0b, 0xfd, 0x9e, 0xdc, 0xd6, 0xeb, 0xcf, 0xec, 0xd7, 0xf7, 0x6f, 0x0f, 0x80,
+    0x2e, 0xbf, 0x85, 0x06, 0xf4, 0x20, 0xe8, 0xae, 0xdb, 0x03, 0x5b, 0x6e, 0x97, 0xc9, 0xa7, 0x0b,
+    0x58, 0x8d, 0xe2, 0xe9, 0xf4, 0xa1, 0x47, 0xe8, 0xb7, 0x30, 0x40, 0xdd, 0xcd, 0x2c, 0xaf, 0xe4,
+    0x35, 0x87, 0x65, 0x22, 0x0d, 0x93, 0xa9, 0x1b, 0x91, 0x07, 0x43, 0x87, 0x1b, 0x79, 0x22, 0xbf,
+    0x61, 0xfd, 0xc3, 0xe5, 0xf8, 0x27, 0x1c, 0x2c, 0x1a, 0x82, 0xd0, 0x18, 0xd5, 0x94, 0x5f, 0x8e,
+    0x64, 0xbd, 0x3b, 0x0d, 0x33, 0x21, 0xe5, 0x9d, 0x63, 0x6f, 0xfd, 0xeb, 0xb2, 0xb3, 0x58, 0xfc,
+    0x10, 0xd2, 0xa6, 0x0a, 0x8d, 0x7e, 0x97, 0xdf, 0xc1, 0xb2, 0x8b, 0xfc, 0x6f, 0x52, 0x0d, 0xd6,
+    0x68, 0x48, 0x73, 0xaf, 0x1f, 0xb5, 0xf3, 0x7b, 0x34, 0x65, 0x3a, 0xf5, 0xa5, 0x1c, 0x61, 0x99,
+    0x1f, 0xaf, 0xa2, 0xfe, 0xb2, 0xe6, 0x93, 0xb5, 0x74, 0x84, 0x5e, 0xaa, 0x4b, 0x8e, 0x0f, 0x25,
+    0x18, 0xce, 0x91, 0x88, 0xac, 0x65, 0xd8, 0xa9, 0x40, 0xad, 0x84, 0x15, 0xc2, 0xf6, 0x24, 0x3c,
+    0x5f, 0xf5, 0x37, 0xdf, 0xd3, 0x01, 0x1e, 0xd2, 0x9c, 0x8f, 0xb1, 0x25, 0xd4, 0x69, 0xf1, 0x45,
+    0xbd, 0x7b, 0x3a, 0x3f, 0xd7, 0xde, 0x1f, 0x4d, 0x31, 0x3d, 0x54, 0x6a, 0xe8, 0x3f, 0x39, 0x6f,
+    0x42, 0x82, 0xf2, 0xab, 0xbb, 0x38, 0x4c, 0x77, 0xed, 0x30, 0x09, 0xfb, 0xce, 0x35, 0xa2, 0xac,
+    0xa1, 0x83, 0x4f, 0x4e, 0xfc, 0x2a, 0x23, 0x7c, 0xe3, 0x83, 0xd5, 0x77, 0x54, 0x30, 0x0a, 0x0f,
+    0x4b, 0x8b, 0x09, 0x31, 0x76, 0x4a, 0x34, 0x0a, 0x5e, 0x5f, 0x6b, 0xc4, 0x99, 0x11, 0x5f, 0x9d,
+    0xe8, 0x34, 0xff, 0xe7, 0x93, 0x32, 0xfd, 0x19, 0x96, 0x42, 0xef, 0x5e, 0xa3, 0xd0, 0xbb, 0xbf,
+    0x6b, 0x07, 0xb9, 0xd2, 0x9d, 0x8a, 0x33, 0xaa, 0xa6, 0x1c, 0x06, 0x06, 0xc2, 0xc7, 0x8f, 0x76,
+    0x1a, 0x1d, 0x48, 0xf0, 0xd9, 0x48, 0xe5, 0x22, 0x78, 0x90, 0x86, 0xcb, 0xfe, 0xf9, 0x42, 0x68,
+    0xb3, 0x46, 0xbe, 0x7e, 0x29, 0x6e, 0x2f, 0xbd, 0x37, 0x44, 0x00, 0xd5, 0xff, 0x65, 0x13, 0x03,
+    0x44, 0x20, 0x00, 0xd9, 0xd5, 0xe5, 0xc8, 0x80, 0xc1, 0x6d, 0xf2, 0xfe, 0x15, 0xf4, 0x55, 0x53,
+    0x5d, 0xe3, 0xfe, 0x29, 0xd6, 0xaf, 0xa5, 0x2c, 0xd1, 0xc9, 0xe0, 0xc1, 0x87, 0xce, 0x19, 0xa3,
+    0x13, 0xc2, 0x00, 0xe2, 0xb8, 0x0f, 0xe5, 0xcf, 0xf7, 0x07, 0x02, 0x82, 0x22, 0xb2, 0x08, 0x1e,
+    0xd8, 0xaf, 0xb8, 0x70, 0xe9, 0x6b, 0x2b, 0xd7, 0x30, 0x5e, 0x5e, 0xc7, 0xb3, 0x33, 0x56, 0x4c,
+    0x8e, 0xf2, 0xa6, 0xf1, 0x0b, 0xde, 0x6b, 0x81, 0xbd, 0xb3, 0x72, 0xe5, 0x34, 0xca, 0xe7, 0x3e,
+    0xc2, 0xdf, 0xda, 0x76, 0xe1, 0xfe, 0x6b, 0x4d, 0xb1, 0x67, 0x47, 0x1e, 0x28, 0x4a, 0xd0, 0xda,
+    0x60, 0xe1, 0x18, 0xb5, 0x32, 0xf1, 0x31, 0xf6, 0x7d, 0xeb, 0xb5, 0xb9, 0xdd, 0xdf, 0x07, 0x0d,
+    0x35, 0x8b, 0x1a, 0x85, 0x0d, 0xe8, 0x0f, 0xa9, 0x5f, 0xdf, 0x1d, 0x05, 0x2c, 0x99, 0x59, 0xbf,
+    0xaa, 0x24, 0x29, 0xb5, 0x63, 0x42, 0xe0, 0xea, 0xad, 0x03, 0x1f, 0x65, 0xce, 0x73, 0x70, 0x2e,
+    0x46, 0x5c, 0xf3, 0xac, 0x0d, 0xaf, 0x7c, 0x4b, 0xa8, 0x67, 0xd7, 0x65, 0x8d, 0x08, 0x38, 0x76,
+    0x3b, 0xad, 0xf2, 0x40, 0x96, 0x84, 0x8e, 0x3b, 0xa5, 0x51, 0xbd, 0xe8, 0x6d, 0x5f, 0x82, 0x15,
+    0x3c, 0xf8, 0x15, 0xc3, 0x40, 0x41, 0x39, 0x5d, 0xba, 0x7c, 0x62, 0xf1, 0x35, 0xd9, 0x1f, 0x35,
+    0xd1, 0xae, 0x15, 0x53, 0x61, 0x14, 0x3f, 0x44, 0x65, 0x73, 0xcd, 0x27, 0x8f, 0x40, 0x9e, 0xfd,
+    0x54, 0x0b, 0x48, 0x6c, 0xfd, 0x32, 0x6e, 0xc5, 0x3a, 0xaa, 0xbc, 0xc4, 0x7f, 0xbe, 0xda, 0x14,
+    0xcf, 0xab, 0xe1, 0x2a, 0xcc, 0xe5, 0x0f, 0xe3, 0xc3, 0xe8, 0xe3, 0x79, 0xca, 0xfb, 0xe3, 0x66,
+    0xa6, 0xd7, 0xeb, 0x1c, 0x4c, 0x20, 0xe1, 0x59, 0xca, 0x6e, 0x28, 0x82, 0x37, 0x0d, 0xc7, 0xb8,
+    0xb4, 0x60, 0x16, 0xf8, 0x01, 0x44, 0x75, 0x25, 0xad, 0xbe, 0xf7, 0xed, 0xe6, 0xf7, 0xb8, 0xbf,
+    0x9f, 0x83, 0xe7, 0x6b, 0x0a, 0xc7, 0x55, 0xb5, 0xf1, 0x84, 0xf8, 0xf9, 0xfe, 0xf2, 0xbb, 0xe9,
+    0x5a, 0x72, 0x7b, 0x10, 0xc9, 0x44, 0x37, 0x30, 0xf4, 0x7e, 0x0d, 0xe9, 0x8c, 0x11, 0x97, 0xb1,
+    0xb9, 0xf8, 0x0c, 0x63, 0xdb, 0xfd, 0xc9, 0x53, 0xed, 0xbe, 0xe9, 0x59, 0x49, 0xe3, 0x78, 0xe8,
+    0x30, 0xe0, 0x55, 0x9b, 0xc6, 0xc2, 0x0f, 0x92, 0x85, 0x94, 0x7c, 0x20, 0x70, 0x92, 0x09, 0x24,
+    0x84, 0x3e, 0x08, 0x37, 0xb8, 0xb9, 0x86, 0xec, 0x1e, 0xd6, 0x23, 0x91, 0xb7, 0x85, 0x39, 0xb1,
+    0x3b, 0xd3, 0xf5, 0x5f, 0xc1, 0x4c, 0xd7, 0x37, 0x00, 0x27, 0x54, 0x6e, 0xa8, 0x72, 0x86, 0xea,
+    0xbc, 0x40, 0x8a, 0xff, 0xd3, 0x40, 0x8c, 0x81, 0xd4, 0x3d, 0x57, 0x6e, 0xa7, 0x56, 0x79, 0x3f,
+    0x33, 0x43, 0xda, 0x3e, 0xd1, 0x8e, 0x58, 0x9a, 0xf8, 0xf8, 0x32, 0xca, 0x46, 0x69, 0x1e, 0xd5,
+    0xb8, 0xed, 0xce, 0xac, 0x98, 0xfe, 0x93, 0xbf, 0xd8, 0x34, 0x8b, 0x16, 0xf2, 0x12, 0x09, 0x97,
+    0xf8, 0x4a, 0xca, 0xef, 0xe1, 0xbb, 0x66, 0xd3, 0x5f, 0xa2, 0x7e, 0x44, 0xfd, 0x88, 0x7a, 0xc5,
+    0xf8, 0x32, 0x1c, 0x90, 0xe5, 0xe1, 0x7d, 0x94, 0xb8, 0x18, 0xb8, 0xb7, 0x09, 0x86, 0x0b, 0x73,
+    0xab, 0x89, 0x3c, 0x8a, 0x52, 0xdc, 0x97, 0xda, 0x93, 0xed, 0xb4, 0xc3, 0x03, 0xc7, 0x9b, 0xed,
+    0x3f, 0xaa, 0xeb, 0x37, 0xde, 0xde, 0x3b, 0xc5, 0x92, 0xfa, 0x9a, 0xf9, 0xfd, 0x3e, 0xe8, 0xf9,
+    0xd8, 0x8d, 0x83, 0x36, 0x17, 0xe7, 0x42, 0x9e, 0x79, 0xb6, 0x15, 0xa8, 0x0b, 0x39, 0x7f, 0x82,
+    0x74, 0xbe, 0x39, 0x43, 0x2f, 0x28, 0x1b, 0x11, 0x99, 0x62, 0xef, 0x25, 0xca, 0xc4, 0x16, 0x43,
+    0x4a, 0x5e, 0xb1, 0x8e, 0x97, 0x18, 0x4d, 0x28, 0x7b, 0x0e, 0xc2, 0x70, 0xd9, 0x13, 0x5c, 0xe9,
+    0xf5, 0x4f, 0x5b, 0xc9, 0x52, 0xbc, 0xe5, 0x6d, 0x91, 0x7a, 0xf7, 0x0d, 0x94, 0x61, 0x5d, 0x92,
+    0x88, 0x9e, 0x09, 0xa5, 0x3b, 0xa4, 0x72, 0x0d, 0x4b, 0x10, 0x8a, 0xf3, 0x92, 0xed, 0x82, 0x70,
+    0xc9, 0x67, 0x4c, 0x04, 0x5c, 0xb8, 0xf7, 0xf3, 0x43, 0x1f, 0x0f, 0x23, 0x50, 0x62, 0xd1, 0x96,
+    0x94, 0x0b, 0xd3, 0x80, 0x74, 0x19, 0x9a, 0x5d, 0xa2, 0xde, 0x8b, 0x4f, 0x99, 0x58, 0x74, 0xd8,
+    0x6a, 0xc8, 0xbc, 0x16, 0x64, 0x2a, 0x6d, 0x33, 0xb5, 0xfa, 0x70, 0x17, 0xa6, 0x1f, 0xc5, 0x4a,
+    0xa8, 0xac, 0xa9, 0xfb, 0x65, 0x0e, 0x6b, 0x10, 0xba, 0xa6, 0x98, 0x8d, 0x94, 0xfd, 0x46, 0xc8,
+    0x38, 0xbf, 0x97, 0x60, 0xf3, 0xc1, 0x30, 0x99, 0xe8, 0x19, 0xfd, 0xdd, 0x62, 0x29, 0x8d, 0xe8,
+    0xdf, 0x4c, 0x4e, 0x19, 0x9f, 0x51, 0xa4, 0x5d, 0x38, 0x5f, 0x4c, 0x83, 0x49, 0xe2, 0x35, 0xf6,
+    0x6f, 0x8e, 0x87, 0x29, 0x2c, 0x06, 0xea, 0xca, 0x84, 0xcc, 0x87, 0xdf, 0xcb, 0xe4, 0xc0, 0xe8,
+    0x74, 0x3d, 0xf9, 0x69, 0x38, 0xb0, 0xa5, 0x7a, 0x94, 0x7c, 0xab, 0x8e, 0xd3, 0x7c, 0x64, 0xd8,
+    0x43, 0x4b, 0x67, 0x90, 0x05, 0x47, 0x68, 0xf3, 0x49, 0xfb, 0xef, 0x33, 0x63, 0x34, 0x4a, 0xe6,
+    0x1a, 0xc2, 0xb2, 0x20, 0x80, 0x1a, 0x89, 0x48, 0x37, 0xcc, 0x9c, 0x4d, 0x3d, 0xc0, 0x66, 0x99,
+    0x30, 0x0b, 0x17, 0x49, 0xde, 0x81, 0x6c, 0x5f, 0x8e, 0x25, 0x74, 0xe9, 0xa1, 0xf5, 0x34, 0x8d,
+    0x93, 0xd7, 0xb6, 0x92, 0x54, 0x35, 0xf6, 0x84, 0x8a, 0x2a, 0x67, 0x10, 0x1d, 0xe0, 0x93, 0x2b,
+    0x12, 0xc1, 0x1e, 0x65, 0x45, 0x51, 0x30, 0x71, 0xd3, 0x62, 0x22, 0x3d, 0x1c, 0x5b, 0x8a, 0xd4,
+    0x5a, 0x83, 0x93, 0x91, 0x3f, 0x0a, 0xc5, 0x77, 0x86, 0x20, 0x20, 0x2d, 0xb6, 0x01, 0x89, 0x0b,
+    0xd0, 0x1e, 0x42, 0x2b, 0xc3, 0xa1, 0x69, 0x8e, 0x3f, 0x27, 0x0b, 0xc7, 0x52, 0x27, 0x0f, 0x20,
+    0xc8, 0x28, 0x01, 0x4a, 0x62, 0xcd, 0x1c, 0x17, 0x31, 0x32, 0x24, 0x4b, 0xde, 0x5b, 0xc9, 0x03,
+    0x86, 0x74, 0x78, 0x7d, 0x3f, 0x04, 0x9a, 0x25, 0xbc, 0xed, 0x21, 0xe3, 0x03, 0x96, 0x50, 0x42,
+    0x53, 0x51, 0x8d, 0x2c, 0x9e, 0x25, 0x92, 0x56, 0x9c, 0x07, 0x5b, 0x2e, 0xe5, 0x07, 0x71, 0x37,
+    0x15, 0x08, 0x56, 0x90, 0x17, 0x29, 0x33, 0xe3, 0xc4, 0xc3, 0x02, 0xcc, 0xea, 0x4c, 0xdb, 0x16,
+    0x1a, 0xdd, 0x0f, 0x76, 0xe0, 0x55, 0x0b, 0x60, 0x0a, 0x72, 0x8f, 0x6a, 0xfa, 0xdc, 0x0b, 0x4d,
+    0x3a, 0xe3, 0x97, 0xa6, 0x10, 0xb9, 0x0b, 0xd4, 0xdd, 0x87, 0x5e, 0x91, 0xbd, 0x92, 0xb4, 0x9c,
+    0xb6, 0x8d, 0x78, 0x3a, 0x28, 0xee, 0x68, 0xbb, 0xfb, 0xd9, 0x04, 0x11, 0x21, 0x03, 0xb5, 0xe9,
+    0x5d, 0xbe, 0xdb, 0xdd, 0xd4, 0x9e, 0x3c, 0x05, 0x18, 0xd6, 0x7c, 0x77, 0x1c, 0xf5, 0x8b, 0x7b,
+    0xb9, 0x4b, 0xd4, 0x59, 0x30, 0x8c, 0x56, 0x79, 0xce, 0x93, 0x55, 0xad, 0x8d, 0x64, 0x96, 0xc9,
+    0x43, 0x6c, 0x50, 0xc0, 0xea, 0x79, 0x1c, 0x71, 0xfe, 0xce, 0x1a, 0xc2, 0x04, 0xaf, 0x49, 0x87,
+    0x7c, 0xeb, 0xa2, 0xff, 0xfa, 0xd5, 0x40, 0x8d, 0xb1, 0xb6, 0x73, 0xce, 0xed, 0x18, 0x4f, 0x20,
+    0x5f, 0x44, 0xfa, 0x1c, 0x9d, 0xc4, 0xe5, 0x3d, 0x06, 0xee, 0xe2, 0x8c, 0x13, 0xa6, 0x62, 0x7e,
+    0x81, 0xea, 0xc6, 0xc2, 0x57, 0x8e, 0x47, 0x9c, 0x42, 0x82, 0x9e, 0x4c, 0x4b, 0x2c, 0x99, 0xf2,
+    0xe4, 0x52, 0x5f, 0x31, 0xc1, 0xd9, 0x08, 0x63, 0x49, 0x17, 0x9a, 0xba, 0x80, 0x80, 0x52, 0x66,
+    0x44, 0x99, 0xd2, 0x8c, 0x97, 0xed, 0x47, 0x12, 0x8d, 0x46, 0x8c, 0x41, 0x48, 0x9e, 0x52, 0xa0,
+    0x2d, 0x3b, 0x81, 0xe2, 0x05, 0xcd, 0xff, 0xec, 0x3e, 0xa9, 0x96, 0xfa, 0x71, 0xf7, 0x3b, 0xd0,
+    0xe9, 0x46, 0x0c, 0x3a, 0x7f, 0x9d, 0x14, 0x1b, 0xc9, 0xc6, 0xd3, 0x4f, 0x7a, 0x5a, 0x1c, 0x68,
+    0xc9, 0x1a, 0x72, 0xdc, 0x01, 0xd4, 0x0a, 0x0a, 0xef, 0x9a, 0x64, 0xaa, 0xb9, 0x07, 0xee, 0x79,
+    0xac, 0xe5, 0xf1, 0xa8, 0x5b, 0x85, 0x18, 0x4e, 0x05, 0x81, 0x8f, 0xef, 0x90, 0x23, 0x2d, 0xa2,
+    0x95, 0x9b, 0xce, 0x7a, 0x82, 0xe1, 0x0e, 0xc4, 0xe7, 0xbe, 0x24, 0xda, 0x89, 0x68, 0xb1, 0xe9,
+    0xf1, 0xce, 0x8f, 0x1a, 0x8f, 0xbf, 0x43, 0x70, 0x02, 0x7e, 0x7c, 0x2d, 0x94, 0xb4, 0x7e, 0x30,
+    0x3d, 0xcd, 0x94, 0x2e, 0x3c, 0xca, 0x08, 0xc7, 0x8e, 0x29, 0xb2, 0xb5, 0xe2, 0xfb, 0x95, 0x57,
+    0xb4, 0xfe, 0xf8, 0x65, 0xc2, 0x22, 0x42, 0xda, 0x9c, 0xbd, 0xfa, 0x9d, 0x18, 0xe1, 0xf9, 0x19,
+    0xe9, 0x5d, 0xa5, 0x4a, 0x5c, 0x19, 0x45, 0xe6, 0xb4, 0x62, 0x15, 0x98, 0x65, 0x71, 0x11, 0x43,
+    0xba, 0x83, 0xeb, 0x23, 0xe3, 0xe1, 0x9e, 0x7d, 0xa6, 0x60, 0x69, 0xa8, 0x52, 0xe8, 0x49, 0xd9,
+    0xe9, 0xe3, 0x4d, 0x6a, 0x00, 0x0e, 0x93, 0x28, 0x28, 0x90, 0x99, 0xb9, 0x35, 0x13, 0x8a, 0x6c,
+    0x33, 0x22, 0xc4, 0x3c, 0x4d, 0xba, 0x4e, 0xa4, 0xf5, 0x19, 0xd9, 0x9d, 0xc7, 0x4d, 0xe5, 0x09,
+    0x40, 0xe5, 0x5d, 0x02, 0x12, 0xa3, 0x6a, 0xc8, 0x6b, 0xa6, 0x54, 0x54, 0xe6, 0xec, 0x08, 0xb4,
+    0x61, 0xa4, 0x15, 0x4f, 0xb6, 0xd1, 0x23, 0x42, 0x4f, 0xbf, 0xdd, 0x9d, 0xd9, 0x72, 0xd5, 0x4c,
+    0xbf, 0x94, 0x58, 0xb2, 0x24, 0xab, 0x3f, 0xb5, 0x40, 0xac, 0x25, 0x7a, 0x6d, 0xd9, 0xd8, 0xf2,
+    0x76, 0x3e, 0xf0, 0xa0, 0x8d, 0x24, 0x54, 0x49, 0xcb, 0x43, 0x9d, 0xf3, 0x0b, 0xfe, 0xca, 0x27,
+    0x8f, 0x94, 0xed, 0x0c, 0xec, 0xff, 0x24, 0x4e, 0xb4, 0x55, 0xb8, 0xa6, 0x04, 0xcc, 0x63, 0x3c,
+    0xc6, 0x93, 0xbd, 0xfc, 0x9b, 0x3c, 0x30, 0x68, 0x17, 0xe1, 0xe0, 0x21, 0x2b, 0x78, 0xfe, 0x2e,
+    0xf9, 0x91, 0xe0, 0xe9, 0x4c, 0x58, 0x8e, 0x5c, 0xc4, 0xb1, 0x9a, 0x76, 0xa1, 0x64, 0x0f, 0xc5,
+    0x3a, 0xf9, 0xdd, 0x1d, 0x70, 0x22, 0xb1, 0x83, 0x83, 0xb5, 0xb8, 0x19, 0x22, 0xb5, 0x79, 0xc0,
+    0x24, 0x7f, 0xdb, 0x39, 0x6e, 0xb9, 0xc4, 0xd0, 0xc6, 0x8e, 0x9f, 0x2a, 0xb1, 0xc5, 0xc3, 0x71,
+    0x0b, 0x22, 0xa4, 0xa7, 0x15, 0xb6, 0x0e, 0x5a, 0x0f, 0xba, 0x28, 0x0f, 0x63, 0x9b, 0x84, 0x6a,
+    0x3f, 0x43, 0xb2, 0x39, 0x3f, 0x20, 0x7b, 0xc2, 0x40, 0x4b, 0xd2, 0xa7, 0xb9, 0x47, 0x6f, 0x01,
+    0x79, 0x24, 0xa4, 0x3e, 0xef, 0xc0, 0xcf, 0xc1, 0x29, 0x5c, 0x68, 0xc5, 0xfd, 0x4b, 0xa8, 0x33,
+    0x29, 0x7a, 0x11, 0x11, 0xe2, 0x6a, 0xcb, 0x9d, 0xed, 0x21, 0xef, 0x46, 0x09, 0x0a, 0xb0, 0x77,
+    0xe9, 0x8d, 0xe4, 0x8a, 0xea, 0x85, 0x9e, 0x8c, 0x0e, 0xc9, 0xa0, 0xe0, 0xea, 0x58, 0xe6, 0x53,
+    0xd8, 0xd9, 0x24, 0x86, 0xc4, 0x30, 0xf9, 0x4d, 0x8d, 0x11, 0x16, 0x63, 0x5a, 0xf8, 0xa9, 0xc3,
+    0xd6, 0x04, 0x4b, 0xb0, 0x45, 0xf0, 0x3a, 0xe7, 0x48, 0x5b, 0xb9, 0x84, 0x82, 0x8f, 0x7d, 0x85,
+    0xc6, 0x05, 0x8f, 0x24, 0xb9, 0xe6, 0x35, 0x7e, 0x49, 0x4c, 0xea, 0xf2, 0x9a, 0x83, 0x9e, 0xd1,
+    0x5e, 0x85, 0xe7, 0x03, 0xcc, 0x6d, 0x1a, 0xd3, 0xa5, 0x08, 0xb6, 0xe9, 0xd1, 0xd4, 0x54, 0xcf,
+    0x70, 0x5a, 0x20, 0x31, 0xad, 0x59, 0x5d, 0x1f, 0x51, 0x72, 0x39, 0x13, 0xac, 0x7a, 0x85, 0xcc,
+    0xad, 0x12, 0x89, 0xe7, 0x1a, 0xab, 0x62, 0xa2, 0xf1, 0xef, 0x54, 0x2c, 0x5c, 0x8f, 0xaa, 0x48,
+    0x08, 0x39, 0x30, 0x5e, 0x8d, 0x0e, 0x0c, 0x0c, 0x59, 0x0b, 0x17, 0x0c, 0x9b, 0x5a, 0x0f, 0xa6,
+    0xa6, 0x70, 0xb7, 0xd6, 0x4b, 0xfd, 0xfc, 0xda, 0x8a, 0xe5, 0x02, 0x54, 0x78, 0x91, 0xc2, 0x15,
+    0x51, 0xac, 0x4c, 0x32, 0x54, 0x25, 0xb2, 0xad, 0x49, 0x5b, 0x16, 0xae, 0xef, 0xc8, 0xc0, 0xfe,
+    0x8b, 0x94, 0xb0, 0x58, 0xae, 0x0a, 0xdd, 0xca, 0x16, 0xe6, 0x02, 0xad, 0x50, 0x78, 0x01, 0xa6,
+    0x36, 0xca, 0x56, 0x31, 0x85, 0x02, 0x9f, 0x70, 0xf3, 0x5b, 0x35, 0x72, 0x1c, 0xae, 0x95, 0xf1,
+    0xc2, 0x4a, 0x89, 0xbe, 0x6a, 0xc8, 0xe1, 0x88, 0xb1, 0xfc, 0x7d, 0x2f, 0xe9, 0x57, 0x85, 0xf6,
+    0xab, 0xb8, 0x62, 0x24, 0x89, 0x3c, 0x93, 0x2c, 0x97, 0x4c, 0xdd, 0x95, 0x65, 0xed, 0xaa, 0xec,
+    0xe0, 0x17, 0x5d, 0xda, 0x13, 0x65, 0xe5, 0x64, 0xa1, 0xe8, 0x57, 0x4b, 0xa7, 0x27, 0xc0, 0x99,
+    0x3e, 0x7a, 0x3f, 0x94, 0x70, 0xae, 0x71, 0xde, 0x72, 0x36, 0xd4, 0xdc, 0x9e, 0x97, 0x3c, 0xe6,
+    0x02, 0x5f, 0x95, 0x42, 0x7d, 0x28, 0xc2, 0x94, 0x39, 0x03, 0x24, 0xe7, 0x51, 0x52, 0x8e, 0x78,
+    0x43, 0x1c, 0xb5, 0x6f, 0x09, 0xbf, 0x7a, 0x70, 0x66, 0xb0, 0x3e, 0x71, 0x3b, 0x27, 0x29, 0x98,
+    0x75, 0x4c, 0x85, 0xe8, 0xc8, 0xc6, 0x52, 0x51, 0x66, 0x20, 0x6a, 0x35, 0x64, 0xd2, 0x0b, 0x5b,
+    0x42, 0xc5, 0xbb, 0x93, 0xac, 0x78, 0x9b, 0xab, 0xbc, 0x35, 0xf2, 0x9a, 0x33, 0xed, 0x8c, 0x18,
+    0x1b, 0xfc, 0xaa, 0x3e, 0x32, 0x48, 0x05, 0x5e, 0x37, 0xce, 0xa4, 0xdf, 0x5e, 0x00, 0x1d, 0x89,
+    0xf8, 0xa4, 0xaa, 0x01, 0xa2, 0x30, 0x03, 0x78, 0xc0, 0x6f, 0x8c, 0x8e, 0x8d, 0x2d, 0xf5, 0x7c,
+    0xe4, 0xf1, 0x05, 0xd3, 0xb8, 0x74, 0x7e, 0x25, 0x46, 0xf5, 0xd2, 0xbf, 0x48, 0x10, 0x15, 0xd1,
+    0xf2, 0x0c, 0x31, 0x22, 0xed, 0x95, 0xb6, 0x0d, 0x5a, 0x00, 0x2c, 0xa2, 0x16, 0x11, 0xb0, 0x15,
+    0x11, 0x07, 0xe6, 0x2b, 0x57, 0x86, 0xaf, 0xdd, 0x14, 0xf1, 0xa8, 0xb5, 0x6e, 0x83, 0x65, 0xd1,
+    0x46, 0x89, 0x5a, 0xb5, 0x4e, 0x81, 0x76, 0xc9, 0x49, 0xed, 0xdf, 0x1b, 0x06, 0x06, 0x73, 0xed,
+    0x5e, 0x6d, 0x30, 0xc2, 0x4e, 0x35, 0xb9, 0xaf, 0x97, 0x31, 0xcf, 0x36, 0x9f, 0x3a, 0x40, 0xc9,
+    0x97, 0x29, 0x10, 0x79, 0x1c, 0xd8, 0x24, 0xb2, 0xe3, 0x1d, 0xac, 0x13, 0x79, 0x0b, 0x57, 0xae,
+    0xbb, 0x68, 0xb5, 0xeb, 0xdb, 0x7c, 0x8c, 0xb9, 0xa6, 0xbc, 0x2e, 0x41, 0xe6, 0x8a, 0x21, 0x07,
+    0xbe, 0xa4, 0xfe, 0x4d, 0x97, 0xa8, 0xae, 0xcd, 0x39, 0x50, 0xe9, 0x9b, 0xa6, 0x8f, 0xe3, 0xaf,
+    0x65, 0xe7, 0x33, 0x26, 0x99, 0x0f, 0x2f, 0x5b, 0xe7, 0xc6, 0xff, 0x94, 0x1d, 0x48, 0xf7, 0x0d,
+    0x48, 0x6d, 0x5d, 0xce, 0x8d, 0x36, 0x87, 0xa3, 0x2b, 0x1f, 0xf6, 0xf6, 0xbf, 0x4e, 0x3e, 0x4c,
+    0x15, 0x3b, 0x2f, 0x97, 0xd4, 0x99, 0x7e, 0x3b, 0x61, 0x29, 0x15, 0x8b, 0xa7, 0x05, 0x00, 0x44,
+    0xbf, 0xe4, 0x7e, 0x2d, 0x3b, 0x67, 0xfd, 0x33, 0x63, 0xc7, 0xb3, 0x8b, 0x25, 0x85, 0xd1, 0xb0,
+    0xb3, 0xc4, 0xb3, 0xa3, 0x30, 0x43, 0xc1, 0x0d, 0x10, 0x4c, 0x05, 0x66, 0x85, 0xb6, 0x03, 0x1f,
+    0x7c, 0x96, 0x76, 0x41, 0x0c, 0x37, 0x44, 0x7e, 0x74, 0x50, 0xc4, 0xb6, 0xa4, 0xfa, 0xae, 0x82,
+    0xfc, 0x64, 0x27, 0x9f, 0x6d, 0x60, 0x3c, 0x21, 0x2f, 0x52, 0x24, 0xec, 0x9f, 0xa2, 0x9a, 0x29,
+    0x78, 0xda, 0xba, 0xf9, 0xab, 0xd4, 0x5f, 0xc9, 0x91, 0xf8, 0xb6, 0xb6, 0x7f, 0xd6, 0x10, 0xb6,
+    0xfc, 0xa1, 0x19, 0xc5, 0xc0, 0x4f, 0xa2, 0x23, 0xfc, 0x5d, 0x8f, 0x45, 0x12, 0x0a, 0xd9, 0x53,
+    0x06, 0x44, 0x9c, 0xbf, 0x6c, 0xd1, 0xc2, 0x65, 0x0b, 0xfd, 0xbe, 0x17, 0x0a, 0xf4, 0xf3, 0x8f,
+    0x77, 0x32, 0x29, 0x77, 0xc6, 0x54, 0x09, 0x80, 0x9c, 0x15, 0x92, 0xee, 0x67, 0x12, 0x98, 0x7b,
+    0x65, 0xfd, 0x4a, 0xa6, 0x9b, 0xf9, 0xb7, 0x86, 0xb8, 0xd9, 0x47, 0xad, 0x5a, 0xc2, 0xba, 0x9e,
+    0x67, 0xac, 0x34, 0x96, 0xde, 0xff, 0x28, 0xea, 0x06, 0xc6, 0x22, 0xed, 0x71, 0x7a, 0xb1, 0xdd,
+    0xae, 0xf8, 0xa2, 0xac, 0x08, 0xe3, 0xae, 0x43, 0xef, 0xea, 0x2a, 0x2f, 0xee, 0xae, 0xa5, 0xdd,
+    0xbd, 0xf7, 0x28, 0x2d, 0xd9, 0x19, 0x53, 0x7c, 0x80, 0x02, 0x30, 0x6a, 0x82, 0xa7, 0x7c, 0xc8,
+    0x13, 0x1d, 0x42, 0x66, 0x64, 0xa9, 0xab, 0xb4, 0xf8, 0x7e, 0x58, 0x62, 0x4c, 0xc6, 0x71, 0x9e,
+    0xb0, 0x30, 0xef, 0xa9, 0xf8, 0xce, 0xab, 0xdb, 0x58, 0x6d, 0x76, 0xa0, 0xc3, 0x95, 0x2b, 0x08,
+    0xdd, 0x26, 0x7c, 0x07, 0x02, 0x99, 0x98, 0xe4, 0x23, 0x0b, 0xd8, 0x6a, 0x9e, 0x93, 0x22, 0xca,
+    0x30, 0x72, 0xa9, 0xf1, 0x5c, 0x22, 0x07, 0x38, 0xb7, 0xf1, 0xc9, 0xd7, 0xd6, 0x1c, 0x22, 0x07,
+    0xb1, 0x34, 0x9c, 0x54, 0xb5, 0xa4, 0x4e, 0x66, 0x8b, 0x98, 0xfc, 0x3b, 0x96, 0xe8, 0x39, 0xbe,
+    0x73, 0xa3, 0x02, 0xae, 0x30, 0xd0, 0x55, 0xa8, 0x63, 0x97, 0x17, 0xd6, 0xad, 0x62, 0x12, 0xf4,
+    0x95, 0x09, 0x6a, 0x9a, 0x24, 0xaf, 0x61, 0x91, 0xc3, 0x70, 0x98, 0x4f, 0x69, 0x01, 0xdb, 0xaa,
+    0x0b, 0xd8, 0x80, 0xe9, 0xfc, 0xce, 0xc4, 0x9f, 0xe7, 0x25, 0x97, 0xeb, 0x00, 0x83, 0x6b, 0x6c,
+    0x3c, 0xc0, 0x2f, 0x14, 0x64, 0xe9, 0xf7, 0x95, 0x84, 0xcd, 0xf4, 0xbe, 0x0f, 0x52, 0x9c, 0x49,
+    0xa5, 0x92, 0x4c, 0x11, 0x1e, 0x7a, 0x4b, 0x01, 0x9d, 0x85, 0xa4, 0xbe, 0xd3, 0xed, 0x82, 0x25,
+    0x7e, 0x29, 0x0a, 0x9d, 0x77, 0x9a, 0xe0, 0x47, 0xb3, 0x2f, 0x35, 0x59, 0x96, 0x14, 0x5a, 0xb0,
+    0x07, 0xe4, 0x12, 0xcb, 0xb1, 0x77, 0x40, 0xdb, 0x0d, 0xc9, 0xb6, 0xa2, 0xb1, 0x5a, 0x20, 0x33,
+    0x88, 0x55, 0xa3, 0xfb, 0x46, 0xe7, 0x30, 0x05, 0xc5, 0x0f, 0xc1, 0xba, 0xe7, 0x6a, 0x93, 0xd7,
+    0x43, 0x77, 0x9a, 0x7a, 0x68, 0x4a, 0xb5, 0x5e, 0x43, 0xe5, 0x1e, 0xe4, 0x32, 0x7d, 0x7e, 0xf4,
+    0xd3, 0x70, 0xf8, 0xd1, 0x98, 0xe0, 0x99, 0x9f, 0xa1, 0x4c, 0xfc, 0x96, 0x29, 0x2b, 0xbd, 0xa5,
+    0x33, 0xec, 0x7c, 0x66, 0x32, 0xb3, 0xc1, 0x4e, 0xaf, 0xce, 0xa6, 0xe5, 0x3c, 0x25, 0x34, 0xc9,
+    0xec, 0xa9, 0xac, 0x84, 0x59, 0xcc, 0x7e, 0x06, 0x4f, 0x8d, 0x69, 0xe5, 0x2d, 0x1e, 0x9f, 0xcc,
+    0xe4, 0x34, 0x21, 0xc9, 0x23, 0xea, 0xb9, 0xc7, 0x77, 0xd4, 0x5f, 0xda, 0xe9, 0xfd, 0xe5, 0x5a,
+    0x5f, 0xb2, 0x29, 0x7b, 0x6d, 0x4e, 0x1e, 0xf8, 0x99, 0xcc, 0xb7, 0x7e, 0x61, 0x76, 0x72, 0x1a,
+    0x88, 0xd0, 0xc3, 0x85, 0x3c, 0x64, 0xf3, 0xe5, 0xf8, 0xce, 0x2f, 0x2f, 0xaf, 0xc9, 0x6b, 0x5b,
+    0x43, 0xef, 0x35, 0x3b, 0xb6, 0x6a, 0x9a, 0xe2, 0xdd, 0x26, 0xfc, 0x1f, 0xd8, 0xce, 0xbc, 0x58,
+    0x7d, 0xf5, 0x28, 0xe9, 0xc6, 0x41, 0x55, 0xfc, 0xbd, 0x8f, 0xee, 0x34, 0x12, 0x47, 0xba, 0x4b,
+    0x60, 0x02, 0x77, 0x9e, 0x08, 0x61, 0x05, 0xeb, 0x10, 0x24, 0x7a, 0xf9, 0x22, 0xd0, 0xa4, 0x49,
+    0x40, 0x58, 0x7b, 0xca, 0x06, 0xda, 0xb6, 0xf6, 0xc7, 0x2c, 0x06, 0x1e, 0xb3, 0xd2, 0x4a, 0x2b,
+    0xeb, 0xd8, 0x61, 0x74, 0x7d, 0xbf, 0x18, 0x6d, 0x9e, 0x70, 0x74, 0x46, 0xb7, 0xcc, 0x58, 0x36,
+    0x2f, 0x93, 0x54, 0xd7, 0xec, 0x2c, 0xb1, 0xbc, 0xe8, 0x6d, 0x8d, 0xba, 0x39, 0xda, 0x19, 0x2f,
+    0x9e, 0x64, 0x0f, 0x7b, 0xe5, 0xb8, 0x21, 0x75, 0x85, 0xe9, 0xe5, 0xe7, 0x3f, 0x9d, 0xf4, 0x96,
+    0x54, 0x67, 0xbf, 0x7c, 0x2d, 0xc2, 0x36, 0x93, 0x44, 0x8c, 0x36, 0x91, 0x91, 0x30, 0xf9, 0x11,
+    0x95, 0x9e, 0x7e, 0x16, 0xde, 0x64, 0xbf, 0x98, 0x50, 0xaf, 0xa0, 0x52, 0xc0, 0x5c, 0xba, 0x84,
+    0x28, 0x32, 0x91, 0x6b, 0x77, 0x43, 0x87, 0x1b, 0xde, 0x89, 0x55, 0x32, 0xf8, 0x83, 0x88, 0xb4,
+    0xa3, 0xa5, 0x64, 0x1e, 0xc0, 0xda, 0x0e, 0x91, 0xd1, 0x4d, 0x58, 0x27, 0x99, 0x3d, 0xed, 0xde,
+    0xf3, 0xa2, 0x29, 0x2f, 0x2e, 0x1f, 0x09, 0x42, 0xf5, 0xd7, 0x2a, 0xc3, 0x54, 0x1d, 0x1b, 0x0a,
+    0x09, 0x1c, 0x16, 0x71, 0x42, 0x6f, 0x63, 0xae, 0x20, 0x36, 0x78, 0xa2, 0x96, 0xca, 0x83, 0x7d,
+    0x06, 0x4a, 0x73, 0x5a, 0x75, 0xbf, 0x83, 0xe9, 0x66, 0x83, 0x5e, 0xcf, 0x51, 0xc7, 0xde, 0xd1,
+    0x43, 0x64, 0x92, 0xc9, 0x5b, 0x1a, 0xa2, 0x07, 0xd3, 0xe7, 0x59, 0xec, 0xbd, 0xb5, 0x37, 0xc1,
+    0x93, 0x2f, 0x37, 0x6a, 0x73, 0xb0, 0xcf, 0x68, 0x79, 0x9d, 0x3c, 0x56, 0x44, 0xce, 0x93, 0x97,
+    0x4e, 0xe9, 0x89, 0x7a, 0x78, 0xd8, 0x03, 0xa9, 0x6f, 0xc2, 0x26, 0x5f, 0xfa, 0x9e, 0xf6, 0xd4,
+    0xa3, 0x44, 0xfb, 0x3f, 0x9c, 0x0f, 0xb2, 0xa2, 0x57, 0xce, 0xd3, 0x57, 0xcc, 0xdd, 0x10, 0x6e,
+    0x3b, 0x12, 0x7a, 0x07, 0xdc, 0xd6, 0xad, 0x13, 0xf1, 0x14, 0x8c, 0x7d, 0x24, 0xe6, 0x73, 0x2a,
+    0x9c, 0x84, 0x66, 0x2c, 0xc4, 0x42, 0x83, 0x09, 0x4d, 0x48, 0x72, 0x3b, 0x17, 0xa3, 0x87, 0x01,
+    0x53, 0x98, 0xbb, 0xb4, 0xce, 0x4a, 0xfa, 0x5a, 0x3c, 0x2d, 0x12, 0xbb, 0x7f, 0x85, 0xe3, 0x6a,
+    0xa1, 0xb9, 0x54, 0x41, 0x2b, 0x8f, 0x45, 0x5c, 0xeb, 0xf4, 0x28, 0x85, 0x0c, 0x3e, 0x53, 0x91,
+    0x95, 0x6a, 0xea, 0xb8, 0x10, 0x67, 0x2c, 0x5e, 0x70, 0x9e, 0xb9, 0x80, 0x3c, 0x32, 0xdd, 0x58,
+    0x49, 0xb0, 0xb0, 0x15, 0xbc, 0x5d, 0x99, 0x84, 0x76, 0x6e, 0xfb, 0x58, 0xe8, 0x53, 0x93, 0xb9,
+    0x3c, 0x94, 0x44, 0xc1, 0x5f, 0x92, 0x02, 0x6a, 0xd1, 0x4a, 0x30, 0x72, 0x6d, 0x7f, 0xe7, 0x73,
+    0xc9, 0x65, 0x93, 0x69, 0xdd, 0x3e, 0x3f, 0xdb, 0x4c, 0x3e, 0xc7, 0x1a, 0x85, 0x17, 0x2b, 0xcb,
+    0xd6, 0xba, 0x1b, 0xff, 0x30, 0x16, 0x42, 0xcf, 0x0c, 0xf8, 0xea, 0xd5, 0x43, 0xc1, 0xe5, 0x22,
+    0x5b, 0x2a, 0x7f, 0xe2, 0x9a, 0xaf, 0xb7, 0xc2, 0x84, 0x36, 0x13, 0xdc, 0x00, 0x84, 0x19, 0x77,
+    0x4c, 0x34, 0xc1, 0x97, 0x56, 0xca, 0x3c, 0xf3, 0xd2, 0xb2, 0x49, 0x95, 0xd6, 0x84, 0x7f, 0x2f,
+    0xd9, 0x0b, 0x5a, 0x48, 0x2e, 0xbc, 0xa5, 0xa7, 0x5d, 0x5c, 0x37, 0xd7, 0x8c, 0xcd, 0x47, 0x6c,
+    0x63, 0xc8, 0x85, 0x33, 0x44, 0x50, 0x02, 0x3d, 0xcd, 0xf9, 0x9e, 0x64, 0x56, 0x23, 0xfb, 0x00,
+    0x9a, 0xf9, 0x31, 0xc5, 0x32, 0x01, 0x28, 0xc7, 0x1e, 0x75, 0x63, 0x9c, 0x69, 0x05, 0xa0, 0x20,
+    0xc8, 0xac, 0x51, 0x94, 0xd4, 0x93, 0x50, 0x06, 0xf4, 0x15, 0x7d, 0x3f, 0x69, 0xc3, 0xb3, 0xa0,
+    0x85, 0xf3, 0xee, 0xad, 0xd4, 0x83, 0xdc, 0x85, 0xc7, 0xe9, 0x7f, 0x27, 0x7c, 0xe8, 0x75, 0x51,
+    0x74, 0xad, 0x09, 0x46, 0xd6, 0xeb, 0x5c, 0xac, 0xdc, 0x03, 0x23, 0xd4, 0x92, 0x8e, 0xfd, 0x07,
+    0xa6, 0x25, 0x36, 0xcb, 0xda, 0x0f, 0x71, 0xa4, 0x0a, 0x57, 0x8b, 0xa2, 0x65, 0xf3, 0x21, 0xb6,
+    0xb0, 0x39, 0x3b, 0xe9, 0x08, 0x05, 0xad, 0x37, 0x8c, 0xf4, 0x30, 0x51, 0x5f, 0x27, 0x06, 0xd2,
+    0x8a, 0x07, 0x05, 0x59, 0xd7, 0x40, 0x9e, 0x17, 0xfa, 0xe9, 0xf9, 0x21, 0x27, 0x1c, 0xab, 0xa7,
+    0x40, 0x11, 0xbe, 0xd0, 0xa5, 0x68, 0xf1, 0x4f, 0xcf, 0xce, 0x9c, 0xfd, 0x14, 0xc2, 0xab, 0x3e,
+    0xec, 0xcd, 0x5c, 0x7d, 0xed, 0x7b, 0x7a, 0xa0, 0x9b, 0x8a, 0x58, 0xf0, 0x26, 0x6f, 0x73, 0xc3,
+    0x7c, 0xca, 0x1c, 0xb0, 0x4c, 0x8c, 0x2c, 0x97, 0xbb, 0xa6, 0x76, 0x27, 0xcb, 0x20, 0x63, 0xfe,
+    0x74, 0x3c, 0x59, 0x8f, 0x20, 0x3b, 0x37, 0x1a, 0x8a, 0xfe, 0x8f, 0xa4, 0x49, 0xca, 0x49, 0xee,
+    0x62, 0x52, 0x0b, 0xc6, 0x7f, 0xb1, 0x54, 0xe4, 0xca, 0x8e, 0xc7, 0x38, 0x61, 0x7f, 0x31, 0xce,
+    0x45, 0x90, 0x1f, 0xe0, 0x96, 0xb4, 0x94, 0x25, 0x35, 0x76, 0x29, 0x7c, 0x29, 0x31, 0xcc, 0x5d,
+    0xb0, 0x54, 0x37, 0x71, 0x15, 0x90, 0x26, 0xd6, 0x40, 0xeb, 0x5c, 0x21, 0xbb, 0xa3, 0xac, 0x0c,
+    0x98, 0xbf, 0x8b, 0x8b, 0xae, 0xbe, 0x95, 0x67, 0xa8, 0xe7, 0xfb, 0xa0, 0x61, 0xd4, 0x97, 0x12,
+    0x61, 0x35, 0x5b, 0x1b, 0x5c, 0x27, 0x8c, 0xae, 0x12, 0x80, 0x81, 0xa3, 0x1b, 0x06, 0xae, 0x61,
+    0xa7, 0xd0, 0xa3, 0xd7, 0xf5, 0xb2, 0xc9, 0x6a, 0xf1, 0xde, 0x4d, 0x85, 0xe2, 0xb0, 0xa7, 0xdd,
+    0x1f, 0x77, 0x3a, 0x67, 0xe3, 0x7b, 0x9e, 0x47, 0xcf, 0x05, 0xdb, 0xad, 0x17, 0x10, 0x14, 0xa1,
+    0x5c, 0xbe, 0xfe, 0x48, 0xc0, 0xa9, 0xd8, 0xe3, 0xfa, 0x1a, 0x3b, 0xdc, 0x6c, 0xff, 0x6b, 0x9a,
+    0xeb, 0x4e, 0x0d, 0x06, 0x3c, 0x6d, 0xb6, 0x86, 0xb2, 0xb4, 0xb9, 0xa0, 0x23, 0xa1, 0x91, 0x17,
+    0x31, 0x54, 0x4a, 0xc0, 0x70, 0x3b, 0x10, 0x53, 0xdc, 0x4e, 0x82, 0x65, 0xb8, 0x98, 0xb4, 0xa4,
+    0xe5, 0x2f, 0x51, 0xcc, 0x49, 0x18, 0x92, 0x62, 0xfb, 0x5d, 0x89, 0xba, 0x9c, 0x88, 0x5a, 0xc2,
+    0x20, 0x34, 0xc3, 0xbb, 0x64, 0xad, 0x1d, 0x6d, 0xcd, 0xf9, 0x5d, 0x2a, 0x08, 0xff, 0xd2, 0x0f,
+    0xbf, 0x2e, 0xbe, 0xf6, 0xc6, 0x96, 0xe3, 0xea, 0x07, 0xef, 0xaf, 0x26, 0x2a, 0xb1, 0x08, 0x84,
+    0xa7, 0xbc, 0xc2, 0xfd, 0x5b, 0x94, 0x2d, 0xec, 0x55, 0xb0, 0x59, 0x2e, 0x6d, 0x96, 0xa0, 0xd6,
+    0xca, 0x9f, 0x5d, 0xbe, 0x85, 0x7e, 0xf1, 0xff, 0x6b, 0x2d, 0x16, 0xa1, 0xaf, 0xc3, 0x51, 0xa5,
+    0xc3, 0xb9, 0x4f, 0x5b, 0x7e, 0x26, 0xb8, 0x96, 0x0f, 0x7e, 0xa7, 0x45, 0x19, 0xeb, 0xb4, 0xc1,
+    0x1c, 0x73, 0xf9, 0x69, 0x82, 0x0f, 0xcc, 0x44, 0xb2, 0x80, 0xe2, 0x21, 0x7e, 0xdf, 0x2d, 0x33,
+    0xb5, 0xcd, 0x34, 0xbf, 0x59, 0x52, 0x99, 0x6a, 0xdc, 0x0c, 0x7e, 0x8e, 0x6b, 0x34, 0xa4, 0xe3,
+    0x3b, 0xd1, 0x06, 0xa7, 0xd5, 0x2c, 0x5e, 0xa3, 0xad, 0x36, 0xab, 0xb2, 0xc9, 0x46, 0x8c, 0xee,
+    0xdc, 0xb1, 0x30, 0xc4, 0xdc, 0x73, 0x9e, 0x42, 0x3e, 0x5d, 0x62, 0xc5, 0x43, 0x87, 0x6c, 0x7d,
+    0xe8, 0x18, 0x25, 0xfe, 0x71, 0x4b, 0x54, 0xe3, 0x69, 0xce, 0x55, 0x7d, 0x27, 0xe6, 0x41, 0xa8,
+    0xba, 0xe6, 0x8c, 0xf7, 0x47, 0x4e, 0x37, 0x0f, 0x4e, 0xb7, 0xcf, 0x43, 0xb7, 0xe5, 0x70, 0x28,
+    0xaa, 0x55, 0x69, 0xd5, 0x34, 0xda, 0x10, 0x5d, 0x93, 0xe2, 0x85, 0x9d, 0x77, 0x21, 0xfc, 0x30,
+    0x50, 0x43, 0x72, 0x97, 0x2e, 0xb8, 0x3e, 0xe4, 0x6a, 0xb1, 0x74, 0xa0, 0xf5, 0x1d, 0xa2, 0xe5,
+    0xe7, 0x73, 0x69, 0xfd, 0x4d, 0x7f, 0xb2, 0xa5, 0x6c, 0xde, 0x56, 0xdf, 0x8f, 0x47, 0x7a, 0xd0,
+    0xe5, 0x1a, 0x42, 0x33, 0x7d, 0x2f, 0xbf, 0xb8, 0x52, 0x2a, 0xb9, 0xf9, 0x6a, 0x78, 0x42, 0xdd,
+    0x7e, 0x4b, 0xc4, 0xd0, 0x9f, 0x6f, 0x88, 0x94, 0x47, 0x56, 0x26, 0x27, 0x00, 0xcc, 0x0d, 0x8e,
+    0xc8, 0x75, 0xc5, 0xec, 0x03, 0xa1, 0xc9, 0x79, 0xf1, 0x7c, 0x28, 0x85, 0xf6, 0x07, 0x72, 0x12,
+    0xa4, 0xce, 0x49, 0x13, 0xa1, 0x58, 0x77, 0x38, 0x59, 0x47, 0x9f, 0x9c, 0x2f, 0x97, 0x3c, 0x80,
+    0x7c, 0x0f, 0x41, 0xc5, 0xe4, 0x6a, 0x66, 0xc7, 0x39, 0xaf, 0x69, 0x5c, 0x74, 0xde, 0xf3, 0xbe,
+    0x3b, 0x61, 0x5e, 0x63, 0x5f, 0x67, 0xfb, 0x21, 0x16, 0x75, 0x12, 0xcc, 0x0d, 0x64, 0x58, 0x56,
+    0x83, 0x18, 0xae, 0xd9, 0x04, 0x8f, 0x5b, 0xfc, 0xa4, 0x1b, 0x26, 0x2b, 0x74, 0x0b, 0x0b, 0x2f,
+    0x57, 0x24, 0x1e, 0x0f, 0x90, 0x0d, 0xd4, 0xe0, 0xc4, 0x59, 0x64, 0xfb, 0x85, 0x8f, 0x04, 0x70,
+    0xdc, 0xb5, 0x18, 0xeb, 0x0d, 0xe1, 0x93, 0x1b, 0x4c, 0x83, 0xc4, 0x93, 0x39, 0xfc, 0xb5, 0x51,
+    0x4d, 0x16, 0x6c, 0x34, 0x11, 0x24, 0x8c, 0xdf, 0x10, 0x96, 0xe6, 0x34, 0x65, 0x96, 0x1b, 0x83,
+    0x4d, 0x4b, 0x98, 0xb8, 0xc9, 0x5c, 0x02, 0x64, 0x6d, 0xf4, 0xe7, 0x97, 0x67, 0x91, 0xfa, 0x09,
+    0x67, 0xab, 0x55, 0x3d, 0x5b, 0x0b, 0x2e, 0x11, 0x9d, 0xd6, 0x25, 0xb3, 0x43, 0xbb, 0x3d, 0x2f,
+    0xa7, 0x28, 0xf4, 0x81, 0x04, 0x66, 0x1a, 0x22, 0x01, 0x1d, 0x9c, 0xba, 0x52, 0xbd, 0x5a, 0xbf,
+    0x37, 0xef, 0x66, 0x63, 0x3e, 0x0b, 0xfc, 0x85, 0x22, 0x03, 0x05, 0xa3, 0xea, 0xf0, 0x6c, 0x36,
+    0xea, 0xd1, 0xf5, 0x3c, 0xc6, 0xf6, 0x29, 0x27, 0x00, 0x98, 0xe3, 0x0d, 0xa0, 0xb2, 0xcd, 0xae,
+    0x53, 0x4c, 0x50, 0x85, 0xbd, 0xd4, 0xc3, 0xf0, 0x49, 0x1e, 0x5f, 0x15, 0xd7, 0x09, 0x27, 0xb9,
+    0x85, 0x66, 0x58, 0xf8, 0x12, 0x83, 0xc3, 0x69, 0xa5, 0x5c, 0xc6, 0x49, 0x66, 0xba, 0x87, 0xf1,
+    0x78, 0xa9, 0x6d, 0x5e, 0x84, 0x12, 0x3a, 0x19, 0xc7, 0xe2, 0x08, 0x12, 0xf3, 0xc8, 0xd3, 0xe6,
+    0x14, 0x62, 0x46, 0x67, 0x56, 0xf6, 0x92, 0xf4, 0xee, 0xb1, 0xfe, 0x34, 0x17, 0x99, 0x8d, 0x07,
+    0x0d, 0x01, 0xcc, 0xda, 0x17, 0x7a, 0x25, 0xcd, 0x0a, 0xab, 0xa7, 0x7b, 0x5e, 0x99, 0xc9, 0x75,
+    0x0d, 0xbd, 0xd8, 0xb7, 0x3c, 0x4c, 0x1a, 0xcc, 0x18, 0xbf, 0x53, 0x86, 0xcd, 0x32, 0xbc, 0x02,
+    0xab, 0x67, 0xc7, 0xec, 0xaa, 0x9c, 0x4c, 0xea, 0xfa, 0x46, 0x00, 0xe2, 0xff, 0xbf, 0xd8, 0xac,
+    0xdd, 0x05, 0x8a, 0x26, 0xec, 0x81, 0xa9, 0x65, 0x21, 0xda, 0xd2, 0x6e, 0x70, 0xab, 0x8a, 0xb0,
+    0x7a, 0x89, 0x9d, 0xfc, 0x3b, 0x55, 0x2d, 0x0f, 0x9c, 0xdc, 0x5c, 0x9f, 0xb2, 0x84, 0x53, 0x5f,
+    0xcb, 0x7e, 0x48, 0x8d, 0xc8, 0x3a, 0x08, 0x56, 0xc3, 0xde, 0xfa, 0xe5, 0xd9, 0xf3, 0x10, 0x87,
+    0x64, 0xe1, 0x17, 0xb6, 0xae, 0x6a, 0x4a, 0xfd, 0xde, 0x9b, 0x5a, 0xf6, 0x75, 0x2c, 0x16, 0xf5,
+    0x98, 0xf7, 0xbc, 0xde, 0xb6, 0x38, 0x3b, 0x40, 0x74, 0xc0, 0x45, 0xcb, 0x46, 0xa2, 0xb2, 0xaf,
+    0xb7, 0x5d, 0x9a, 0xed, 0xf5, 0x23, 0xb4, 0x77, 0xb3, 0xd8, 0x80, 0x0f, 0x04, 0xe3, 0x8d, 0x26,
+    0x10, 0x8f, 0xc1, 0x2c, 0x4c, 0xb0, 0xb5, 0x08, 0x60, 0xd2, 0x08, 0x05, 0xf8, 0xd2, 0xc4, 0x17,
+    0xd3, 0xda, 0x89, 0xfc, 0x95, 0x7f, 0xb8, 0x54, 0x2d, 0xb2, 0xf5, 0x5a, 0xef, 0x08, 0xe1, 0x6d,
+    0x16, 0x7a, 0x42, 0x90, 0x74, 0xbf, 0xe7, 0x85, 0x37, 0xde, 0x4e, 0xa4, 0x1a, 0x95, 0x4b, 0xea,
+    0x61, 0x00, 0x2d, 0x1e, 0xe4, 0x0a, 0xd1, 0xd1, 0xde, 0x14, 0x45, 0xb7, 0x65, 0xfe, 0x26, 0x7d,
+    0x73, 0xe8, 0xee, 0x12, 0x38, 0xa0, 0x2b, 0xfb, 0xf5, 0x7d, 0x42, 0x2f, 0xd5, 0xde, 0xa7, 0x41,
+    0xb9, 0xee, 0xf1, 0x55, 0x75, 0x32, 0x39, 0x45, 0x95, 0xc3, 0x90, 0x0c, 0x45, 0xbb, 0x89, 0x62,
+    0xfe, 0x26, 0x16, 0x6c, 0xe7, 0xf2, 0xcd, 0xf2, 0xb4, 0xaa, 0xe7, 0x04, 0xd9, 0xe4, 0x4b, 0x3a,
+    0xa6, 0xc3, 0x59, 0x3c, 0x36, 0xd3, 0x83, 0x5c, 0x57, 0xf8, 0x66, 0x79, 0x20, 0x3d, 0xcc, 0x88,
+    0x6f, 0xad, 0x8c, 0x52, 0xdf, 0x44, 0xc7, 0x88, 0x70, 0xf3, 0x0d, 0xae, 0xab, 0x06, 0x03, 0xdf,
+    0x3e, 0x87, 0xa1, 0x5f, 0xfe, 0xee, 0xd7, 0xc9, 0xb8, 0xac, 0x5c, 0x27, 0x6c, 0x05, 0x35, 0xd6,
+    0x3d, 0xa3, 0x59, 0xb6, 0x89, 0x82, 0x57, 0xe4, 0x10, 0x8d, 0xfa, 0x69, 0xe3, 0x87, 0x3e, 0x42,
+    0xd5, 0x6e, 0x38, 0xd3, 0x84, 0xe3, 0x61, 0xaf, 0xcf, 0x1d, 0xf6, 0x63, 0x22, 0x75, 0x5b, 0xf4,
+    0x24, 0xbc, 0x92, 0x2f, 0xf1, 0xb8, 0x4d, 0x37, 0x5f, 0x73, 0x91, 0x12, 0xcd, 0xaa, 0xca, 0x39,
+    0x21, 0x48, 0xb2, 0x52, 0x7f, 0x59, 0x4c, 0x3c, 0x0a, 0x34, 0xa3, 0xed, 0x68, 0xbd, 0x3a, 0x3c,
+    0x7e, 0xd7, 0xd7, 0x79, 0x6d, 0x58, 0x6f, 0x96, 0x60, 0x94, 0xbd, 0x71, 0x0a, 0xb0, 0x11, 0xbf,
+    0x02, 0x09, 0x9d, 0x50, 0xbd, 0xfb, 0x9d, 0x0c, 0x0c, 0x6d, 0xe6, 0xda, 0xb2, 0xa7, 0x23, 0xab,
+    0xb2, 0x74, 0x14, 0x6f, 0xb2, 0x32, 0x1b, 0x70, 0xca, 0x85, 0x9a, 0x37, 0xa1, 0x4b, 0x6e, 0x72,
+    0x5d, 0x0f, 0x18, 0x2e, 0xd6, 0x97, 0x4f, 0xbc, 0x11, 0x2c, 0x70, 0x6a, 0x72, 0x72, 0x20, 0x5b,
+    0xeb, 0x01, 0x55, 0x54, 0x11, 0x0f, 0xc7, 0xbd, 0x1b, 0x43, 0x4f, 0xab, 0xc0, 0xb1, 0x2e, 0x21,
+    0x9b, 0xca, 0x78, 0xf4, 0xe2, 0xd0, 0x62, 0x06, 0xc9, 0x9f, 0xf9, 0xf5, 0xc7, 0xf3, 0xb5, 0x6b,
+    0x3c, 0x9f, 0x4c, 0x73, 0xe3, 0x40, 0xf0, 0x6a, 0xea, 0xe4, 0x43, 0x45, 0xd1, 0xa2, 0xd9, 0xe6,
+    0xb1, 0x5b, 0xba, 0x5f, 0x93, 0x01, 0x82, 0x81, 0x4e, 0x4c, 0x53, 0x8d, 0xbd, 0x43, 0xe0, 0xe7,
+    0x67, 0xc0, 0x1b, 0xf6, 0x9a, 0x85, 0xc4, 0x8d, 0xe5, 0x20, 0x60, 0x25, 0x02, 0x40, 0x0f, 0x5d,
+    0x10, 0x7f, 0xa1, 0x46, 0x9d, 0x73, 0x79, 0xb7, 0x82, 0x3b, 0x21, 0xe6, 0xa4, 0xe5, 0xff, 0x7e,
+    0x6f, 0x19, 0x5c, 0x8a, 0x93, 0x6c, 0x6a, 0xb7, 0xf3, 0xac, 0x87, 0x4c, 0x9c, 0x79, 0x21, 0x19,
+    0x57, 0x98, 0x99, 0xba, 0xca, 0xa9, 0x88, 0x07, 0x8c, 0x09, 0xb1, 0xe6, 0x4b, 0x8c, 0x86, 0x71,
+    0x40, 0xbd, 0x03, 0x62, 0xa8, 0xf3, 0x4d, 0xfd, 0x52, 0xf4, 0xd7, 0x12, 0x51, 0x89, 0x23, 0x6a,
+    0x47, 0xd1, 0xcd, 0x3c, 0x51, 0xf4, 0x97, 0x79, 0xac, 0xdd, 0x3e, 0x9d, 0x65, 0xfe, 0xaf, 0xb8,
+    0x1c, 0xff, 0xd5, 0xbc, 0x0f, 0x58, 0xc5, 0xda, 0x31, 0x99, 0x5f, 0x84, 0x27, 0x2d, 0x9b, 0x58,
+    0x37, 0x87, 0x32, 0xe5, 0x43, 0xda, 0xa6, 0x4a, 0xab, 0x17, 0x61, 0xf2, 0xee, 0x1d, 0x16, 0x76,
+    0x50, 0x5c, 0xda, 0xcf, 0x9e, 0xf3, 0x89, 0x54, 0x31, 0x6d, 0x0e, 0xde, 0xac, 0xcd, 0xf4, 0xc7,
+    0xa6, 0x99, 0xfd, 0x45, 0x3a, 0x93, 0xc1, 0xb6, 0x53, 0x01, 0x72, 0x06, 0x45, 0x68, 0x17, 0xdb,
+    0xbf, 0x9c, 0x6e, 0xa1, 0x95, 0x95, 0xb2, 0xeb, 0x48, 0x00, 0xf1, 0xbc, 0x0e, 0x07, 0x28, 0x06,
+    0x96, 0x4c, 0x39, 0x7c, 0x69, 0x01, 0x86, 0xe0, 0xa1, 0xfa, 0x5f, 0x16, 0xb4, 0x96, 0x6f, 0x91,
+    0xba, 0x26, 0x3f, 0xe4, 0x3f, 0x97, 0x6a, 0xac, 0x84, 0xf8, 0xb8, 0x13, 0x7c, 0xde, 0xb1, 0x5f,
+    0xb8, 0x6b, 0xed, 0x36, 0x2b, 0xc8, 0xa0, 0x6d, 0xa7, 0xc4, 0x02, 0x80, 0x0b, 0xa8, 0x64, 0xf4,
+    0x47, 0xba, 0x6e, 0xa6, 0x73, 0xaa, 0xd9, 0x97, 0x2e, 0x50, 0x4b, 0x50, 0x67, 0x05, 0x07, 0x0b,
+    0x2e, 0x17, 0x81, 0xc3, 0xa1, 0xf2, 0x55, 0xee, 0xf8, 0xb4, 0x16, 0x11, 0x8e, 0x25, 0x4c, 0x93,
+    0x5b, 0x1a, 0xa4, 0xbf, 0x05, 0xe3, 0xed, 0x9a, 0xe4, 0xc6, 0x3f, 0x73, 0xac, 0xc7, 0x16, 0x3a,
+    0xa6, 0x57, 0x16, 0xf5, 0xd1, 0xa4, 0xd1, 0x28, 0xc2, 0x52, 0xe0, 0xe0, 0xc5, 0x5e, 0xa2, 0x31,
+    0xed, 0xc7, 0x70, 0x97, 0x6c, 0xb5, 0x1b, 0xd6, 0x88, 0x56, 0x0f, 0xe9, 0xe3, 0x8f, 0x6e, 0xb5,
+    0x7d, 0x51, 0x60, 0xe9, 0xe4, 0x21, 0x81, 0xcd, 0x25, 0xf1, 0x99, 0x13, 0x02, 0x1b, 0x7f, 0xe5,
+    0x1d, 0xe0, 0x7c, 0x51, 0x7e, 0xe0, 0xbd, 0x0e, 0xe8, 0xc5, 0xc9, 0xad, 0x82, 0x0c, 0x47, 0xc8,
+    0xc6, 0x96, 0x32, 0xeb, 0x47, 0x9d, 0x5b, 0x3a, 0x6b, 0xe4, 0x59, 0x6a, 0x03, 0xcc, 0xba, 0x55,
+    0x1f, 0x87, 0xf5, 0x54, 0xd9, 0xd6, 0x25, 0x60, 0x36, 0x09, 0xf5, 0x5c, 0x2a, 0x1e, 0x94, 0x03,
+    0x5e, 0xda, 0x43, 0x74, 0x81, 0x7c, 0xd7, 0x1b, 0x13, 0x96, 0xdf, 0xcf, 0xf5, 0x35, 0x78, 0x35,
+    0x95, 0x91, 0x99, 0xc9, 0x84, 0x69, 0xc4, 0x5a, 0x61, 0xa4, 0xc6, 0x55, 0x44, 0x83, 0x89, 0x9e,
+    0x94, 0xfd, 0x25, 0x16, 0xac, 0x9a, 0x11, 0x84, 0xd9, 0x6c, 0xe2, 0x06, 0xb5, 0xbc, 0xf0, 0x4d,
+    0x95, 0x21, 0xfd, 0xae, 0xb4, 0x20, 0xa3, 0x05, 0x7a, 0xcb, 0x22, 0xb0, 0x53, 0xbf, 0xd7, 0x7a,
+    0xbf, 0x48, 0xa3, 0x6e, 0xcb, 0x6b, 0x6a, 0xd2, 0x1a, 0x2c, 0x58, 0x6d, 0x82, 0x5a, 0x58, 0x55,
+    0xc7, 0xd8, 0x5b, 0xe5, 0x47, 0x7c, 0x58, 0x7b, 0x2a, 0x6b, 0xaa, 0xd5, 0x60, 0x9d, 0xc3, 0x7e,
+    0x45, 0x63, 0x64, 0x8e, 0x50, 0x8b, 0x1e, 0x39, 0x69, 0x04, 0x8c, 0xeb, 0x69, 0x64, 0xfa, 0xf6,
+    0xcb, 0x49, 0x5d, 0xa3, 0xb5, 0x8b, 0x6a, 0xaf, 0xdf, 0xd0, 0x68, 0x0b, 0x64, 0x9d, 0x63, 0x38,
+    0x73, 0x99, 0x3f, 0x46, 0xed, 0xc3, 0xe7, 0xbf, 0xa5, 0x8c, 0xce, 0xc9, 0x8a, 0xa5, 0x42, 0x3d,
+    0xf5, 0xee, 0x12, 0x0a, 0xb9, 0x9a, 0x67, 0x65, 0x29, 0xa0, 0x01, 0x14, 0x35, 0xce, 0x70, 0x44,
+    0xde, 0x96, 0x3b, 0x5d, 0x5c, 0x54, 0x49, 0x85, 0x8c, 0x53, 0x91, 0x07, 0x88, 0xd4, 0x66, 0xfc,
+    0x6f, 0x4d, 0xa4, 0x69, 0x2d, 0xf7, 0x5a, 0x62, 0x5e, 0x63, 0x95, 0x1c, 0x49, 0x9b, 0x4c, 0x00,
+    0x84, 0x34, 0x0c, 0x01, 0xd5, 0xc9, 0x7c, 0x4d, 0xf2, 0x05, 0xb7, 0xc7, 0x5a, 0x11, 0x24, 0x70,
+    0x07, 0x17, 0x7b, 0xbf, 0x74, 0x94, 0x56, 0x08, 0x17, 0x81, 0x25, 0x2b, 0x42, 0x36, 0xdf, 0x3c,
+    0xda, 0x21, 0x0f, 0x11, 0x71, 0x3e, 0xb1, 0xaf, 0x7d, 0xbb, 0x07, 0x74, 0xf9, 0x1c, 0x59, 0x2a,
+    0x22, 0x89, 0xa0, 0xb6, 0x37, 0x9f, 0xe1, 0x54, 0x97, 0x9c, 0x37, 0xcc, 0x25, 0x63, 0xb7, 0x35,
+    0x8d, 0xe5, 0x3c, 0xb1, 0xf0, 0x52, 0x61, 0xf9, 0x82, 0xf1, 0x58, 0x08, 0x05, 0xd2, 0xc8, 0x9f,
+    0x8e, 0xdd, 0x1c, 0x71, 0xb0, 0x3b, 0x00, 0x81, 0x79, 0xa1, 0x9d, 0x5c, 0xdb, 0x59, 0x85, 0x97,
+    0x4e, 0x16, 0xfa, 0x59, 0x7f, 0xf2, 0x28, 0xe7, 0x1a, 0xa0, 0xdf, 0x67, 0x51, 0x4a, 0x5c, 0x52,
+    0x0b, 0x3a, 0xde, 0x79, 0x4e, 0x99, 0xce, 0xce, 0x44, 0x02, 0x8f, 0xde, 0x17, 0x82, 0x80, 0xab,
+    0xb0, 0xab, 0xa3, 0x8b, 0x71, 0x5b, 0x51, 0x39, 0xbc, 0x02, 0x13, 0x52, 0x8e, 0xc6, 0x0d, 0x49,
+    0x7d, 0x75, 0x4d, 0x10, 0x3d, 0x34, 0x4e, 0xbf, 0xd3, 0x9d, 0x34, 0x4a, 0xa9, 0xb2, 0x18, 0x92,
+    0xb0, 0xd0, 0xca, 0x52, 0x2a, 0xd0, 0x88, 0x3f, 0xcb, 0x68, 0x7c, 0x2f, 0x21, 0x71, 0xf2, 0x3b,
+    0x3d, 0x77, 0x3b, 0x1b, 0x37, 0xe9, 0x88, 0x63, 0xa7, 0x71, 0x4f, 0x9b, 0xe9, 0x23, 0x38, 0x30,
+    0xf0, 0xe2, 0xd3, 0x79, 0xd0, 0xaa, 0x9b, 0x3c, 0xec, 0xf2, 0xb2, 0x64, 0xca, 0x1c, 0xf9, 0xa0,
+    0xc5, 0x0c, 0x5e, 0xbc, 0x4a, 0x5b, 0xb9, 0x40, 0x82, 0xd3, 0x66, 0x3a, 0x1a, 0x18, 0x59, 0x3a,
+    0xe2, 0x7e, 0xbb, 0x1a, 0x19, 0x03, 0xbb, 0x55, 0xab, 0xaf, 0xcf, 0xe8, 0x6d, 0xf1, 0xa6, 0xd9,
+    0x1d, 0x47, 0x61, 0xda, 0xc1, 0xa9, 0x3b, 0x2d, 0x27, 0x75, 0x45, 0x5a, 0xc6, 0xf8, 0xef, 0xe9,
+    0xd5, 0x60, 0x33, 0x7d, 0x76, 0x2b, 0xb7, 0x05, 0x92, 0x7f, 0x9e, 0x8d, 0xfa, 0xff, 0x59, 0xdb,
+    0x76, 0x91, 0xf4, 0x62, 0xf8, 0xf8, 0xc9, 0x35, 0x1b, 0xf2, 0x5d, 0xbc, 0xc3, 0x3f, 0xe3, 0xbf,
+    0xc3, 0xc3, 0xfe, 0xff, 0x1f, 0x0e, 0xe4, 0xb3, 0xaf, 0xdb, 0x47, 0xf7, 0x68, 0xf6, 0x9e, 0x6c,
+    0x41, 0xe9, 0x45, 0x23, 0x6b, 0x7f, 0x14, 0x74, 0xcc, 0x71, 0x99, 0x0a, 0x67, 0xcb, 0x20, 0x1e,
+    0xd9, 0xdd, 0x17, 0x33, 0x37, 0x23, 0x6a, 0x29, 0x65, 0x6b, 0x2e, 0x8c, 0x7c, 0x84, 0x41, 0xf4,
+    0xad, 0x18, 0x9c, 0xaf, 0xd4, 0xa7, 0x5a, 0x99, 0xa3, 0x2a, 0x25, 0x39, 0xee, 0x94, 0xf8, 0x35,
+    0xa0, 0x4d, 0x8d, 0xe5, 0xb1, 0x96, 0x39, 0x7d, 0xb8, 0xfb, 0xd6, 0xe0, 0xd2, 0xac, 0x99, 0xb5,
+    0xb2, 0xf5, 0xc9, 0xea, 0x0a, 0x3b, 0xc5, 0x53, 0x8c, 0x45, 0x30, 0xae, 0x7c, 0x16, 0xbb, 0x83,
+    0x08, 0x71, 0xf8, 0x47, 0xa9, 0x98, 0x1e, 0x01, 0xd7, 0x5b, 0xe0, 0x24, 0x7f, 0x4f, 0x8b, 0x76,
+    0xa4, 0x37, 0x2a, 0xc9, 0x65, 0xed, 0x25, 0x5c, 0x00, 0xf3, 0x42, 0x9b, 0x65, 0xe1, 0x87, 0xb4,
+    0xae, 0x48, 0x5a, 0xad, 0x10, 0xa5, 0x02, 0x7e, 0x38, 0x77, 0xc1, 0x5e, 0xc9, 0x06, 0xba, 0xbb,
+    0x27, 0xc0, 0x20, 0xf6, 0x70, 0x39, 0x56, 0xfa, 0x96, 0x47, 0x17, 0x6e, 0x73, 0x29, 0x87, 0x94,
+    0xe1, 0x02, 0x14, 0x8b, 0xca, 0x2e, 0x03, 0x3c, 0x56, 0xcb, 0x58, 0x49, 0x2e, 0x8e, 0xf4, 0x55,
+    0x9e, 0x13, 0xd9, 0x30, 0xe0, 0x9c, 0x3f, 0xca, 0xdd, 0x34, 0xc3, 0xe9, 0x6f, 0xf7, 0x1c, 0x3a,
+    0x24, 0x43, 0x2a, 0x41, 0x64, 0xf5, 0xd8, 0x69, 0x99, 0x56, 0x4a, 0x03, 0x3b, 0x40, 0x88, 0xcb,
+    0x68, 0x07, 0xa2, 0xd9, 0xb0, 0x58, 0xcb, 0xcd, 0x9a, 0x38, 0x75, 0x6d, 0x87, 0x1f, 0xa4, 0xf9,
+    0x8e, 0x31, 0x6a, 0x7a, 0x99, 0xb0, 0xd3, 0x85, 0x88, 0x25, 0x86, 0x50, 0x77, 0xf8, 0x60, 0xf5,
+    0xf3, 0x94, 0x1c, 0x8f, 0x1d, 0x52, 0x4c, 0xa1, 0x08, 0x01, 0xdf, 0x19, 0x6e, 0xb1, 0xc1, 0xe3,
+    0x85, 0xa2, 0xb7, 0xf1, 0x56, 0x83, 0xe9, 0xcc, 0x2f, 0xfb, 0x85, 0x93, 0xe4, 0xeb, 0xa0, 0xdd,
+    0x81, 0xfb, 0x0f, 0xda, 0xf1, 0x66, 0x83, 0x4f, 0x17, 0x57, 0xe2, 0x91, 0x49, 0x11, 0xa4, 0x80,
+    0xda, 0xf0, 0x75, 0x64, 0xe0, 0x4d, 0xeb, 0x76, 0xa7, 0xae, 0x62, 0x4c, 0x9d, 0xba, 0xc3, 0x88,
+    0x8e, 0x13, 0x17, 0x63, 0x9c, 0xe2, 0xb2, 0x22, 0x33, 0x65, 0xac, 0x0c, 0xac, 0x3c, 0x27, 0xc4,
+    0x20, 0xab, 0x8e, 0x34, 0xf7, 0x02, 0x5d, 0xf8, 0x3a, 0x38, 0xcf, 0x8b, 0x41, 0xf2, 0x45, 0xab,
+    0xb8, 0xb1, 0x78, 0x91, 0x50, 0x51, 0x7d, 0x3a, 0x5e, 0xfa, 0xe2, 0x12, 0x6b, 0xa1, 0x34, 0x1a,
+    0x83, 0x06, 0xac, 0x8d, 0x42, 0x6b, 0x56, 0x71, 0x63, 0x26, 0x37, 0xdb, 0x68, 0xdb, 0xe7, 0xa8,
+    0x1b, 0xef, 0xc2, 0x86, 0x1d, 0x5e, 0x86, 0x0c, 0x6b, 0xa2, 0x86, 0xd3, 0xc2, 0xc6, 0x99, 0x40,
+    0x9a, 0x12, 0xf4, 0xe6, 0x65, 0xfe, 0xc4, 0x4b, 0xfc, 0x1c, 0x09, 0x49, 0x2f, 0x47, 0x7a, 0x5f,
+    0x1e, 0x56, 0x93, 0x35, 0x86, 0xf2, 0x72, 0x3e, 0x87, 0x74, 0xe4, 0x39, 0xab, 0x6a, 0x83, 0xaf,
+    0x77, 0x19, 0x3f, 0x02, 0xa7, 0x21, 0x8e, 0x0a, 0xd7, 0x78, 0xe6, 0x09, 0x6f, 0xbf, 0x42, 0xd8,
+    0x68, 0xb9, 0xa9,
+};
+
+/* icons.h:addfoldericon - 231 bytes, gzip 183 bytes */
+static const uint8_t icons_h_addfoldericon_gz[] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0x4d, 0x8e, 0xcd, 0x0a, 0x83, 0x40,
+    0x0c, 0x84, 0x5f, 0x25, 0xe4, 0xae, 0xbb, 0xa6, 0x41, 0x4a, 0xe9, 0x7a, 0xe8, 0xc9, 0x8b, 0xd7,
+    0xde, 0x0b, 0x5a, 0x23, 0xf8, 0x47, 0x5d, 0x76, 0x65, 0x9f, 0xbe, 0x91, 0x16, 0x5a, 0x08, 0x61,
+    0x32, 0x7c, 0x99, 0xe4, 0xba, 0x85, 0x1e, 0xf6, 0x69, 0x9c, 0x37, 0x87, 0xe2, 0xfd, 0x7a, 0x31,
+    0x26, 0xc6, 0x98, 0xc7, 0x53, 0xbe, 0xbc, 0x7a, 0x43, 0xd6, 0x5a, 0xa3, 0x04, 0x42, 0x1c, 0x5a,
+    0x2f, 0x0e, 0x89, 0x11, 0xa4, 0x1b, 0x7a, 0xf1, 0x1f, 0x1d, 0x86, 0x2e, 0xde, 0x96, 0xdd, 0xa1,
+    0x05, 0x0b, 0xc4, 0x5a, 0x58, 0x5d, 0xd7, 0x87, 0x17, 0x68, 0x1d, 0x36, 0x6a, 0x0a, 0x71, 0x20,
+    0xae, 0x6d, 0x42, 0x78, 0x0e, 0xe3, 0xe8, 0x70, 0x5e, 0xe6, 0x4e, 0x19, 0x73, 0x40, 0x7f, 0x68,
+    0xc1, 0x50, 0xd8, 0x9a, 0x02, 0x49, 0x41, 0x21, 0xa3, 0x34, 0xd9, 0x8c, 0xbf, 0xe3, 0xbd, 0x4c,
+    0x13, 0xc3, 0x39, 0x64, 0x2c, 0x19, 0x05, 0x6d, 0x9a, 0x28, 0xac, 0x82, 0x0e, 0x8b, 0x95, 0x56,
+    0x2b, 0x35, 0x04, 0x45, 0x29, 0x4a, 0xd1, 0xb1, 0x96, 0x7e, 0x27, 0x8e, 0xff, 0xab, 0x37, 0x88,
+    0x41, 0xba, 0x3a, 0xe7, 0x00, 0x00, 0x00,
+};
+
+/* icons.h:addfoldericon - brotli 176 bytes */
+static const uint8_t icons_h_addfoldericon_br[] = {
+    0x1b, 0xe6, 0x00, 0x00, 0x9c, 0x05, 0xce, 0x39, 0x9d, 0x26, 0x45, 0xe8, 0xec, 0xe9, 0xe2, 0xd1,
+    0xa0, 0x8f, 0x10, 0x4a, 0x1e, 0xb2, 0x39, 0x5b, 0x9b, 0xa9, 0x72, 0x76, 0x6e, 0xc8, 0xfe, 0x3c,
+    0x8b, 0x84, 0x25, 0x8b, 0x75, 0xa1, 0x8e, 0xb2, 0xfa, 0x81, 0x94, 0xa1, 0x79, 0x03, 0x87, 0x1c,
+    0xf9, 0x41, 0xbe, 0xe6, 0x29, 0x97, 0xd9, 0x6e, 0x38, 0xd1, 0x89, 0xe5, 0xda, 0xa4, 0xbb, 0xa7,
+    0x6e, 0x5d, 0x12, 0x15, 0x36, 0xa1, 0x00, 0x03, 0x8c, 0x34, 0xcd, 0xd3, 0x53, 0x1f, 0x88, 0x9f,
+    0xca, 0x36, 0x4d, 0xfc, 0x3b, 0xcd, 0xef, 0x97, 0xf8, 0x75, 0xb1, 0x99, 0x95, 0x88, 0xb2, 0x7b,
+    0xbc, 0x93, 0x99, 0x5d, 0xa8, 0x34, 0xc1, 0xdd, 0xc1, 0x4d, 0x43, 0x93, 0x43, 0xae, 0xcf, 0x5f,
+    0x98, 0x98, 0x38, 0xc4, 0x2c, 0xec, 0xaa, 0x51, 0x39, 0x05, 0x4e, 0xa6, 0x6f, 0xab, 0x26, 0x3c,
+    0x92, 0x92, 0x17, 0x71, 0x50, 0x57, 0xf8, 0x57, 0x20, 0xdd, 0xb6, 0xd3, 0xb3, 0x3b, 0x55, 0xfd,
+    0xa6, 0xa5, 0xf2, 0x3b, 0xa4, 0x43, 0x26, 0xe3, 0x99, 0x8a, 0x48, 0x8d, 0x9e, 0x20, 0xd2, 0x5d,
+    0x40, 0x15, 0xd4, 0x21, 0x7d, 0xe4, 0x84, 0x56, 0xaf, 0x16, 0xbc, 0x8b, 0x85, 0x37, 0x20, 0x00,
+};
+
+/* icons.h:emptyicon - 97 bytes, gzip 105 bytes */
+static const uint8_t icons_h_emptyicon_gz[] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0x25, 0x8b, 0x49, 0x0a, 0x80, 0x30,
+    0x0c, 0x00, 0xbf, 0x12, 0xf2, 0x00, 0x13, 0x6a, 0x4f, 0xd2, 0xf6, 0xe0, 0x4f, 0x04, 0xa5, 0x29,
+    0xb8, 0xa1, 0xa1, 0xe9, 0xf3, 0x55, 0x84, 0x39, 0xcc, 0x61, 0x26, 0xdc, 0x35, 0x43, 0xdb, 0xd6,
+    0xfd, 0x8e, 0x28, 0xaa, 0xe7, 0x40, 0x64, 0x66, 0x9d, 0xf5, 0xdd, 0x71, 0x65, 0x72, 0xcc, 0x4c,
+    0x6f, 0x81, 0x60, 0x65, 0x56, 0x89, 0xe8, 0x3c, 0x82, 0x2c, 0x25, 0x8b, 0xfe, 0x5e, 0xcb, 0x62,
+    0xe3, 0xd1, 0x22, 0x32, 0x30, 0x38, 0xff, 0x82, 0x29, 0x9c, 0x93, 0x0a, 0x50, 0x0a, 0xdf, 0x99,
+    0x1e, 0xa6, 0x33, 0x2e, 0xb0, 0x61, 0x00, 0x00, 0x00,
+};
+
+/* icons.h:emptyicon - brotli 88 bytes */
+static const uint8_t icons_h_emptyicon_br[] = {
+    0x1b, 0x60, 0x00, 0xa0, 0x2d, 0x0a, 0xec, 0x06, 0xfa, 0x6a, 0x42, 0x60, 0x24, 0xea, 0xf3, 0xeb,
+    0x96, 0x5e, 0x5f, 0xf1, 0xcc, 0xc1, 0xc6, 0xd8, 0xba, 0xe1, 0x38, 0x49, 0xd4, 0x3d, 0x3e, 0x42,
+    0x67, 0xf2, 0xed, 0x0e, 0xaf, 0x66, 0xec, 0xa0, 0x19, 0x07, 0xec, 0x8f, 0x69, 0x97, 0x64, 0x32,
+    0xd0, 0x01, 0x8e, 0x74, 0xe0, 0x1c, 0xeb, 0x5a, 0xaa, 0x72, 0x16, 0xec, 0xbf, 0xfe, 0x31, 0xfc,
+    0xc0, 0x18, 0xc3, 0xde, 0x21, 0x3a, 0xa6, 0xf6, 0xa1, 0xad, 0xfd, 0x58, 0x4c, 0xef, 0x97, 0xc1,
+    0x98, 0x5d, 0x45, 0xf3, 0xd4, 0x2a, 0x20, 0x01,
+};
+
+/* icons.h:starticon - 151 bytes, gzip 143 bytes */
+static const uint8_t icons_h_starticon_gz[] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0x4d, 0xcd, 0x41, 0x0a, 0xc2, 0x30,
+    0x10, 0x85, 0xe1, 0xab, 0x0c, 0xb3, 0xb7, 0x99, 0xc4, 0x88, 0x22, 0x4d, 0x17, 0xae, 0xdc, 0x78,
+    0x08, 0xa1, 0x31, 0x13, 0x88, 0x49, 0xb1, 0x21, 0x53, 0x7a, 0x7a, 0x5b, 0x57, 0x6e, 0xdf, 0xf7,
+    0xc3, 0xeb, 0xe7, 0x16, 0x60, 0x79, 0xa7, 0x3c, 0x3b, 0xe4, 0x5a, 0xa7, 0xab, 0x52, 0x22, 0xd2,
+    0xc9, 0xb1, 0x2b, 0x9f, 0xa0, 0x0c, 0x11, 0xa9, 0xad, 0x40, 0x60, 0x1f, 0x03, 0x57, 0x87, 0xc6,
+    0x22, 0xb4, 0xe8, 0xe5, 0x56, 0x16, 0x87, 0x04, 0x04, 0xc6, 0xc2, 0xbe, 0x49, 0x1c, 0x2b, 0xff,
+    0x78, 0xe8, 0xa7, 0x67, 0x65, 0x18, 0x1d, 0x3e, 0x36, 0x67, 0x63, 0x9b, 0xb1, 0x77, 0x5a, 0x11,
+    0x5e, 0x31, 0x25, 0x87, 0xb9, 0x64, 0x8f, 0xea, 0x2f, 0xba, 0xc0, 0xa9, 0x69, 0x9b, 0xb4, 0x3e,
+    0x9c, 0xd7, 0x1d, 0xf6, 0xbf, 0xe1, 0x0b, 0x39, 0x53, 0x3d, 0x10, 0x97, 0x00, 0x00, 0x00,
+};
+
+/* icons.h:starticon - brotli 111 bytes */
+static const uint8_t icons_h_starticon_br[] = {
+    0x1b, 0x96, 0x00, 0xe8, 0xc4, 0xea, 0xf7, 0x97, 0xea, 0xcd, 0xf6, 0xf7, 0xad, 0xe4, 0xd2, 0x00,
+    0xbc, 0x71, 0x3a, 0xa8, 0xbe, 0xec, 0xdf, 0xb2, 0xbd, 0x2d, 0x36, 0xe0, 0x80, 0x93, 0x2e, 0xeb,
+    0xe4, 0x20, 0x4b, 0xb8, 0x53, 0xf6, 0x6e, 0x17, 0x68, 0xb5, 0x9d, 0xe3, 0x6e, 0xae, 0xe1, 0x9b,
+    0x0b, 0x1f, 0x13, 0x7f, 0x7d, 0x64, 0xaa, 0x25, 0x09, 0x82, 0xc0, 0xa3, 0xae, 0xc1, 0x15, 0x50,
+    0xdf, 0x15, 0x2d, 0xaf, 0x0b, 0x81, 0x04, 0x92, 0x94, 0xe4, 0x59, 0x31, 0xc4, 0x73, 0x0c, 0x15,
+    0xa5, 0x8b, 0x02, 0x40, 0x0b, 0x77, 0xc6, 0xc2, 0x8f, 0xf7, 0x16, 0x49, 0xd9, 0x04, 0x5f, 0xff,
+    0x06, 0xa9, 0xb7, 0xa8, 0x8c, 0xa2, 0xc8, 0xf4, 0x1f, 0x6b, 0x4e, 0xf3, 0xb8, 0x1b, 0x0f,
+};
+
+static constexpr const uint32_t WEB_ASSETS_SEED = 1;
+
+static constexpr const staticAsset WEB_ASSETS[]{
+    { "/", "text/html", index_htm_gz, sizeof(index_htm_gz), "\"ac461ba0480d78ef-gz\"", index_htm_br, sizeof(index_htm_br), "\"ac461ba0480d78ef-br\"", false },
+    { "/addfoldericon.svg", "image/svg+xml", icons_h_addfoldericon_gz, sizeof(icons_h_addfoldericon_gz), "\"dbc53db2ec738039-gz\"", icons_h_addfoldericon_br, sizeof(icons_h_addfoldericon_br), "\"dbc53db2ec738039-br\"", true },
+    { "/emptyicon.svg", "image/svg+xml", icons_h_emptyicon_gz, sizeof(icons_h_emptyicon_gz), "\"ba12c4237891c49a-gz\"", icons_h_emptyicon_br, sizeof(icons_h_emptyicon_br), "\"ba12c4237891c49a-br\"", true },
+    { "/starticon.svg", "image/svg+xml", icons_h_starticon_gz, sizeof(icons_h_starticon_gz), "\"39d601c1d4199c5c-gz\"", icons_h_starticon_br, sizeof(icons_h_starticon_br), "\"39d601c1d4199c5c-br\"", true },
+};
+
+#endif
@@ -1,25 +1,27 @@
+/* state of a multi frame message - one per client so two clients adding a folder at the same time do not mix */
+struct fileUpload {
+    lineParser<PLAYLIST_MAX_URL_LENGTH> parser;
+    bool haveCommand = false;
+    bool isFileList = false;
+    bool startNow = false;
+    uint32_t added = 0;
+    uint32_t refused = 0;
+};
+
+static std::map<uint32_t, fileUpload> _uploads;
+
 void websocketEventHandler(AsyncWebSocket* server, AsyncWebSocketClient* client, AwsEventType type, void* arg, uint8_t* data, size_t len) {
     switch (type) {
         case WS_EVT_CONNECT:
             {
+                /* the client asks for its snapshot with 'hello' */
                 log_d("client %i connected on %s", client->id(), server->url());
-                {
-                    String s;
-                    client->text(playList.toString(s));
-                    s.clear();
-                    favoritesToString(s);
-                    client->text(!s.equals("") ? s : "favorites\nThe folder '" + String(FAVORITES_FOLDER) + "' could not be found!\n");
-                }
-                client->printf("status\n%s\n", _paused ? "paused" : "playing");
-                client->printf("%s\n%i\n", CURRENT_HEADER, playList.currentItem());
-                client->printf("%s\n%i\n", VOLUME_HEADER, _playerVolume);
-                client->text(showstation);
-                client->text(streamtitle);
-                if (_paused && _currentSize) client->printf("progress\n%i\n%i\n", _currentPosition, _currentSize);
             }
             break;
         case WS_EVT_DISCONNECT:
             log_d("client %i disconnected from %s", client->id(), server->url());
+            ws.forget(client->id());
+            _uploads.erase(client->id());
             break;
         case WS_EVT_ERROR:
             log_e("ws error");
@@ -32,10 +34,13 @@ void websocketEventHandler(AsyncWebSocket* server, AsyncWebSocketClient* client,
             {
                 AwsFrameInfo* info = (AwsFrameInfo*)arg;
                 if (info->opcode == WS_TEXT) {
+                    if (info->final && info->index + len == info->len) metrics.wsMessagesIn++;
+                    xSemaphoreTakeRecursive(_playlistLock, portMAX_DELAY);
                     if (info->final && info->index == 0 && info->len == len)
                         handleSingleFrame(client, data, len);
                     else
                         handleMultiFrame(client, data, len, info);
+                    xSemaphoreGiveRecursive(_playlistLock);
                 }
                 break;
             }
@@ -48,18 +53,29 @@ void websocketEventHandler(AsyncWebSocket* server, AsyncWebSocketClient* client,
 }
 
 void handleSingleFrame(AsyncWebSocketClient* client, uint8_t* data, size_t len) {
+    scopedTimer timer("single frame");
     data[len] = 0;
     char* pch = strtok(reinterpret_cast<char*>(data), "\n");
     if (!pch) return;
 
     static size_t _pausedPosition = 0;
 
+    if (!strcmp("hello", pch)) {
+        /* hello\n<epoch>\n<playlist version>\n<favorites version>\n - the last versions this client has seen */
+        uint32_t versions[3]{};
+        for (auto& version : versions) {
+            pch = strtok(NULL, "\n");
+            if (!pch) break;
+            version = strtoul(pch, NULL, 10);
+        }
+        snapshotToClient(client, versions[0], versions[1], versions[2]);
+        return;
+    }
+
     if (_paused && !strcmp("unpause", pch)) {
-        playerMessage msg;
-        msg.action = playerMessage::CONNECTTOHOST;
-        msg.value = _pausedPosition;
-        snprintf(msg.url, PLAYLIST_MAX_URL_LENGTH, playList.url(playList.currentItem()).c_str());
-        xQueueSend(playerQueue, &msg, portMAX_DELAY);
+        char url[PLAYLIST_MAX_URL_LENGTH];
+        playList.url(playList.currentItem(), url, sizeof(url));
+        mailbox.connect(url, _pausedPosition);
         return;
     }
 
@@ -68,23 +84,25 @@ void handleSingleFrame(AsyncWebSocketClient* client, uint8_t* data, size_t len)
         if (!pch) return;
         _paused = true;
         _pausedPosition = atoi(pch);
-        ws.textAll("status\npaused\n");
-        playerMessage msg;
-        msg.action = playerMessage::STOPSONG;
-        xQueueSend(playerQueue, &msg, portMAX_DELAY);
+        ws.publish(TOPIC_STATUS, "status\npaused\n");
+        mailbox.stop();
     }
 
     else if (!strcmp("volume", pch)) {
         pch = strtok(NULL, "\n");
         if (!pch) return;
-        playerMessage msg;
-        msg.action = playerMessage::SET_VOLUME;
         const uint8_t volume = atoi(pch);
-        msg.value = volume > VS1053_MAXVOLUME ? VS1053_MAXVOLUME : volume;
-        xQueueSend(playerQueue, &msg, portMAX_DELAY);
-        _playerVolume = msg.value;
+        _playerVolume = volume > VS1053_MAXVOLUME ? VS1053_MAXVOLUME : volume;
+        mailbox.setVolume(_playerVolume);
         //TODO: send to all but not this client
-        ws.printfAll("%s\n%i\n", VOLUME_HEADER, volume);
+        ws.publishf(TOPIC_VOLUME, "%s\n%i\n", VOLUME_HEADER, volume);
+    }
+
+    else if (!strcmp("directhandover", pch)) {
+        pch = strtok(NULL, "\n");
+        if (!pch) return;
+        playList.setDirectHandover(atoi(pch));
+        ws.printfAll("%s\n%i\n", DIRECT_HANDOVER_HEADER, playList.directHandover());
     }
 
     else if (!strcmp("previous", pch)) {
@@ -104,14 +122,18 @@ void handleSingleFrame(AsyncWebSocketClient* client, uint8_t* data, size_t len)
     else if (!strcmp("filetoplaylist", pch) || !strcmp("_filetoplaylist", pch)) {
         const bool startnow = (pch[0] == '_');
         const uint32_t previousSize = playList.size();
+        uint32_t refused = 0;
         pch = strtok(NULL, "\n");
         while (pch) {
-            playList.add({ HTTP_FILE, "", pch, 0 });
+            if (!playList.add({ HTTP_FILE, "", pch, 0 })) refused++;
             pch = strtok(NULL, "\n");
         }
         const uint32_t itemsAdded{ playList.size() - previousSize };
-        client->printf("%s\nAdded %i items to playlist", MESSAGE_HEADER, itemsAdded);
-        log_d("Added %i library items to playlist", itemsAdded);
+        if (refused)
+            client->printf("%s\nAdded %i items to playlist - could not add %i", MESSAGE_HEADER, itemsAdded, refused);
+        else
+            client->printf("%s\nAdded %i items to playlist", MESSAGE_HEADER, itemsAdded);
+        log_d("Added %i library items to playlist - %i refused", itemsAdded, refused);
 
         if (!itemsAdded) return;
 
@@ -119,14 +141,14 @@ void handleSingleFrame(AsyncWebSocketClient* client, uint8_t* data, size_t len)
             playList.setCurrentItem(previousSize);
             startItem(playList.currentItem());
         }
-        upDatePlaylistOnClients();
+        playlistInsertOnClients(previousSize, itemsAdded);
     }
 
     else if (!strcmp("playitem", pch)) {
         pch = strtok(NULL, "\n");
         if (!pch) return;
-        const uint8_t index = atoi(pch);
-        if (index < playList.size()) {
+        const uint32_t index = strtoul(pch, NULL, 10);
+        if (index < (uint32_t)playList.size()) {
             playList.setCurrentItem(index);
             startItem(playList.currentItem());
         }
@@ -135,44 +157,67 @@ void handleSingleFrame(AsyncWebSocketClient* client, uint8_t* data, size_t len)
     else if (!strcmp("deleteitem", pch)) {
         pch = strtok(NULL, "\n");
         if (!pch) return;
-        const uint8_t index = atoi(pch);
-        if (index >= playList.size()) return;
+        const uint32_t index = strtoul(pch, NULL, 10);
+        if (index >= (uint32_t)playList.size()) return;
 
         playList.remove(index);
         // deleted item was before current item
-        if (index < playList.currentItem()) {
+        if ((int32_t)index < playList.currentItem()) {
             playList.setCurrentItem(playList.currentItem() - 1);
-            upDatePlaylistOnClients();
+            playlistRemoveOnClients(index);
         }
         //  deleted item was the current item
-        else if (playList.currentItem() == index) {
+        else if (playList.currentItem() == (int32_t)index) {
             // play the next item if there is one
             if (playList.currentItem() < playList.size()) {
-                upDatePlaylistOnClients();
+                playlistRemoveOnClients(index);
                 startItem(playList.currentItem());
             } else {
                 playlistHasEnded();
-                upDatePlaylistOnClients();
-                playerMessage msg;
-                msg.action = playerMessage::STOPSONG;
-                xQueueSend(playerQueue, &msg, portMAX_DELAY);
+                playlistRemoveOnClients(index);
+                mailbox.stop();
             }
         }
         // deleted item was after current item
         else {
-            upDatePlaylistOnClients();
+            playlistRemoveOnClients(index);
         }
     }
 
+    else if (!strcmp("moveitem", pch)) {
+        pch = strtok(NULL, "\n");
+        if (!pch) return;
+        const uint32_t from = strtoul(pch, NULL, 10);
+        pch = strtok(NULL, "\n");
+        if (!pch) return;
+        const uint32_t to = strtoul(pch, NULL, 10);
+        if (from >= (uint32_t)playList.size() || to >= (uint32_t)playList.size() || from == to) return;
+        playList.move(from, to);
+        playlistMoveOnClients(from, to);
+    }
+
+    else if (!strcmp("playlistwindow", pch)) {
+        /* playlistwindow\n<first>\n<count>\n */
+        pch = strtok(NULL, "\n");
+        if (!pch) return;
+        const uint32_t first = strtoul(pch, NULL, 10);
+        pch = strtok(NULL, "\n");
+        if (!pch) return;
+        playlistWindowToClient(client, first, strtoul(pch, NULL, 10));
+    }
+
+    else if (!strcmp("playlistsync", pch)) {
+        playlistToClient(client);
+        client->printf("%s\n%i\n", CURRENT_HEADER, playList.currentItem());
+    }
+
     else if (!strcmp("clearlist", pch)) {
         if (!playList.size()) return;
-        playerMessage msg;
-        msg.action = playerMessage::STOPSONG;
-        xQueueSend(playerQueue, &msg, portMAX_DELAY);
+        mailbox.stop();
         playList.clear();
         log_d("Playlist cleared");
         playlistHasEnded();
-        upDatePlaylistOnClients();
+        playlistClearOnClients();
     }
 
     else if (!strcmp("presetstation", pch) || !strcmp("_presetstation", pch)) {
@@ -182,9 +227,7 @@ void handleSingleFrame(AsyncWebSocketClient* client, uint8_t* data, size_t len)
         const uint32_t index = atoi(pch);
         if (index >= NUMBER_OF_PRESETS) return;
 
-        const uint32_t previousSize = playList.size();
-        playList.add({ HTTP_PRESET, "", "", index });
-        if (playList.size() == previousSize) {
+        if (!playList.add({ HTTP_PRESET, "", "", index })) {
             client->printf("%s\nCould not add '%s' to playlist", MESSAGE_HEADER, preset[index].name.c_str());
             return;
         }
@@ -196,28 +239,23 @@ void handleSingleFrame(AsyncWebSocketClient* client, uint8_t* data, size_t len)
             playList.setCurrentItem(playList.size() - 1);
             startItem(playList.currentItem());
         }
-        upDatePlaylistOnClients();
+        playlistInsertOnClients(playList.size() - 1, 1);
 
     }
 
     else if (!strcmp("jumptopos", pch)) {
         pch = strtok(NULL, "\n");
         if (!pch) return;
-        playerMessage msg;
-        msg.action = playerMessage::CONNECTTOHOST;
-        msg.value = atoi(pch);
-        snprintf(msg.url, sizeof(msg.url), playList.url(playList.currentItem()).c_str());
-        xQueueSend(playerQueue, &msg, portMAX_DELAY);
+        char url[PLAYLIST_MAX_URL_LENGTH];
+        playList.url(playList.currentItem(), url, sizeof(url));
+        mailbox.connect(url, atoi(pch));
     }
 
     else if (!strcmp("currenttofavorites", pch)) {
         pch = strtok(NULL, "\n");
         if (!pch) return;
-        playListItem item;
-        playList.get(playList.currentItem(), item);
-        if (saveItemToFavorites(client, pch, item)) {
-            String s;
-            ws.textAll(favoritesToString(s));
+        if (saveItemToFavorites(client, pch, playList.currentItem())) {
+            ws.textAll(favoritesSection());
         }
     }
 
@@ -225,29 +263,26 @@ void handleSingleFrame(AsyncWebSocketClient* client, uint8_t* data, size_t len)
         const bool startNow = (pch[0] == '_');
         pch = strtok(NULL, "\n");
         if (!pch) return;
-        if (playList.size() == PLAYLIST_MAX_ITEMS) {
+        if (playList.full()) {
             client->printf("%s\nCould not add '%s' to playlist!", MESSAGE_HEADER, pch);
             return;
         }
-        handleFavoriteToPlaylist(client, pch, startNow);
-        upDatePlaylistOnClients();
+        const uint32_t previousSize = playList.size();
+        if (handleFavoriteToPlaylist(client, pch, startNow)) playlistInsertOnClients(previousSize, 1);
     }
 
     else if (!strcmp("deletefavorite", pch)) {
         pch = strtok(NULL, "\n");
         if (!pch) return;
-        char filename[strlen(FAVORITES_FOLDER) + strlen(pch) + 1];
-        snprintf(filename, sizeof(filename), "%s%s", FAVORITES_FOLDER, pch);
-        if (!FFat.remove(filename)) {
+        if (!favorites.remove(pch)) {
             client->printf("%s\nCould not delete %s", MESSAGE_HEADER, pch);
         } else {
-            String s;
-            ws.textAll(favoritesToString(s));
+            ws.textAll(favoritesSection());
         }
     }
 
     else if (!strcmp("foundlink", pch) || !strcmp("_foundlink", pch)) {
-        if (playList.size() == PLAYLIST_MAX_ITEMS) {
+        if (playList.full()) {
             client->printf("%s\nCould not add new url to playlist", MESSAGE_HEADER);
             return;
         }
@@ -256,8 +291,11 @@ void handleSingleFrame(AsyncWebSocketClient* client, uint8_t* data, size_t len)
         const char* name = strtok(NULL, "\n");
         if (!name) return;
 
-        playList.add({ HTTP_FOUND, name, url, 0 });
-        upDatePlaylistOnClients();
+        if (!playList.add({ HTTP_FOUND, name, url, 0 })) {
+            client->printf("%s\nCould not add '%s' to playlist", MESSAGE_HEADER, name);
+            return;
+        }
+        playlistInsertOnClients(playList.size() - 1, 1);
         const bool startnow = (pch[0] == '_');
         if (startnow || playList.currentItem() == PLAYLIST_STOPPED) {
             playList.setCurrentItem(playList.size() - 1);
@@ -271,42 +309,51 @@ void handleSingleFrame(AsyncWebSocketClient* client, uint8_t* data, size_t len)
 }
 
 void handleMultiFrame(AsyncWebSocketClient* client, uint8_t* data, size_t len, AwsFrameInfo* info) {
-    static String message;
-
-    message.concat(data, len); //todo: check result
-
-    if ((info->index + len) == info->len && info->final) {
-        log_d("Final multi frame message for %i bytes", info->index + len);
-        if (message.startsWith("_filetoplaylist") || message.startsWith("filetoplaylist")) {
-            const bool startnow = (message[0] == '_');
-            const uint32_t previousSize = playList.size();
-
-            auto pos = message.indexOf("\n");
-            if (-1 == pos) return;
-            pos++;
-
-            while (pos < info->len) {
-                char url[PLAYLIST_MAX_URL_LENGTH];
-                auto cnt = 0;
-                while (message.charAt(pos) != '\n') {
-                    url[cnt++] = message.charAt(pos++);
-                    if (pos == info->len) return;
-                }
-                url[cnt] = 0;
-                playList.add({ HTTP_FILE, "", url, 0 });
-                pos++;
-            }
-
-            const uint32_t itemsAdded{ playList.size() - previousSize };
-            client->printf("%s\nAdded %i items to playlist", MESSAGE_HEADER, itemsAdded);
-            log_d("Added %i items to playlist", itemsAdded);
-
-            if (itemsAdded && (startnow || playList.currentItem() == PLAYLIST_STOPPED)) {
-                playList.setCurrentItem(previousSize);
-                startItem(playList.currentItem());
-            }
-            if (itemsAdded) upDatePlaylistOnClients();
+    if (info->num == 0 && info->index == 0) {
+        log_d("Multi frame message from client %i", client->id());
+        _uploads[client->id()] = fileUpload();
+    }
+    auto entry = _uploads.find(client->id());
+    if (entry == _uploads.end()) return;
+    fileUpload& upload = entry->second;
+
+    scopedTimer timer("multi frame");
+    const uint32_t previousSize = playList.size();
+    auto onLine = [&upload](const char* line) {
+        if (!upload.haveCommand) {
+            upload.haveCommand = true;
+            upload.isFileList = !strcmp("filetoplaylist", line) || !strcmp("_filetoplaylist", line);
+            upload.startNow = (line[0] == '_');
+            return;
         }
-        message.clear();
+        if (!upload.isFileList || !line[0]) return;
+        if (playList.add({ HTTP_FILE, "", line, 0 }))
+            upload.added++;
+        else
+            upload.refused++;
+    };
+    upload.parser.feed(data, len, onLine);
+    const bool lastFragment = info->final && (info->index + len) == info->len;
+    if (lastFragment) upload.parser.finish(onLine);
+
+    /* items are added and announced per fragment so the playlist on the clients never lags behind */
+    const uint32_t itemsAdded{ playList.size() - previousSize };
+    if (itemsAdded) {
+        if (upload.startNow || playList.currentItem() == PLAYLIST_STOPPED) {
+            upload.startNow = false;
+            playList.setCurrentItem(previousSize);
+            startItem(playList.currentItem());
+        }
+        playlistInsertOnClients(previousSize, itemsAdded);
+    }
+
+    if (!lastFragment) return;
+    if (upload.isFileList) {
+        if (upload.refused)
+            client->printf("%s\nAdded %i items to playlist - could not add %i", MESSAGE_HEADER, upload.added, upload.refused);
+        else
+            client->printf("%s\nAdded %i items to playlist", MESSAGE_HEADER, upload.added);
+        log_d("Added %i items to playlist - %i did not fit, %i urls were too long", upload.added, upload.refused, upload.parser.dropped());
     }
+    _uploads.erase(entry);
 }